@@ -0,0 +1,281 @@
+//
+//  CRC32C.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/crypto/CRC32C.hpp>
+#include <fgl/data/ByteStream.hpp>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if !defined(FGL_CRC32C_DISABLE_HARDWARE) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+	// SSE4.2 is detected at runtime, since most builds don't target CPUs that are guaranteed to have it
+	#define FGL_CRC32C_X86
+	#define FGL_CRC32C_TARGET __attribute__((target("sse4.2")))
+	#include <cpuid.h>
+	#include <nmmintrin.h>
+#elif !defined(FGL_CRC32C_DISABLE_HARDWARE) && defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+	#define FGL_CRC32C_ARM
+	#define FGL_CRC32C_TARGET
+	#include <arm_acle.h>
+#endif
+
+namespace fgl {
+	namespace crypto {
+		namespace {
+			// The Castagnoli polynomial, bit reversed
+			constexpr uint32_t POLYNOMIAL = 0x82f63b78;
+
+			using CRCTable = std::array<uint32_t,256>;
+
+			/// Tables for processing 8 bytes at a time: table[k][byte] is the CRC of byte followed by k zero bytes
+			constexpr std::array<CRCTable,8> makeSlicingTables() {
+				std::array<CRCTable,8> tables = {};
+				for(uint32_t byte=0; byte<256; byte++) {
+					uint32_t crc = byte;
+					for(size_t bit=0; bit<8; bit++) {
+						crc = (crc & 1) ? ((crc >> 1) ^ POLYNOMIAL) : (crc >> 1);
+					}
+					tables[0][byte] = crc;
+				}
+				for(uint32_t byte=0; byte<256; byte++) {
+					for(size_t k=1; k<8; k++) {
+						uint32_t previous = tables[k-1][byte];
+						tables[k][byte] = (previous >> 8) ^ tables[0][previous & 0xFF];
+					}
+				}
+				return tables;
+			}
+
+			constexpr auto SLICING_TABLES = makeSlicingTables();
+
+			uint32_t extendPortable(uint32_t crc, const uint8_t* bytes, size_t size) {
+				while(size > 0 && ((uintptr_t)bytes % 8) != 0) {
+					crc = (crc >> 8) ^ SLICING_TABLES[0][(crc ^ *bytes) & 0xFF];
+					bytes++;
+					size--;
+				}
+				while(size >= 8) {
+					uint32_t low;
+					uint32_t high;
+					std::memcpy(&low, bytes, 4);
+					std::memcpy(&high, bytes + 4, 4);
+					if constexpr(std::endian::native == std::endian::big) {
+						low = byteSwap(low);
+						high = byteSwap(high);
+					}
+					low ^= crc;
+					crc = SLICING_TABLES[7][low & 0xFF] ^ SLICING_TABLES[6][(low >> 8) & 0xFF]
+						^ SLICING_TABLES[5][(low >> 16) & 0xFF] ^ SLICING_TABLES[4][low >> 24]
+						^ SLICING_TABLES[3][high & 0xFF] ^ SLICING_TABLES[2][(high >> 8) & 0xFF]
+						^ SLICING_TABLES[1][(high >> 16) & 0xFF] ^ SLICING_TABLES[0][high >> 24];
+					bytes += 8;
+					size -= 8;
+				}
+				while(size > 0) {
+					crc = (crc >> 8) ^ SLICING_TABLES[0][(crc ^ *bytes) & 0xFF];
+					bytes++;
+					size--;
+				}
+				return crc;
+			}
+
+			#if defined(FGL_CRC32C_X86) || defined(FGL_CRC32C_ARM)
+			// The CRC instructions have a latency of several cycles, so large inputs are split into 3 streams that run in parallel.
+			// The streams' CRCs are then combined by shifting them past the bytes that follow them.
+			constexpr size_t LONG_STREAM_SIZE = 8192;
+			constexpr size_t SHORT_STREAM_SIZE = 256;
+
+			/// A 32x32 matrix over GF(2), one column per input bit
+			using GF2Matrix = std::array<uint32_t,32>;
+
+			constexpr uint32_t multiply(const GF2Matrix& matrix, uint32_t vector) {
+				uint32_t sum = 0;
+				for(size_t i=0; vector != 0; i++, vector >>= 1) {
+					if(vector & 1) {
+						sum ^= matrix[i];
+					}
+				}
+				return sum;
+			}
+
+			constexpr GF2Matrix square(const GF2Matrix& matrix) {
+				GF2Matrix result = {};
+				for(size_t i=0; i<32; i++) {
+					result[i] = multiply(matrix, matrix[i]);
+				}
+				return result;
+			}
+
+			/// Tables that advance a CRC past the given number of zero bytes, one table for each byte of the CRC
+			constexpr std::array<CRCTable,4> makeShiftTables(size_t zeroCount) {
+				// the operator for a single zero bit
+				GF2Matrix bitOperator = {};
+				bitOperator[0] = POLYNOMIAL;
+				for(size_t i=1; i<32; i++) {
+					bitOperator[i] = (uint32_t)1 << (i - 1);
+				}
+				// square it to get the operator for a single zero byte, then compose powers of two bytes
+				GF2Matrix power = square(square(square(bitOperator)));
+				GF2Matrix shift = {};
+				bool hasShift = false;
+				while(zeroCount > 0) {
+					if(zeroCount & 1) {
+						if(hasShift) {
+							GF2Matrix product = {};
+							for(size_t i=0; i<32; i++) {
+								product[i] = multiply(power, shift[i]);
+							}
+							shift = product;
+						} else {
+							shift = power;
+							hasShift = true;
+						}
+					}
+					zeroCount >>= 1;
+					if(zeroCount > 0) {
+						power = square(power);
+					}
+				}
+				std::array<CRCTable,4> tables = {};
+				for(uint32_t byte=0; byte<256; byte++) {
+					for(size_t i=0; i<4; i++) {
+						tables[i][byte] = multiply(shift, byte << (i * 8));
+					}
+				}
+				return tables;
+			}
+
+			constexpr auto LONG_SHIFT_TABLES = makeShiftTables(LONG_STREAM_SIZE);
+			constexpr auto SHORT_SHIFT_TABLES = makeShiftTables(SHORT_STREAM_SIZE);
+
+			inline uint32_t shiftCRC(const std::array<CRCTable,4>& tables, uint32_t crc) {
+				return tables[0][crc & 0xFF] ^ tables[1][(crc >> 8) & 0xFF] ^ tables[2][(crc >> 16) & 0xFF] ^ tables[3][crc >> 24];
+			}
+
+			FGL_CRC32C_TARGET
+			inline uint32_t extendByte(uint32_t crc, uint8_t byte) {
+				#if defined(FGL_CRC32C_X86)
+				return _mm_crc32_u8(crc, byte);
+				#else
+				return __crc32cb(crc, byte);
+				#endif
+			}
+
+			FGL_CRC32C_TARGET
+			inline uint32_t extendWord(uint32_t crc, const uint8_t* bytes) {
+				uint64_t word;
+				std::memcpy(&word, bytes, sizeof(word));
+				#if defined(FGL_CRC32C_X86) && defined(__x86_64__)
+				return (uint32_t)_mm_crc32_u64(crc, word);
+				#elif defined(FGL_CRC32C_X86)
+				return _mm_crc32_u32(_mm_crc32_u32(crc, (uint32_t)word), (uint32_t)(word >> 32));
+				#else
+				return __crc32cd(crc, word);
+				#endif
+			}
+
+			FGL_CRC32C_TARGET
+			uint32_t extendStreams(uint32_t crc, const uint8_t*& bytes, size_t& size, size_t streamSize, const std::array<CRCTable,4>& shiftTables) {
+				while(size >= (streamSize * 3)) {
+					uint32_t crc1 = 0;
+					uint32_t crc2 = 0;
+					const uint8_t* end = bytes + streamSize;
+					do {
+						crc = extendWord(crc, bytes);
+						crc1 = extendWord(crc1, bytes + streamSize);
+						crc2 = extendWord(crc2, bytes + (streamSize * 2));
+						bytes += 8;
+					} while(bytes < end);
+					crc = shiftCRC(shiftTables, crc) ^ crc1;
+					crc = shiftCRC(shiftTables, crc) ^ crc2;
+					bytes += streamSize * 2;
+					size -= streamSize * 3;
+				}
+				return crc;
+			}
+
+			FGL_CRC32C_TARGET
+			uint32_t extendHardware(uint32_t crc, const uint8_t* bytes, size_t size) {
+				while(size > 0 && ((uintptr_t)bytes % 8) != 0) {
+					crc = extendByte(crc, *bytes);
+					bytes++;
+					size--;
+				}
+				crc = extendStreams(crc, bytes, size, LONG_STREAM_SIZE, LONG_SHIFT_TABLES);
+				crc = extendStreams(crc, bytes, size, SHORT_STREAM_SIZE, SHORT_SHIFT_TABLES);
+				while(size >= 8) {
+					crc = extendWord(crc, bytes);
+					bytes += 8;
+					size -= 8;
+				}
+				while(size > 0) {
+					crc = extendByte(crc, *bytes);
+					bytes++;
+					size--;
+				}
+				return crc;
+			}
+			#endif
+
+			#if defined(FGL_CRC32C_X86)
+			bool cpuHasSSE42() {
+				unsigned int eax, ebx, ecx, edx;
+				return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) != 0;
+			}
+			#endif
+
+			using ExtendFunction = uint32_t(*)(uint32_t crc, const uint8_t* bytes, size_t size);
+
+			ExtendFunction selectExtendFunction() {
+				#if defined(FGL_CRC32C_X86)
+				if(cpuHasSSE42()) {
+					return extendHardware;
+				}
+				#elif defined(FGL_CRC32C_ARM)
+				return extendHardware;
+				#endif
+				return extendPortable;
+			}
+		}
+
+
+
+		#pragma mark CRC32C implementation
+
+		CRC32C::CRC32C() noexcept
+		: _crc(0xFFFFFFFF) {
+			//
+		}
+
+		void CRC32C::reset() noexcept {
+			_crc = 0xFFFFFFFF;
+		}
+
+		void CRC32C::update(const void* bytes, size_t size) noexcept {
+			static const ExtendFunction extend = selectExtendFunction();
+			_crc = extend(_crc, (const uint8_t*)bytes, size);
+		}
+
+		CRC32C::Digest CRC32C::finalize() noexcept {
+			uint32_t crc = ~_crc;
+			reset();
+			return crc;
+		}
+
+		bool CRC32C::isHardwareAccelerated() noexcept {
+			#if defined(FGL_CRC32C_X86)
+			static const bool hasSSE42 = cpuHasSSE42();
+			return hasSSE42;
+			#elif defined(FGL_CRC32C_ARM)
+			return true;
+			#else
+			return false;
+			#endif
+		}
+	}
+}
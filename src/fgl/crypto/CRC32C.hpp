@@ -0,0 +1,41 @@
+//
+//  CRC32C.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/crypto/Hasher.hpp>
+
+namespace fgl {
+	namespace crypto {
+		/// Computes the CRC-32C (Castagnoli) checksum used by iSCSI, SCTP, ext4 and many storage formats.
+		/// Uses the CPU's CRC32 instructions when they are available, and table lookups otherwise.
+		class CRC32C: public BasicHasher<CRC32C,uint32_t> {
+		public:
+			static constexpr size_t DIGEST_SIZE = 4;
+
+			using BasicHasher::update;
+			using BasicHasher::hash;
+
+			CRC32C() noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			/// Finishes the checksum of everything passed to update, and resets the hasher so it can be reused
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+			/// Whether the checksum is computed with SSE4.2 on x86, or with the CRC32 extension on ARMv8
+			static bool isHardwareAccelerated() noexcept;
+
+		private:
+			/// The checksum so far, before the final inversion
+			uint32_t _crc;
+		};
+	}
+}
@@ -0,0 +1,27 @@
+//
+//  HMAC.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/crypto/HMAC.hpp>
+
+namespace fgl {
+	namespace crypto {
+		bool constantTimeEquals(const void* left, size_t leftSize, const void* right, size_t rightSize) noexcept {
+			if(leftSize != rightSize) {
+				return false;
+			}
+			// reading through volatile pointers stops the compiler from turning this back into an early exit comparison
+			auto leftBytes = (const volatile uint8_t*)left;
+			auto rightBytes = (const volatile uint8_t*)right;
+			uint8_t difference = 0;
+			for(size_t i=0; i<leftSize; i++) {
+				difference |= leftBytes[i] ^ rightBytes[i];
+			}
+			return difference == 0;
+		}
+	}
+}
@@ -0,0 +1,163 @@
+//
+//  HMAC.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/crypto/Hasher.hpp>
+#include <array>
+#include <concepts>
+#include <cstring>
+
+namespace fgl {
+	namespace crypto {
+		/// A Hasher built on a compression function over fixed size blocks, with a byte array digest, such as MD5, SHA1 and SHA256
+		template<typename HasherType>
+		concept BlockHasher = Hasher<HasherType> && std::copyable<HasherType> && requires(const typename HasherType::Digest& digest) {
+			{ HasherType::BLOCK_SIZE } -> std::convertible_to<size_t>;
+			{ digest.data() } -> std::convertible_to<const uint8_t*>;
+		};
+
+
+		/// Computes an HMAC (RFC 2104) incrementally.
+		/// The hasher states after the inner and outer padded keys are computed once, so copying a keyed HMAC to sign each message doesn't rehash the key.
+		template<BlockHasher HasherType>
+		class HMAC {
+		public:
+			using Digest = typename HasherType::Digest;
+			static constexpr size_t DIGEST_SIZE = HasherType::DIGEST_SIZE;
+			static constexpr size_t BLOCK_SIZE = HasherType::BLOCK_SIZE;
+
+			HMAC(const void* key, size_t keySize) noexcept;
+			explicit HMAC(DataView key) noexcept;
+			explicit HMAC(StringView key) noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			inline void update(DataView bytes) noexcept;
+			inline void update(StringView str) noexcept;
+			/// Finishes the HMAC of everything passed to update, and resets to the keyed state so the next message can be signed
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+			static Digest hash(DataView key, DataView message) noexcept;
+			static Digest hash(StringView key, StringView message) noexcept;
+
+		private:
+			/// The hasher after absorbing the key XOR the inner pad
+			HasherType _innerKeyed;
+			/// The hasher after absorbing the key XOR the outer pad
+			HasherType _outerKeyed;
+			HasherType _inner;
+		};
+
+
+		/// Compares two byte ranges in a time that only depends on their sizes, so a mismatch doesn't reveal how many leading bytes were correct.
+		/// Use this rather than == to check MACs and other secrets.
+		bool constantTimeEquals(const void* left, size_t leftSize, const void* right, size_t rightSize) noexcept;
+		inline bool constantTimeEquals(DataView left, DataView right) noexcept;
+		template<size_t N>
+		inline bool constantTimeEquals(const std::array<uint8_t,N>& left, const std::array<uint8_t,N>& right) noexcept;
+
+
+
+#pragma mark HMAC implementation
+
+		template<BlockHasher HasherType>
+		HMAC<HasherType>::HMAC(const void* key, size_t keySize) noexcept {
+			uint8_t block[BLOCK_SIZE] = {};
+			if(keySize > BLOCK_SIZE) {
+				// keys longer than a block are hashed first
+				auto keyDigest = HasherType::hash(key, keySize);
+				std::memcpy(block, keyDigest.data(), DIGEST_SIZE);
+			} else if(keySize > 0) {
+				std::memcpy(block, key, keySize);
+			}
+			for(size_t i=0; i<BLOCK_SIZE; i++) {
+				block[i] ^= 0x36;
+			}
+			_innerKeyed.update(block, BLOCK_SIZE);
+			for(size_t i=0; i<BLOCK_SIZE; i++) {
+				block[i] ^= (0x36 ^ 0x5c);
+			}
+			_outerKeyed.update(block, BLOCK_SIZE);
+			std::memset(block, 0, BLOCK_SIZE);
+			_inner = _innerKeyed;
+		}
+
+		template<BlockHasher HasherType>
+		HMAC<HasherType>::HMAC(DataView key) noexcept
+		: HMAC(key.data(), key.size()) {
+			//
+		}
+
+		template<BlockHasher HasherType>
+		HMAC<HasherType>::HMAC(StringView key) noexcept
+		: HMAC(key.data(), key.size()) {
+			//
+		}
+
+		template<BlockHasher HasherType>
+		void HMAC<HasherType>::update(const void* bytes, size_t size) noexcept {
+			_inner.update(bytes, size);
+		}
+
+		template<BlockHasher HasherType>
+		void HMAC<HasherType>::update(DataView bytes) noexcept {
+			_inner.update(bytes.data(), bytes.size());
+		}
+
+		template<BlockHasher HasherType>
+		void HMAC<HasherType>::update(StringView str) noexcept {
+			_inner.update(str.data(), str.size());
+		}
+
+		template<BlockHasher HasherType>
+		typename HMAC<HasherType>::Digest HMAC<HasherType>::finalize() noexcept {
+			auto innerDigest = _inner.finalize();
+			HasherType outer = _outerKeyed;
+			outer.update(innerDigest.data(), DIGEST_SIZE);
+			_inner = _innerKeyed;
+			return outer.finalize();
+		}
+
+		template<BlockHasher HasherType>
+		void HMAC<HasherType>::reset() noexcept {
+			_inner = _innerKeyed;
+		}
+
+		template<BlockHasher HasherType>
+		typename HMAC<HasherType>::Digest HMAC<HasherType>::hash(DataView key, DataView message) noexcept {
+			HMAC hmac(key);
+			hmac.update(message);
+			return hmac.finalize();
+		}
+
+		template<BlockHasher HasherType>
+		typename HMAC<HasherType>::Digest HMAC<HasherType>::hash(StringView key, StringView message) noexcept {
+			HMAC hmac(key);
+			hmac.update(message);
+			return hmac.finalize();
+		}
+
+
+
+#pragma mark constantTimeEquals implementation
+
+		bool constantTimeEquals(DataView left, DataView right) noexcept {
+			return constantTimeEquals(left.data(), left.size(), right.data(), right.size());
+		}
+
+		template<size_t N>
+		bool constantTimeEquals(const std::array<uint8_t,N>& left, const std::array<uint8_t,N>& right) noexcept {
+			return constantTimeEquals(left.data(), N, right.data(), N);
+		}
+	}
+}
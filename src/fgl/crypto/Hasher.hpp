@@ -0,0 +1,105 @@
+//
+//  Hasher.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/DataFile.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/String.hpp>
+#include <concepts>
+
+namespace fgl {
+	namespace crypto {
+		/// A streaming hash function. MD5, SHA1, SHA256, CRC32C and XXH3 all satisfy this, so callers can switch algorithms by changing a type.
+		template<typename HasherType>
+		concept Hasher = std::default_initializable<HasherType> && requires(HasherType hasher, const void* bytes, size_t size) {
+			typename HasherType::Digest;
+			{ HasherType::DIGEST_SIZE } -> std::convertible_to<size_t>;
+			hasher.update(bytes, size);
+			{ hasher.finalize() } -> std::same_as<typename HasherType::Digest>;
+			hasher.reset();
+		};
+
+
+		/// Provides the update and hash overloads shared by every hasher, on top of the derived class's update(const void*, size_t).
+		/// Derived classes can declare their own hash(const void*, size_t) when they have a faster path for whole inputs.
+		template<typename Derived, typename DigestType>
+		class BasicHasher {
+		public:
+			using Digest = DigestType;
+
+			inline void update(DataView bytes) noexcept;
+			inline void update(StringView str) noexcept;
+
+			static Digest hash(const void* bytes, size_t size) noexcept;
+			inline static Digest hash(DataView bytes) noexcept;
+			inline static Digest hash(StringView str) noexcept;
+		};
+
+
+		/// The digest of a file, which is mapped into memory rather than read, so it can be larger than the available memory
+		template<Hasher HasherType>
+		typename HasherType::Digest hashFile(const String& path);
+
+
+
+#pragma mark BasicHasher implementation
+
+		template<typename Derived, typename DigestType>
+		void BasicHasher<Derived,DigestType>::update(DataView bytes) noexcept {
+			static_cast<Derived*>(this)->update(bytes.data(), bytes.size());
+		}
+
+		template<typename Derived, typename DigestType>
+		void BasicHasher<Derived,DigestType>::update(StringView str) noexcept {
+			static_cast<Derived*>(this)->update(str.data(), str.size());
+		}
+
+		template<typename Derived, typename DigestType>
+		DigestType BasicHasher<Derived,DigestType>::hash(const void* bytes, size_t size) noexcept {
+			Derived hasher;
+			hasher.update(bytes, size);
+			return hasher.finalize();
+		}
+
+		template<typename Derived, typename DigestType>
+		DigestType BasicHasher<Derived,DigestType>::hash(DataView bytes) noexcept {
+			return Derived::hash(bytes.data(), bytes.size());
+		}
+
+		template<typename Derived, typename DigestType>
+		DigestType BasicHasher<Derived,DigestType>::hash(StringView str) noexcept {
+			return Derived::hash(str.data(), str.size());
+		}
+
+
+
+#pragma mark hashFile implementation
+
+		template<Hasher HasherType>
+		typename HasherType::Digest hashFile(const String& path) {
+			HasherType hasher;
+			if constexpr(sizeof(size_t) >= 8) {
+				auto file = Data::mapFile(path, FileAccess::Sequential);
+				hasher.update(file.data(), file.size());
+			} else {
+				// large files may not fit in a 32-bit address space, so read them in chunks instead
+				DataReader reader(path);
+				while(true) {
+					auto chunk = reader.readChunk();
+					if(chunk.empty()) {
+						break;
+					}
+					hasher.update(chunk.data(), chunk.size());
+				}
+			}
+			return hasher.finalize();
+		}
+	}
+}
@@ -31,375 +31,322 @@ documentation and/or software.
 */
 
 #include <fgl/crypto/MD5.hpp>
-#include <cstdio>
+#include <fgl/data/ByteEncoding.hpp>
+#include <bit>
+#include <cstring>
+#include <utility>
 
 namespace fgl {
-	// a small class for calculating MD5 hashes of strings or byte arrays
-	// it is not meant to be fast or secure
-	//
-	// usage: 1) feed it blocks of uchars with update()
-	//      2) finalize()
-	//      3) get hexdigest() string
-	//      or
-	//      MD5(std::string).hexdigest()
-	//
-	// assumes that char is 8 bit and int is 32 bit
-	class MD5 {
-	public:
-		typedef uint32_t size_type; // must be 32bit
-
-		MD5();
-		MD5(const std::string& text);
-		void update(const unsigned char *buf, size_type length);
-		void update(const char *buf, size_type length);
-		MD5& finalize();
-		std::string hexdigest() const;
-		friend std::ostream& operator<<(std::ostream&, MD5 md5);
-
-	private:
-		void init();
-		typedef unsigned char uint1; //  8bit
-		typedef unsigned int uint4;  // 32bit
-		enum {blocksize = 64}; // VC6 won't eat a const static int here
-
-		void transform(const uint1 block[blocksize]);
-		static void decode(uint4 output[], const uint1 input[], size_type len);
-		static void encode(uint1 output[], const uint4 input[], size_type len);
-
-		bool finalized;
-		uint1 buffer[blocksize]; // bytes that didn't fit in last 64 byte chunk
-		uint4 count[2];   // 64bit counter for number of bits (lo, hi)
-		uint4 state[4];   // digest so far
-		uint1 digest[16]; // the result
-
-		// low level logic operations
-		static inline uint4 F(uint4 x, uint4 y, uint4 z);
-		static inline uint4 G(uint4 x, uint4 y, uint4 z);
-		static inline uint4 H(uint4 x, uint4 y, uint4 z);
-		static inline uint4 I(uint4 x, uint4 y, uint4 z);
-		static inline uint4 rotate_left(uint4 x, int n);
-		static inline void FF(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac);
-		static inline void GG(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac);
-		static inline void HH(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac);
-		static inline void II(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac);
-	};
-
-
-
-	// Constants for MD5Transform routine.
-	#define S11 7
-	#define S12 12
-	#define S13 17
-	#define S14 22
-	#define S21 5
-	#define S22 9
-	#define S23 14
-	#define S24 20
-	#define S31 4
-	#define S32 11
-	#define S33 16
-	#define S34 23
-	#define S41 6
-	#define S42 10
-	#define S43 15
-	#define S44 21
-
-	///////////////////////////////////////////////
-
-	// F, G, H and I are basic MD5 functions.
-	inline MD5::uint4 MD5::F(uint4 x, uint4 y, uint4 z) {
-		return (x & y) | (~x & z);
-	}
-
-	inline MD5::uint4 MD5::G(uint4 x, uint4 y, uint4 z) {
-		return (x & z) | (y & ~z);
-	}
-
-	inline MD5::uint4 MD5::H(uint4 x, uint4 y, uint4 z) {
-		return x^y^z;
-	}
-
-	inline MD5::uint4 MD5::I(uint4 x, uint4 y, uint4 z) {
-		return y ^ (x | ~z);
-	}
-
-	// rotate_left rotates x left n bits.
-	inline MD5::uint4 MD5::rotate_left(uint4 x, int n) {
-		return (x << n) | (x >> (32-n));
-	}
-
-	// FF, GG, HH, and II transformations for rounds 1, 2, 3, and 4.
-	// Rotation is separate from addition to prevent recomputation.
-	inline void MD5::FF(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac) {
-		a = rotate_left(a+ F(b,c,d) + x + ac, s) + b;
-	}
-
-	inline void MD5::GG(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac) {
-		a = rotate_left(a + G(b,c,d) + x + ac, s) + b;
-	}
+	namespace crypto {
+		namespace {
+			constexpr uint32_t INITIAL_STATE[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+
+			// The additive constant for each of the 64 steps, from the sine table in RFC 1321
+			constexpr uint32_t STEP_CONSTANTS[64] = {
+				0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+				0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+				0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+				0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+				0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+				0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+				0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+				0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+			};
+
+			// The left rotation for each step of each round
+			constexpr int STEP_SHIFTS[4][4] = {
+				{ 7, 12, 17, 22 },
+				{ 5, 9, 14, 20 },
+				{ 4, 11, 16, 23 },
+				{ 6, 10, 15, 21 }
+			};
+
+			/// The index of the message word used by each step
+			constexpr size_t messageIndex(size_t step) {
+				switch(step / 16) {
+					case 0:
+						return step;
+					case 1:
+						return ((5 * step) + 1) % 16;
+					case 2:
+						return ((3 * step) + 5) % 16;
+					default:
+						return (7 * step) % 16;
+				}
+			}
 
-	inline void MD5::HH(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac) {
-		a = rotate_left(a + H(b,c,d) + x + ac, s) + b;
-	}
+			/// Rotates left in place, so that vector words aren't returned by value
+			template<int Shift, typename Word>
+			inline void rotateLeft(Word& x) {
+				x = (x << Shift) | (x >> (32 - Shift));
+			}
 
-	inline void MD5::II(uint4 &a, uint4 b, uint4 c, uint4 d, uint4 x, uint4 s, uint4 ac) {
-		a = rotate_left(a + I(b,c,d) + x + ac, s) + b;
-	}
+			/// One of the 64 MD5 steps. Word is uint32_t, or a vector of them to hash several messages at once.
+			/// F, G, H and I use the forms with the fewest operations, which give the same results as the ones in RFC 1321.
+			template<size_t Step, typename Word>
+			inline void md5Step(Word state[4], const Word words[16]) {
+				// the roles of a, b, c and d rotate by one state word each step
+				Word& a = state[(4 - (Step % 4)) % 4];
+				Word b = state[(5 - (Step % 4)) % 4];
+				Word c = state[(6 - (Step % 4)) % 4];
+				Word d = state[(7 - (Step % 4)) % 4];
+				Word f;
+				if constexpr(Step < 16) {
+					f = d ^ (b & (c ^ d));
+				} else if constexpr(Step < 32) {
+					f = c ^ (d & (b ^ c));
+				} else if constexpr(Step < 48) {
+					f = b ^ c ^ d;
+				} else {
+					f = c ^ (b | ~d);
+				}
+				Word sum = a + f + words[messageIndex(Step)] + STEP_CONSTANTS[Step];
+				rotateLeft<STEP_SHIFTS[Step / 16][Step % 4]>(sum);
+				a = sum + b;
+			}
 
-	//////////////////////////////////////////////
+			/// Runs all 64 steps on one block, unrolled, and adds the result to the state
+			template<typename Word, size_t... Steps>
+			inline void md5Rounds(Word state[4], const Word words[16], std::index_sequence<Steps...>) {
+				Word initial[4] = { state[0], state[1], state[2], state[3] };
+				(md5Step<Steps>(state, words), ...);
+				for(size_t i=0; i<4; i++) {
+					state[i] += initial[i];
+				}
+			}
 
-	// default ctor, just initailize
-	MD5::MD5() {
-		init();
-	}
+			inline uint32_t loadLittleEndian(const uint8_t* bytes) {
+				if constexpr(std::endian::native == std::endian::little) {
+					uint32_t word;
+					std::memcpy(&word, bytes, sizeof(word));
+					return word;
+				} else {
+					return ((uint32_t)bytes[0]) | (((uint32_t)bytes[1]) << 8) | (((uint32_t)bytes[2]) << 16) | (((uint32_t)bytes[3]) << 24);
+				}
+			}
 
-	//////////////////////////////////////////////
+			// encodes words into little endian output. Assumes size is a multiple of 4.
+			void encode(uint8_t output[], const uint32_t input[], size_t size) {
+				for(size_t i = 0, j = 0; j < size; i++, j += 4) {
+					output[j] = input[i] & 0xff;
+					output[j+1] = (input[i] >> 8) & 0xff;
+					output[j+2] = (input[i] >> 16) & 0xff;
+					output[j+3] = (input[i] >> 24) & 0xff;
+				}
+			}
 
-	// nifty shortcut ctor, compute MD5 for string and finalize it right away
-	MD5::MD5(const std::string &text) {
-		init();
-		update(text.c_str(), (size_type)text.length());
-		finalize();
-	}
+			/// Writes the last partial block of a message followed by its padding and bit length, and returns the number of blocks written (1 or 2)
+			size_t padFinalBlocks(const uint8_t* remainder, size_t remainderSize, uint64_t length, uint8_t output[MD5::BLOCK_SIZE * 2]) {
+				size_t blockCount = (remainderSize < 56) ? 1 : 2;
+				size_t size = blockCount * MD5::BLOCK_SIZE;
+				std::memcpy(output, remainder, remainderSize);
+				output[remainderSize] = 0x80;
+				std::memset(output + remainderSize + 1, 0, size - remainderSize - 9);
+				uint32_t bitLength[2] = { (uint32_t)(length << 3), (uint32_t)(length >> 29) };
+				encode(output + size - 8, bitLength, 8);
+				return blockCount;
+			}
 
-	//////////////////////////////
+			#if defined(__GNUC__) || defined(__clang__)
+			#define FGL_MD5_MULTI_BUFFER
+			// 8 messages hashed side by side, one per lane. This is a single register with AVX2, and a pair of registers with SSE2 or NEON
+			constexpr size_t LANE_COUNT = 8;
+			typedef uint32_t MD5Lanes __attribute__((vector_size(LANE_COUNT * sizeof(uint32_t))));
+
+			/// Fills word with the word at the given offset of each lane's block.
+			/// It's an out parameter because returning a vector wider than the enabled SIMD registers changes the ABI (-Wpsabi).
+			template<size_t... Lanes>
+			inline void gatherWord(MD5Lanes& word, const uint8_t* const blocks[LANE_COUNT], size_t offset, std::index_sequence<Lanes...>) {
+				word = MD5Lanes{ loadLittleEndian(blocks[Lanes] + offset)... };
+			}
 
-	void MD5::init() {
-		finalized=false;
+			struct MD5Lane {
+				const uint8_t* blocks;
+				size_t blockCount;
+				uint8_t finalBlocks[MD5::BLOCK_SIZE * 2];
+				size_t finalBlockCount;
+				size_t finalBlockIndex;
+				size_t inputIndex;
+				bool active;
+
+				void start(StringView input, size_t index) {
+					size_t remainderSize = input.size() % MD5::BLOCK_SIZE;
+					blocks = (const uint8_t*)input.data();
+					blockCount = input.size() / MD5::BLOCK_SIZE;
+					finalBlockCount = padFinalBlocks(blocks + (blockCount * MD5::BLOCK_SIZE), remainderSize, input.size(), finalBlocks);
+					finalBlockIndex = 0;
+					inputIndex = index;
+					active = true;
+				}
+
+				/// Returns the next block to hash, and whether it is the last block of the message
+				const uint8_t* nextBlock(bool& last) {
+					if(blockCount > 0) {
+						auto block = blocks;
+						blocks += MD5::BLOCK_SIZE;
+						blockCount--;
+						last = false;
+						return block;
+					}
+					auto block = finalBlocks + (finalBlockIndex * MD5::BLOCK_SIZE);
+					finalBlockIndex++;
+					last = (finalBlockIndex == finalBlockCount);
+					return block;
+				}
+			};
+			#endif
+		}
 
-		count[0] = 0;
-		count[1] = 0;
 
-		// load magic initialization constants.
-		state[0] = 0x67452301;
-		state[1] = 0xefcdab89;
-		state[2] = 0x98badcfe;
-		state[3] = 0x10325476;
-	}
 
-	//////////////////////////////
+		#pragma mark MD5 implementation
 
-	// decodes input (unsigned char) into output (uint4). Assumes len is a multiple of 4.
-	void MD5::decode(uint4 output[], const uint1 input[], size_type len) {
-		for (unsigned int i = 0, j = 0; j < len; i++, j += 4) {
-			output[i] = ((uint4)input[j]) | (((uint4)input[j+1]) << 8) |
-				(((uint4)input[j+2]) << 16) | (((uint4)input[j+3]) << 24);
+		MD5::MD5() noexcept {
+			reset();
 		}
-	}
-
-	//////////////////////////////
 
-	// encodes input (uint4) into output (unsigned char). Assumes len is
-	// a multiple of 4.
-	void MD5::encode(uint1 output[], const uint4 input[], size_type len) {
-		for (size_type i = 0, j = 0; j < len; i++, j += 4) {
-			output[j] = input[i] & 0xff;
-			output[j+1] = (input[i] >> 8) & 0xff;
-			output[j+2] = (input[i] >> 16) & 0xff;
-			output[j+3] = (input[i] >> 24) & 0xff;
+		void MD5::reset() noexcept {
+			_length = 0;
+			std::memcpy(_state, INITIAL_STATE, sizeof(_state));
 		}
-	}
-
-	//////////////////////////////
-
-	// apply MD5 algo on a block
-	void MD5::transform(const uint1 block[blocksize]) {
-		uint4 a = state[0], b = state[1], c = state[2], d = state[3], x[16];
-		decode (x, block, blocksize);
 
-		/* Round 1 */
-		FF (a, b, c, d, x[ 0], S11, 0xd76aa478); /* 1 */
-		FF (d, a, b, c, x[ 1], S12, 0xe8c7b756); /* 2 */
-		FF (c, d, a, b, x[ 2], S13, 0x242070db); /* 3 */
-		FF (b, c, d, a, x[ 3], S14, 0xc1bdceee); /* 4 */
-		FF (a, b, c, d, x[ 4], S11, 0xf57c0faf); /* 5 */
-		FF (d, a, b, c, x[ 5], S12, 0x4787c62a); /* 6 */
-		FF (c, d, a, b, x[ 6], S13, 0xa8304613); /* 7 */
-		FF (b, c, d, a, x[ 7], S14, 0xfd469501); /* 8 */
-		FF (a, b, c, d, x[ 8], S11, 0x698098d8); /* 9 */
-		FF (d, a, b, c, x[ 9], S12, 0x8b44f7af); /* 10 */
-		FF (c, d, a, b, x[10], S13, 0xffff5bb1); /* 11 */
-		FF (b, c, d, a, x[11], S14, 0x895cd7be); /* 12 */
-		FF (a, b, c, d, x[12], S11, 0x6b901122); /* 13 */
-		FF (d, a, b, c, x[13], S12, 0xfd987193); /* 14 */
-		FF (c, d, a, b, x[14], S13, 0xa679438e); /* 15 */
-		FF (b, c, d, a, x[15], S14, 0x49b40821); /* 16 */
-
-		/* Round 2 */
-		GG (a, b, c, d, x[ 1], S21, 0xf61e2562); /* 17 */
-		GG (d, a, b, c, x[ 6], S22, 0xc040b340); /* 18 */
-		GG (c, d, a, b, x[11], S23, 0x265e5a51); /* 19 */
-		GG (b, c, d, a, x[ 0], S24, 0xe9b6c7aa); /* 20 */
-		GG (a, b, c, d, x[ 5], S21, 0xd62f105d); /* 21 */
-		GG (d, a, b, c, x[10], S22,  0x2441453); /* 22 */
-		GG (c, d, a, b, x[15], S23, 0xd8a1e681); /* 23 */
-		GG (b, c, d, a, x[ 4], S24, 0xe7d3fbc8); /* 24 */
-		GG (a, b, c, d, x[ 9], S21, 0x21e1cde6); /* 25 */
-		GG (d, a, b, c, x[14], S22, 0xc33707d6); /* 26 */
-		GG (c, d, a, b, x[ 3], S23, 0xf4d50d87); /* 27 */
-		GG (b, c, d, a, x[ 8], S24, 0x455a14ed); /* 28 */
-		GG (a, b, c, d, x[13], S21, 0xa9e3e905); /* 29 */
-		GG (d, a, b, c, x[ 2], S22, 0xfcefa3f8); /* 30 */
-		GG (c, d, a, b, x[ 7], S23, 0x676f02d9); /* 31 */
-		GG (b, c, d, a, x[12], S24, 0x8d2a4c8a); /* 32 */
-
-		/* Round 3 */
-		HH (a, b, c, d, x[ 5], S31, 0xfffa3942); /* 33 */
-		HH (d, a, b, c, x[ 8], S32, 0x8771f681); /* 34 */
-		HH (c, d, a, b, x[11], S33, 0x6d9d6122); /* 35 */
-		HH (b, c, d, a, x[14], S34, 0xfde5380c); /* 36 */
-		HH (a, b, c, d, x[ 1], S31, 0xa4beea44); /* 37 */
-		HH (d, a, b, c, x[ 4], S32, 0x4bdecfa9); /* 38 */
-		HH (c, d, a, b, x[ 7], S33, 0xf6bb4b60); /* 39 */
-		HH (b, c, d, a, x[10], S34, 0xbebfbc70); /* 40 */
-		HH (a, b, c, d, x[13], S31, 0x289b7ec6); /* 41 */
-		HH (d, a, b, c, x[ 0], S32, 0xeaa127fa); /* 42 */
-		HH (c, d, a, b, x[ 3], S33, 0xd4ef3085); /* 43 */
-		HH (b, c, d, a, x[ 6], S34,  0x4881d05); /* 44 */
-		HH (a, b, c, d, x[ 9], S31, 0xd9d4d039); /* 45 */
-		HH (d, a, b, c, x[12], S32, 0xe6db99e5); /* 46 */
-		HH (c, d, a, b, x[15], S33, 0x1fa27cf8); /* 47 */
-		HH (b, c, d, a, x[ 2], S34, 0xc4ac5665); /* 48 */
-
-		/* Round 4 */
-		II (a, b, c, d, x[ 0], S41, 0xf4292244); /* 49 */
-		II (d, a, b, c, x[ 7], S42, 0x432aff97); /* 50 */
-		II (c, d, a, b, x[14], S43, 0xab9423a7); /* 51 */
-		II (b, c, d, a, x[ 5], S44, 0xfc93a039); /* 52 */
-		II (a, b, c, d, x[12], S41, 0x655b59c3); /* 53 */
-		II (d, a, b, c, x[ 3], S42, 0x8f0ccc92); /* 54 */
-		II (c, d, a, b, x[10], S43, 0xffeff47d); /* 55 */
-		II (b, c, d, a, x[ 1], S44, 0x85845dd1); /* 56 */
-		II (a, b, c, d, x[ 8], S41, 0x6fa87e4f); /* 57 */
-		II (d, a, b, c, x[15], S42, 0xfe2ce6e0); /* 58 */
-		II (c, d, a, b, x[ 6], S43, 0xa3014314); /* 59 */
-		II (b, c, d, a, x[13], S44, 0x4e0811a1); /* 60 */
-		II (a, b, c, d, x[ 4], S41, 0xf7537e82); /* 61 */
-		II (d, a, b, c, x[11], S42, 0xbd3af235); /* 62 */
-		II (c, d, a, b, x[ 2], S43, 0x2ad7d2bb); /* 63 */
-		II (b, c, d, a, x[ 9], S44, 0xeb86d391); /* 64 */
-
-		state[0] += a;
-		state[1] += b;
-		state[2] += c;
-		state[3] += d;
-
-		// Zeroize sensitive information.
-		memset(x, 0, sizeof x);
-	}
-
-	//////////////////////////////
-
-	// MD5 block update operation. Continues an MD5 message-digest
-	// operation, processing another message block
-	void MD5::update(const unsigned char input[], size_type length) {
-		// compute number of bytes mod 64
-		size_type index = count[0] / 8 % blocksize;
-
-		// Update number of bits
-		if ((count[0] += (length << 3)) < (length << 3)) {
-			count[1]++;
+		void MD5::transform(const uint8_t* block) noexcept {
+			uint32_t words[16];
+			for(size_t i=0; i<16; i++) {
+				words[i] = loadLittleEndian(block + (i * 4));
+			}
+			md5Rounds(_state, words, std::make_index_sequence<64>());
 		}
-		count[1] += (length >> 29);
-
-		// number of bytes we need to fill in buffer
-		size_type firstpart = 64 - index;
 
-		size_type i;
-
-		// transform as many times as possible.
-		if (length >= firstpart) {
-			// fill buffer first, transform
-			memcpy(&buffer[index], input, firstpart);
-			transform(buffer);
-
-			// transform chunks of blocksize (64 bytes)
-			for (i = firstpart; i + blocksize <= length; i += blocksize) {
-				transform(&input[i]);
+		void MD5::update(const void* bytes, size_t size) noexcept {
+			auto input = (const uint8_t*)bytes;
+			size_t bufferedSize = (size_t)(_length % BLOCK_SIZE);
+			_length += size;
+			// complete a partially filled block first
+			if(bufferedSize > 0) {
+				size_t count = std::min(size, BLOCK_SIZE - bufferedSize);
+				std::memcpy(_buffer + bufferedSize, input, count);
+				input += count;
+				size -= count;
+				if((bufferedSize + count) < BLOCK_SIZE) {
+					return;
+				}
+				transform(_buffer);
+			}
+			// transform whole blocks straight from the input
+			while(size >= BLOCK_SIZE) {
+				transform(input);
+				input += BLOCK_SIZE;
+				size -= BLOCK_SIZE;
+			}
+			if(size > 0) {
+				std::memcpy(_buffer, input, size);
 			}
-
-			index = 0;
-		}
-		else {
-			i = 0;
 		}
 
-		// buffer remaining input
-		memcpy(&buffer[index], &input[i], length-i);
-	}
-
-	//////////////////////////////
-
-	// for convenience provide a verson with signed char
-	void MD5::update(const char input[], size_type length) {
-		update((const unsigned char*)input, length);
-	}
-
-	//////////////////////////////
-
-	// MD5 finalization. Ends an MD5 message-digest operation, writing the
-	// the message digest and zeroizing the context.
-	MD5& MD5::finalize() {
-		static unsigned char padding[64] = {
-			0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-		};
-
-		if (!finalized) {
-			// Save number of bits
-			unsigned char bits[8];
-			encode(bits, count, 8);
-
-			// pad out to 56 mod 64.
-			size_type index = count[0] / 8 % 64;
-			size_type padLen = (index < 56) ? (56 - index) : (120 - index);
-			update(padding, padLen);
-
-			// Append length (before padding)
-			update(bits, 8);
-
-			// Store state in digest
-			encode(digest, state, 16);
-
-			// Zeroize sensitive information.
-			memset(buffer, 0, sizeof buffer);
-			memset(count, 0, sizeof count);
-
-			finalized=true;
+		MD5::Digest MD5::finalize() noexcept {
+			uint8_t finalBlocks[BLOCK_SIZE * 2];
+			size_t finalBlockCount = padFinalBlocks(_buffer, (size_t)(_length % BLOCK_SIZE), _length, finalBlocks);
+			for(size_t i=0; i<finalBlockCount; i++) {
+				transform(finalBlocks + (i * BLOCK_SIZE));
+			}
+			Digest digest;
+			encode(digest.data(), _state, DIGEST_SIZE);
+			// zeroize sensitive information
+			std::memset(_buffer, 0, sizeof(_buffer));
+			std::memset(finalBlocks, 0, sizeof(finalBlocks));
+			reset();
+			return digest;
 		}
 
-		return *this;
+		void MD5::hashMany(std::span<const StringView> inputs, Digest* outputs) noexcept {
+			#ifdef FGL_MD5_MULTI_BUFFER
+			MD5Lane lanes[LANE_COUNT];
+			MD5Lanes initialState[4];
+			for(size_t i=0; i<4; i++) {
+				initialState[i] = MD5Lanes{} + INITIAL_STATE[i];
+			}
+			MD5Lanes state[4] = { initialState[0], initialState[1], initialState[2], initialState[3] };
+			size_t nextInput = 0;
+			size_t activeCount = 0;
+			for(size_t lane=0; lane<LANE_COUNT; lane++) {
+				if(nextInput < inputs.size()) {
+					lanes[lane].start(inputs[nextInput], nextInput);
+					nextInput++;
+					activeCount++;
+				} else {
+					lanes[lane].active = false;
+				}
+			}
+			// idle lanes hash this block, and their results are ignored
+			static const uint8_t idleBlock[BLOCK_SIZE] = {};
+			while(activeCount > 0) {
+				const uint8_t* blocks[LANE_COUNT];
+				uint32_t finished[LANE_COUNT];
+				bool anyFinished = false;
+				for(size_t lane=0; lane<LANE_COUNT; lane++) {
+					bool last = false;
+					blocks[lane] = lanes[lane].active ? lanes[lane].nextBlock(last) : idleBlock;
+					finished[lane] = last ? 0xFFFFFFFF : 0;
+					anyFinished = anyFinished || last;
+				}
+				MD5Lanes words[16];
+				for(size_t i=0; i<16; i++) {
+					gatherWord(words[i], blocks, i * 4, std::make_index_sequence<LANE_COUNT>());
+				}
+				md5Rounds(state, words, std::make_index_sequence<64>());
+				if(!anyFinished) {
+					continue;
+				}
+				uint32_t laneStates[4][LANE_COUNT];
+				std::memcpy(laneStates, state, sizeof(laneStates));
+				for(size_t lane=0; lane<LANE_COUNT; lane++) {
+					if(finished[lane] == 0) {
+						continue;
+					}
+					uint32_t laneState[4] = { laneStates[0][lane], laneStates[1][lane], laneStates[2][lane], laneStates[3][lane] };
+					encode(outputs[lanes[lane].inputIndex].data(), laneState, DIGEST_SIZE);
+					// refill the lane with the next message
+					if(nextInput < inputs.size()) {
+						lanes[lane].start(inputs[nextInput], nextInput);
+						nextInput++;
+					} else {
+						lanes[lane].active = false;
+						activeCount--;
+					}
+				}
+				// reset the state of the finished lanes without moving the state out of registers
+				MD5Lanes resetMask;
+				std::memcpy(&resetMask, finished, sizeof(resetMask));
+				for(size_t i=0; i<4; i++) {
+					state[i] = (state[i] & ~resetMask) | (initialState[i] & resetMask);
+				}
+			}
+			#else
+			for(size_t i=0; i<inputs.size(); i++) {
+				outputs[i] = hash(inputs[i]);
+			}
+			#endif
+		}
 	}
 
-	//////////////////////////////
-
-	// return hex representation of digest as string
-	std::string MD5::hexdigest() const {
-		if (!finalized) {
-			return "";
-		}
 
-		char buf[33];
-		for (int i=0; i<16; i++)
-		sprintf(buf+i*2, "%02x", digest[i]);
-		buf[32]=0;
 
-		return std::string(buf);
+	String md5(const std::string& str) {
+		auto digest = crypto::MD5::hash(str.data(), str.size());
+		String hex(Hex::encodedSize(digest.size()), '\0');
+		Hex::encode(digest.data(), digest.size(), hex.data());
+		return hex;
 	}
 
-	//////////////////////////////
-
-	std::ostream& operator<<(std::ostream& out, MD5 md5)
-	{
-	return out << md5.hexdigest();
+	crypto::MD5::Digest md5File(const String& path) {
+		return crypto::hashFile<crypto::MD5>(path);
 	}
 
-	//////////////////////////////
-
-
-	String md5(const std::string& str) {
-		MD5 md5 = MD5(str);
-		return md5.hexdigest();
+	ArrayList<crypto::MD5::Digest> md5Many(std::span<const StringView> inputs) {
+		ArrayList<crypto::MD5::Digest> digests;
+		digests.resize(inputs.size());
+		crypto::MD5::hashMany(inputs, digests.data());
+		return digests;
 	}
 }
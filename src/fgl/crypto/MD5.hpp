@@ -33,8 +33,51 @@ documentation and/or software.
 #pragma once
 
 #include <fgl/data/Common.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/DataView.hpp>
 #include <fgl/data/String.hpp>
+#include <fgl/crypto/Hasher.hpp>
+#include <array>
+#include <span>
  
 namespace fgl {
+	namespace crypto {
+		/// Computes an MD5 digest incrementally, so input can be hashed as it arrives instead of being held in memory.
+		/// MD5 is broken for security purposes. Use it for checksums and cache keys only.
+		class MD5: public BasicHasher<MD5,std::array<uint8_t,16>> {
+		public:
+			static constexpr size_t DIGEST_SIZE = 16;
+			static constexpr size_t BLOCK_SIZE = 64;
+
+			using BasicHasher::update;
+			using BasicHasher::hash;
+
+			MD5() noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			/// Finishes the digest of everything passed to update, and resets the hasher so it can be reused
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+			/// Hashes many independent messages, writing inputs.size() digests to outputs.
+			/// Messages are interleaved across SIMD lanes, which is much faster than hashing them one at a time when they are short.
+			static void hashMany(std::span<const StringView> inputs, Digest* outputs) noexcept;
+
+		private:
+			void transform(const uint8_t* block) noexcept;
+
+			uint32_t _state[4];
+			uint8_t _buffer[BLOCK_SIZE];
+			/// The total number of bytes passed to update
+			uint64_t _length;
+		};
+	}
+
+	/// The lowercase hex MD5 digest of a string
 	String md5(const std::string& str);
+	/// The MD5 digest of a file, which is mapped into memory rather than read, so it can be larger than the available memory
+	crypto::MD5::Digest md5File(const String& path);
+	/// The MD5 digests of many strings, in the same order
+	ArrayList<crypto::MD5::Digest> md5Many(std::span<const StringView> inputs);
 }
@@ -0,0 +1,162 @@
+//
+//  SHA1.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/crypto/SHA1.hpp>
+#include <fgl/data/ByteEncoding.hpp>
+#include <fgl/data/ByteStream.hpp>
+#include <cstring>
+#include <utility>
+
+namespace fgl {
+	namespace crypto {
+		namespace {
+			constexpr uint32_t INITIAL_STATE[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+			inline uint32_t loadBigEndian(const uint8_t* bytes) {
+				uint32_t word;
+				std::memcpy(&word, bytes, sizeof(word));
+				if constexpr(std::endian::native == std::endian::little) {
+					word = byteSwap(word);
+				}
+				return word;
+			}
+
+			inline void storeBigEndian(uint8_t* bytes, uint64_t value) {
+				if constexpr(std::endian::native == std::endian::little) {
+					value = byteSwap(value);
+				}
+				std::memcpy(bytes, &value, sizeof(value));
+			}
+
+			inline uint32_t rotateLeft(uint32_t x, int n) {
+				return (x << n) | (x >> (32 - n));
+			}
+
+			/// One of the 80 rounds. Instead of shifting all 5 working variables each round, the roles of the state words rotate.
+			/// The message schedule is kept as a rolling window of 16 words, each one replaced just before it is needed.
+			template<size_t Round>
+			inline void sha1Round(uint32_t state[5], uint32_t schedule[16]) {
+				uint32_t a = state[(80 - Round) % 5];
+				uint32_t& b = state[(81 - Round) % 5];
+				uint32_t c = state[(82 - Round) % 5];
+				uint32_t d = state[(83 - Round) % 5];
+				uint32_t& e = state[(84 - Round) % 5];
+				if constexpr(Round >= 16) {
+					schedule[Round % 16] = rotateLeft(schedule[(Round + 13) % 16] ^ schedule[(Round + 8) % 16] ^ schedule[(Round + 2) % 16] ^ schedule[Round % 16], 1);
+				}
+				uint32_t f;
+				uint32_t k;
+				if constexpr(Round < 20) {
+					f = d ^ (b & (c ^ d));
+					k = 0x5a827999;
+				} else if constexpr(Round < 40) {
+					f = b ^ c ^ d;
+					k = 0x6ed9eba1;
+				} else if constexpr(Round < 60) {
+					f = (b & c) | (d & (b | c));
+					k = 0x8f1bbcdc;
+				} else {
+					f = b ^ c ^ d;
+					k = 0xca62c1d6;
+				}
+				e += rotateLeft(a, 5) + f + k + schedule[Round % 16];
+				b = rotateLeft(b, 30);
+			}
+
+			template<size_t... Rounds>
+			inline void sha1Rounds(uint32_t state[5], uint32_t schedule[16], std::index_sequence<Rounds...>) {
+				(sha1Round<Rounds>(state, schedule), ...);
+			}
+
+			void compress(uint32_t state[5], const uint8_t* blocks, size_t blockCount) {
+				for(size_t block=0; block<blockCount; block++) {
+					const uint8_t* input = blocks + (block * SHA1::BLOCK_SIZE);
+					uint32_t schedule[16];
+					for(size_t i=0; i<16; i++) {
+						schedule[i] = loadBigEndian(input + (i * 4));
+					}
+					uint32_t working[5] = { state[0], state[1], state[2], state[3], state[4] };
+					sha1Rounds(working, schedule, std::make_index_sequence<80>());
+					for(size_t i=0; i<5; i++) {
+						state[i] += working[i];
+					}
+				}
+			}
+		}
+
+
+
+		#pragma mark SHA1 implementation
+
+		SHA1::SHA1() noexcept {
+			reset();
+		}
+
+		void SHA1::reset() noexcept {
+			_length = 0;
+			std::memcpy(_state, INITIAL_STATE, sizeof(_state));
+		}
+
+		void SHA1::update(const void* bytes, size_t size) noexcept {
+			auto input = (const uint8_t*)bytes;
+			size_t bufferedSize = (size_t)(_length % BLOCK_SIZE);
+			_length += size;
+			// complete a partially filled block first
+			if(bufferedSize > 0) {
+				size_t count = std::min(size, BLOCK_SIZE - bufferedSize);
+				std::memcpy(_buffer + bufferedSize, input, count);
+				input += count;
+				size -= count;
+				if((bufferedSize + count) < BLOCK_SIZE) {
+					return;
+				}
+				compress(_state, _buffer, 1);
+			}
+			// compress whole blocks straight from the input
+			size_t blockCount = size / BLOCK_SIZE;
+			if(blockCount > 0) {
+				compress(_state, input, blockCount);
+				input += blockCount * BLOCK_SIZE;
+				size -= blockCount * BLOCK_SIZE;
+			}
+			if(size > 0) {
+				std::memcpy(_buffer, input, size);
+			}
+		}
+
+		SHA1::Digest SHA1::finalize() noexcept {
+			size_t bufferedSize = (size_t)(_length % BLOCK_SIZE);
+			uint8_t finalBlocks[BLOCK_SIZE * 2] = {};
+			std::memcpy(finalBlocks, _buffer, bufferedSize);
+			finalBlocks[bufferedSize] = 0x80;
+			size_t finalBlockCount = (bufferedSize < 56) ? 1 : 2;
+			storeBigEndian(finalBlocks + (finalBlockCount * BLOCK_SIZE) - 8, _length << 3);
+			compress(_state, finalBlocks, finalBlockCount);
+			Digest digest;
+			for(size_t i=0; i<5; i++) {
+				uint32_t word = _state[i];
+				if constexpr(std::endian::native == std::endian::little) {
+					word = byteSwap(word);
+				}
+				std::memcpy(digest.data() + (i * 4), &word, sizeof(word));
+			}
+			std::memset(_buffer, 0, sizeof(_buffer));
+			reset();
+			return digest;
+		}
+	}
+
+
+
+	String sha1(const std::string& str) {
+		auto digest = crypto::SHA1::hash(str.data(), str.size());
+		String hex(Hex::encodedSize(digest.size()), '\0');
+		Hex::encode(digest.data(), digest.size(), hex.data());
+		return hex;
+	}
+}
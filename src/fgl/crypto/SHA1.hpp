@@ -0,0 +1,46 @@
+//
+//  SHA1.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/crypto/Hasher.hpp>
+#include <array>
+
+namespace fgl {
+	namespace crypto {
+		/// Computes a SHA-1 digest incrementally.
+		/// SHA-1 is broken for security purposes. Use it only to interoperate with formats and protocols that require it.
+		class SHA1: public BasicHasher<SHA1,std::array<uint8_t,20>> {
+		public:
+			static constexpr size_t DIGEST_SIZE = 20;
+			static constexpr size_t BLOCK_SIZE = 64;
+
+			using BasicHasher::update;
+			using BasicHasher::hash;
+
+			SHA1() noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			/// Finishes the digest of everything passed to update, and resets the hasher so it can be reused
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+		private:
+			uint32_t _state[5];
+			uint8_t _buffer[BLOCK_SIZE];
+			/// The total number of bytes passed to update
+			uint64_t _length;
+		};
+	}
+
+	/// The lowercase hex SHA-1 digest of a string
+	String sha1(const std::string& str);
+}
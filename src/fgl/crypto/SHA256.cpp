@@ -0,0 +1,290 @@
+//
+//  SHA256.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/crypto/SHA256.hpp>
+#include <fgl/data/ByteEncoding.hpp>
+#include <fgl/data/ByteStream.hpp>
+#include <cstring>
+#include <utility>
+
+#if !defined(FGL_SHA_DISABLE_HARDWARE) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+	// SHA-NI is detected at runtime, since most builds don't target CPUs that are guaranteed to have it
+	#define FGL_SHA256_X86
+	#include <cpuid.h>
+	#include <immintrin.h>
+#elif !defined(FGL_SHA_DISABLE_HARDWARE) && defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+	// every arm64 Apple device has the cryptography extension, and Android builds can opt in with -march=armv8-a+crypto
+	#define FGL_SHA256_ARM
+	#include <arm_neon.h>
+#endif
+
+namespace fgl {
+	namespace crypto {
+		namespace {
+			constexpr uint32_t INITIAL_STATE[8] = {
+				0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+			};
+
+			alignas(16) constexpr uint32_t ROUND_CONSTANTS[64] = {
+				0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+				0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+				0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+				0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+				0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+				0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+				0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+				0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+			};
+
+			inline uint32_t loadBigEndian(const uint8_t* bytes) {
+				uint32_t word;
+				std::memcpy(&word, bytes, sizeof(word));
+				if constexpr(std::endian::native == std::endian::little) {
+					word = byteSwap(word);
+				}
+				return word;
+			}
+
+			inline void storeBigEndian(uint8_t* bytes, uint64_t value) {
+				if constexpr(std::endian::native == std::endian::little) {
+					value = byteSwap(value);
+				}
+				std::memcpy(bytes, &value, sizeof(value));
+			}
+
+			inline uint32_t rotateRight(uint32_t x, int n) {
+				return (x >> n) | (x << (32 - n));
+			}
+
+			/// One of the 64 rounds. Instead of shifting all 8 working variables each round, the roles of the state words rotate.
+			/// The message schedule is kept as a rolling window of 16 words, each one replaced just before it is needed.
+			template<size_t Round>
+			inline void sha256Round(uint32_t state[8], uint32_t schedule[16]) {
+				uint32_t a = state[(64 - Round) % 8];
+				uint32_t b = state[(65 - Round) % 8];
+				uint32_t c = state[(66 - Round) % 8];
+				uint32_t& d = state[(67 - Round) % 8];
+				uint32_t e = state[(68 - Round) % 8];
+				uint32_t f = state[(69 - Round) % 8];
+				uint32_t g = state[(70 - Round) % 8];
+				uint32_t& h = state[(71 - Round) % 8];
+				if constexpr(Round >= 16) {
+					uint32_t w15 = schedule[(Round + 1) % 16];
+					uint32_t w2 = schedule[(Round + 14) % 16];
+					uint32_t s0 = rotateRight(w15, 7) ^ rotateRight(w15, 18) ^ (w15 >> 3);
+					uint32_t s1 = rotateRight(w2, 17) ^ rotateRight(w2, 19) ^ (w2 >> 10);
+					schedule[Round % 16] += s0 + schedule[(Round + 9) % 16] + s1;
+				}
+				uint32_t t1 = h + (rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25)) + (g ^ (e & (f ^ g))) + ROUND_CONSTANTS[Round] + schedule[Round % 16];
+				uint32_t t2 = (rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22)) + ((a & b) | (c & (a | b)));
+				d += t1;
+				h = t1 + t2;
+			}
+
+			template<size_t... Rounds>
+			inline void sha256Rounds(uint32_t state[8], uint32_t schedule[16], std::index_sequence<Rounds...>) {
+				(sha256Round<Rounds>(state, schedule), ...);
+			}
+
+			void compressPortable(uint32_t state[8], const uint8_t* blocks, size_t blockCount) {
+				for(size_t block=0; block<blockCount; block++) {
+					const uint8_t* input = blocks + (block * SHA256::BLOCK_SIZE);
+					uint32_t schedule[16];
+					for(size_t i=0; i<16; i++) {
+						schedule[i] = loadBigEndian(input + (i * 4));
+					}
+					uint32_t working[8] = { state[0], state[1], state[2], state[3], state[4], state[5], state[6], state[7] };
+					sha256Rounds(working, schedule, std::make_index_sequence<64>());
+					for(size_t i=0; i<8; i++) {
+						state[i] += working[i];
+					}
+				}
+			}
+
+			#if defined(FGL_SHA256_X86)
+			bool cpuHasSHA() {
+				unsigned int eax, ebx, ecx, edx;
+				if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_SSE4_1) == 0) {
+					return false;
+				}
+				if(__get_cpuid_max(0, nullptr) < 7) {
+					return false;
+				}
+				__cpuid_count(7, 0, eax, ebx, ecx, edx);
+				return (ebx & bit_SHA) != 0;
+			}
+
+			__attribute__((target("sha,sse4.1")))
+			void compressHardware(uint32_t state[8], const uint8_t* blocks, size_t blockCount) {
+				const __m128i byteOrder = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+				// the SHA-NI instructions keep the state as ABEF and CDGH
+				__m128i dcba = _mm_loadu_si128((const __m128i*)state);
+				__m128i hgfe = _mm_loadu_si128((const __m128i*)(state + 4));
+				__m128i cdab = _mm_shuffle_epi32(dcba, 0xB1);
+				__m128i efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+				__m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+				__m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+				for(size_t block=0; block<blockCount; block++) {
+					const uint8_t* input = blocks + (block * SHA256::BLOCK_SIZE);
+					__m128i abefStart = abef;
+					__m128i cdghStart = cdgh;
+					__m128i messages[4];
+					for(size_t group=0; group<16; group++) {
+						__m128i& message = messages[group % 4];
+						if(group < 4) {
+							message = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(input + (group * 16))), byteOrder);
+						} else {
+							// schedule the next 4 words from the previous 16
+							__m128i previous = messages[(group + 3) % 4];
+							message = _mm_sha256msg1_epu32(message, messages[(group + 1) % 4]);
+							message = _mm_add_epi32(message, _mm_alignr_epi8(previous, messages[(group + 2) % 4], 4));
+							message = _mm_sha256msg2_epu32(message, previous);
+						}
+						__m128i roundInput = _mm_add_epi32(message, _mm_load_si128((const __m128i*)(ROUND_CONSTANTS + (group * 4))));
+						cdgh = _mm_sha256rnds2_epu32(cdgh, abef, roundInput);
+						abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(roundInput, 0x0E));
+					}
+					abef = _mm_add_epi32(abef, abefStart);
+					cdgh = _mm_add_epi32(cdgh, cdghStart);
+				}
+				__m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+				__m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+				_mm_storeu_si128((__m128i*)state, _mm_blend_epi16(feba, dchg, 0xF0));
+				_mm_storeu_si128((__m128i*)(state + 4), _mm_alignr_epi8(dchg, feba, 8));
+			}
+			#elif defined(FGL_SHA256_ARM)
+			void compressHardware(uint32_t state[8], const uint8_t* blocks, size_t blockCount) {
+				uint32x4_t abcd = vld1q_u32(state);
+				uint32x4_t efgh = vld1q_u32(state + 4);
+				for(size_t block=0; block<blockCount; block++) {
+					const uint8_t* input = blocks + (block * SHA256::BLOCK_SIZE);
+					uint32x4_t abcdStart = abcd;
+					uint32x4_t efghStart = efgh;
+					uint32x4_t messages[4];
+					for(size_t group=0; group<16; group++) {
+						uint32x4_t& message = messages[group % 4];
+						if(group < 4) {
+							message = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(input + (group * 16))));
+						} else {
+							// schedule the next 4 words from the previous 16
+							message = vsha256su1q_u32(vsha256su0q_u32(message, messages[(group + 1) % 4]), messages[(group + 2) % 4], messages[(group + 3) % 4]);
+						}
+						uint32x4_t roundInput = vaddq_u32(message, vld1q_u32(ROUND_CONSTANTS + (group * 4)));
+						uint32x4_t abcdPrevious = abcd;
+						abcd = vsha256hq_u32(abcd, efgh, roundInput);
+						efgh = vsha256h2q_u32(efgh, abcdPrevious, roundInput);
+					}
+					abcd = vaddq_u32(abcd, abcdStart);
+					efgh = vaddq_u32(efgh, efghStart);
+				}
+				vst1q_u32(state, abcd);
+				vst1q_u32(state + 4, efgh);
+			}
+			#endif
+
+			using CompressFunction = void(*)(uint32_t state[8], const uint8_t* blocks, size_t blockCount);
+
+			CompressFunction selectCompressFunction() {
+				#if defined(FGL_SHA256_X86)
+				if(cpuHasSHA()) {
+					return compressHardware;
+				}
+				#elif defined(FGL_SHA256_ARM)
+				return compressHardware;
+				#endif
+				return compressPortable;
+			}
+
+			inline void compress(uint32_t state[8], const uint8_t* blocks, size_t blockCount) {
+				static const CompressFunction compressFunction = selectCompressFunction();
+				compressFunction(state, blocks, blockCount);
+			}
+		}
+
+
+
+		#pragma mark SHA256 implementation
+
+		SHA256::SHA256() noexcept {
+			reset();
+		}
+
+		void SHA256::reset() noexcept {
+			_length = 0;
+			std::memcpy(_state, INITIAL_STATE, sizeof(_state));
+		}
+
+		void SHA256::update(const void* bytes, size_t size) noexcept {
+			auto input = (const uint8_t*)bytes;
+			size_t bufferedSize = (size_t)(_length % BLOCK_SIZE);
+			_length += size;
+			// complete a partially filled block first
+			if(bufferedSize > 0) {
+				size_t count = std::min(size, BLOCK_SIZE - bufferedSize);
+				std::memcpy(_buffer + bufferedSize, input, count);
+				input += count;
+				size -= count;
+				if((bufferedSize + count) < BLOCK_SIZE) {
+					return;
+				}
+				compress(_state, _buffer, 1);
+			}
+			// compress whole blocks straight from the input
+			size_t blockCount = size / BLOCK_SIZE;
+			if(blockCount > 0) {
+				compress(_state, input, blockCount);
+				input += blockCount * BLOCK_SIZE;
+				size -= blockCount * BLOCK_SIZE;
+			}
+			if(size > 0) {
+				std::memcpy(_buffer, input, size);
+			}
+		}
+
+		SHA256::Digest SHA256::finalize() noexcept {
+			size_t bufferedSize = (size_t)(_length % BLOCK_SIZE);
+			uint8_t finalBlocks[BLOCK_SIZE * 2] = {};
+			std::memcpy(finalBlocks, _buffer, bufferedSize);
+			finalBlocks[bufferedSize] = 0x80;
+			size_t finalBlockCount = (bufferedSize < 56) ? 1 : 2;
+			storeBigEndian(finalBlocks + (finalBlockCount * BLOCK_SIZE) - 8, _length << 3);
+			compress(_state, finalBlocks, finalBlockCount);
+			Digest digest;
+			for(size_t i=0; i<8; i++) {
+				uint32_t word = _state[i];
+				if constexpr(std::endian::native == std::endian::little) {
+					word = byteSwap(word);
+				}
+				std::memcpy(digest.data() + (i * 4), &word, sizeof(word));
+			}
+			std::memset(_buffer, 0, sizeof(_buffer));
+			reset();
+			return digest;
+		}
+
+		bool SHA256::isHardwareAccelerated() noexcept {
+			#if defined(FGL_SHA256_X86)
+			static const bool hasSHA = cpuHasSHA();
+			return hasSHA;
+			#elif defined(FGL_SHA256_ARM)
+			return true;
+			#else
+			return false;
+			#endif
+		}
+	}
+
+
+
+	String sha256(const std::string& str) {
+		auto digest = crypto::SHA256::hash(str.data(), str.size());
+		String hex(Hex::encodedSize(digest.size()), '\0');
+		Hex::encode(digest.data(), digest.size(), hex.data());
+		return hex;
+	}
+}
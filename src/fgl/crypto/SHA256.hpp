@@ -0,0 +1,49 @@
+//
+//  SHA256.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/crypto/Hasher.hpp>
+#include <array>
+
+namespace fgl {
+	namespace crypto {
+		/// Computes a SHA-256 digest incrementally.
+		/// Blocks are hashed with the CPU's SHA instructions when they are available, and with portable code otherwise.
+		class SHA256: public BasicHasher<SHA256,std::array<uint8_t,32>> {
+		public:
+			static constexpr size_t DIGEST_SIZE = 32;
+			static constexpr size_t BLOCK_SIZE = 64;
+
+			using BasicHasher::update;
+			using BasicHasher::hash;
+
+			SHA256() noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			/// Finishes the digest of everything passed to update, and resets the hasher so it can be reused
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+			/// Whether blocks are hashed with SHA-NI on x86, or with the cryptography extension on ARMv8
+			static bool isHardwareAccelerated() noexcept;
+
+		private:
+			uint32_t _state[8];
+			uint8_t _buffer[BLOCK_SIZE];
+			/// The total number of bytes passed to update
+			uint64_t _length;
+		};
+	}
+
+	/// The lowercase hex SHA-256 digest of a string
+	String sha256(const std::string& str);
+}
@@ -0,0 +1,250 @@
+//
+//  TreeHash.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/ByteStream.hpp>
+#include <fgl/data/DataFile.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/Parallel.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/crypto/Hasher.hpp>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+
+namespace fgl {
+	namespace crypto {
+		/// A Merkle tree over fixed size leaves of a buffer or file. Leaves are hashed in parallel, so large inputs hash at close to memory bandwidth.
+		/// A leaf's digest is H(0x00 || leaf) and a node's digest is H(0x01 || left || right). A node without a right sibling moves up a level unchanged.
+		/// Integer digests are combined in big endian order, so the root only depends on the input, the leaf size and the hash function.
+		template<Hasher HasherType>
+		class TreeHash {
+		public:
+			using Digest = typename HasherType::Digest;
+			static constexpr size_t DEFAULT_LEAF_SIZE = 1024 * 1024;
+
+			/// Hashes a buffer. An empty buffer has a single empty leaf.
+			static TreeHash compute(DataView bytes, size_t leafSize = DEFAULT_LEAF_SIZE, size_t threadCount = 0);
+			/// Hashes a file, which is mapped into memory rather than read, so it can be larger than the available memory
+			static TreeHash computeFile(const String& path, size_t leafSize = DEFAULT_LEAF_SIZE, size_t threadCount = 0);
+
+			inline const Digest& root() const noexcept;
+			inline size_t leafSize() const noexcept;
+			inline size_t leafCount() const noexcept;
+			inline const Digest& leaf(size_t index) const;
+
+			/// The sibling digests on the path from a leaf to the root, from the bottom up
+			ArrayList<Digest> proof(size_t leafIndex) const;
+			/// Whether the given bytes match a leaf of this tree
+			bool verifyLeaf(size_t leafIndex, DataView bytes) const noexcept;
+
+			static Digest hashLeaf(DataView bytes) noexcept;
+			static Digest hashNode(const Digest& left, const Digest& right) noexcept;
+			/// Checks a single leaf against a trusted root, using a proof from a tree of leafCount leaves, without needing the rest of the input
+			static bool verifyProof(const Digest& root, size_t leafIndex, size_t leafCount, DataView bytes, std::span<const Digest> proof) noexcept;
+
+		private:
+			TreeHash(size_t leafSize);
+
+			static void updateWithDigest(HasherType& hasher, const Digest& digest) noexcept;
+			void hashLeaves(const uint8_t* bytes, size_t size, size_t firstLeaf, size_t threadCount);
+			void buildLevels();
+
+			size_t _leafSize;
+			/// The leaf digests first, and the root last
+			ArrayList<ArrayList<Digest>> _levels;
+		};
+
+
+
+#pragma mark TreeHash implementation
+
+		template<Hasher HasherType>
+		TreeHash<HasherType>::TreeHash(size_t leafSize)
+		: _leafSize(leafSize) {
+			if(leafSize == 0) {
+				throw std::invalid_argument("leafSize must be greater than 0");
+			}
+		}
+
+		template<Hasher HasherType>
+		TreeHash<HasherType> TreeHash<HasherType>::compute(DataView bytes, size_t leafSize, size_t threadCount) {
+			TreeHash tree(leafSize);
+			size_t leafCount = std::max((size_t)1, (bytes.size() + leafSize - 1) / leafSize);
+			tree._levels.resize(1);
+			tree._levels[0].resize(leafCount);
+			tree.hashLeaves(bytes.data(), bytes.size(), 0, threadCount);
+			tree.buildLevels();
+			return tree;
+		}
+
+		template<Hasher HasherType>
+		TreeHash<HasherType> TreeHash<HasherType>::computeFile(const String& path, size_t leafSize, size_t threadCount) {
+			if constexpr(sizeof(size_t) >= 8) {
+				auto file = Data::mapFile(path, FileAccess::Normal);
+				return compute(file.view(), leafSize, threadCount);
+			} else {
+				// large files may not fit in a 32-bit address space, so read them a batch of leaves at a time instead
+				TreeHash tree(leafSize);
+				DataReader reader(path);
+				size_t batchLeafCount = std::max((size_t)1, (size_t)(64 * 1024 * 1024) / leafSize);
+				Data batch;
+				batch.resize(batchLeafCount * leafSize);
+				tree._levels.resize(1);
+				size_t leafCount = 0;
+				do {
+					size_t size = reader.read(batch.data(), batch.size());
+					if(size == 0 && leafCount > 0) {
+						break;
+					}
+					size_t firstLeaf = leafCount;
+					leafCount += std::max((size_t)1, (size + leafSize - 1) / leafSize);
+					tree._levels[0].resize(leafCount);
+					tree.hashLeaves(batch.data(), size, firstLeaf, threadCount);
+				} while(!reader.atEnd());
+				tree.buildLevels();
+				return tree;
+			}
+		}
+
+		template<Hasher HasherType>
+		void TreeHash<HasherType>::hashLeaves(const uint8_t* bytes, size_t size, size_t firstLeaf, size_t threadCount) {
+			auto& leaves = _levels[0];
+			size_t leafCount = leaves.size() - firstLeaf;
+			size_t leafSize = _leafSize;
+			runParallel(leafCount, threadCount, [&](size_t index) {
+				size_t offset = index * leafSize;
+				size_t count = std::min(leafSize, size - offset);
+				leaves[firstLeaf + index] = hashLeaf(DataView(bytes + offset, count));
+			});
+		}
+
+		template<Hasher HasherType>
+		void TreeHash<HasherType>::buildLevels() {
+			while(_levels.back().size() > 1) {
+				auto& children = _levels.back();
+				ArrayList<Digest> parents;
+				parents.reserve((children.size() + 1) / 2);
+				for(size_t i=0; i<children.size(); i+=2) {
+					if((i + 1) < children.size()) {
+						parents.pushBack(hashNode(children[i], children[i + 1]));
+					} else {
+						parents.pushBack(children[i]);
+					}
+				}
+				_levels.pushBack(std::move(parents));
+			}
+		}
+
+		template<Hasher HasherType>
+		const typename TreeHash<HasherType>::Digest& TreeHash<HasherType>::root() const noexcept {
+			return _levels.back().front();
+		}
+
+		template<Hasher HasherType>
+		size_t TreeHash<HasherType>::leafSize() const noexcept {
+			return _leafSize;
+		}
+
+		template<Hasher HasherType>
+		size_t TreeHash<HasherType>::leafCount() const noexcept {
+			return _levels.front().size();
+		}
+
+		template<Hasher HasherType>
+		const typename TreeHash<HasherType>::Digest& TreeHash<HasherType>::leaf(size_t index) const {
+			return _levels.front().at(index);
+		}
+
+		template<Hasher HasherType>
+		ArrayList<typename TreeHash<HasherType>::Digest> TreeHash<HasherType>::proof(size_t leafIndex) const {
+			if(leafIndex >= leafCount()) {
+				throw std::out_of_range("leaf index " + std::to_string(leafIndex) + " is out of bounds in TreeHash with " + std::to_string(leafCount()) + " leaves");
+			}
+			ArrayList<Digest> siblings;
+			size_t index = leafIndex;
+			for(size_t level=0; (level + 1) < _levels.size(); level++) {
+				size_t sibling = index ^ 1;
+				if(sibling < _levels[level].size()) {
+					siblings.pushBack(_levels[level][sibling]);
+				}
+				index /= 2;
+			}
+			return siblings;
+		}
+
+		template<Hasher HasherType>
+		bool TreeHash<HasherType>::verifyLeaf(size_t leafIndex, DataView bytes) const noexcept {
+			if(leafIndex >= leafCount()) {
+				return false;
+			}
+			return hashLeaf(bytes) == _levels.front()[leafIndex];
+		}
+
+		template<Hasher HasherType>
+		void TreeHash<HasherType>::updateWithDigest(HasherType& hasher, const Digest& digest) noexcept {
+			if constexpr(std::integral<Digest>) {
+				Digest value = digest;
+				if constexpr(std::endian::native == std::endian::little) {
+					value = byteSwap(value);
+				}
+				hasher.update(&value, sizeof(value));
+			} else {
+				hasher.update(digest.data(), digest.size());
+			}
+		}
+
+		template<Hasher HasherType>
+		typename TreeHash<HasherType>::Digest TreeHash<HasherType>::hashLeaf(DataView bytes) noexcept {
+			const uint8_t prefix = 0x00;
+			HasherType hasher;
+			hasher.update(&prefix, 1);
+			hasher.update(bytes.data(), bytes.size());
+			return hasher.finalize();
+		}
+
+		template<Hasher HasherType>
+		typename TreeHash<HasherType>::Digest TreeHash<HasherType>::hashNode(const Digest& left, const Digest& right) noexcept {
+			const uint8_t prefix = 0x01;
+			HasherType hasher;
+			hasher.update(&prefix, 1);
+			updateWithDigest(hasher, left);
+			updateWithDigest(hasher, right);
+			return hasher.finalize();
+		}
+
+		template<Hasher HasherType>
+		bool TreeHash<HasherType>::verifyProof(const Digest& root, size_t leafIndex, size_t leafCount, DataView bytes, std::span<const Digest> proof) noexcept {
+			if(leafIndex >= leafCount) {
+				return false;
+			}
+			Digest digest = hashLeaf(bytes);
+			size_t index = leafIndex;
+			size_t levelSize = leafCount;
+			size_t proofIndex = 0;
+			while(levelSize > 1) {
+				size_t sibling = index ^ 1;
+				if(sibling < levelSize) {
+					if(proofIndex >= proof.size()) {
+						return false;
+					}
+					const Digest& siblingDigest = proof[proofIndex];
+					proofIndex++;
+					digest = (sibling < index) ? hashNode(siblingDigest, digest) : hashNode(digest, siblingDigest);
+				}
+				index /= 2;
+				levelSize = (levelSize + 1) / 2;
+			}
+			return proofIndex == proof.size() && digest == root;
+		}
+	}
+}
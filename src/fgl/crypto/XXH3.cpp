@@ -0,0 +1,363 @@
+//
+//  XXH3.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/crypto/XXH3.hpp>
+#include <fgl/data/ByteStream.hpp>
+#include <cstring>
+
+#if !defined(FGL_XXH3_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define FGL_XXH3_SSE2
+	#include <emmintrin.h>
+#elif !defined(FGL_XXH3_DISABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+	#define FGL_XXH3_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace fgl {
+	namespace crypto {
+		namespace {
+			constexpr uint64_t PRIME32_1 = 0x9E3779B1;
+			constexpr uint64_t PRIME32_2 = 0x85EBCA77;
+			constexpr uint64_t PRIME32_3 = 0xC2B2AE3D;
+			constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87;
+			constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4F;
+			constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9;
+			constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63;
+			constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5;
+
+			constexpr size_t STRIPE_SIZE = 64;
+			constexpr size_t SECRET_SIZE = 192;
+			// each stripe of a block uses the secret starting 8 bytes after the previous one
+			constexpr size_t SECRET_CONSUME_RATE = 8;
+			constexpr size_t STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_SIZE) / SECRET_CONSUME_RATE;
+			constexpr size_t BLOCK_SIZE = STRIPES_PER_BLOCK * STRIPE_SIZE;
+			constexpr size_t MIDSIZE_MAX = 240;
+
+			alignas(64) constexpr uint8_t SECRET[SECRET_SIZE] = {
+				0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+				0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+				0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+				0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+				0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+				0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+				0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+				0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+				0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+				0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+				0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+				0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+			};
+
+			template<typename T>
+			inline T loadLittleEndian(const uint8_t* bytes) {
+				T value;
+				std::memcpy(&value, bytes, sizeof(T));
+				if constexpr(std::endian::native == std::endian::big) {
+					value = byteSwap(value);
+				}
+				return value;
+			}
+
+			inline uint64_t rotateLeft(uint64_t x, int n) {
+				return (x << n) | (x >> (64 - n));
+			}
+
+			/// Multiplies two 64-bit values into 128 bits, and folds the halves together
+			inline uint64_t multiplyFold(uint64_t a, uint64_t b) {
+				#if defined(__SIZEOF_INT128__)
+				unsigned __int128 product = (unsigned __int128)a * b;
+				return (uint64_t)product ^ (uint64_t)(product >> 64);
+				#else
+				uint64_t lowLow = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+				uint64_t highLow = (a >> 32) * (b & 0xFFFFFFFF);
+				uint64_t lowHigh = (a & 0xFFFFFFFF) * (b >> 32);
+				uint64_t highHigh = (a >> 32) * (b >> 32);
+				uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+				uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+				uint64_t lower = (cross << 32) | (lowLow & 0xFFFFFFFF);
+				return lower ^ upper;
+				#endif
+			}
+
+			inline uint64_t avalanche(uint64_t hash) {
+				hash ^= hash >> 37;
+				hash *= 0x165667919E3779F9;
+				return hash ^ (hash >> 32);
+			}
+
+			inline uint64_t avalancheXXH64(uint64_t hash) {
+				hash ^= hash >> 33;
+				hash *= PRIME64_2;
+				hash ^= hash >> 29;
+				hash *= PRIME64_3;
+				return hash ^ (hash >> 32);
+			}
+
+			inline uint64_t mix16(const uint8_t* input, const uint8_t* secret) {
+				return multiplyFold(
+					loadLittleEndian<uint64_t>(input) ^ loadLittleEndian<uint64_t>(secret),
+					loadLittleEndian<uint64_t>(input + 8) ^ loadLittleEndian<uint64_t>(secret + 8));
+			}
+
+			uint64_t hashUpTo16(const uint8_t* input, size_t size) {
+				if(size > 8) {
+					uint64_t low = loadLittleEndian<uint64_t>(input) ^ (loadLittleEndian<uint64_t>(SECRET + 24) ^ loadLittleEndian<uint64_t>(SECRET + 32));
+					uint64_t high = loadLittleEndian<uint64_t>(input + size - 8) ^ (loadLittleEndian<uint64_t>(SECRET + 40) ^ loadLittleEndian<uint64_t>(SECRET + 48));
+					uint64_t accumulator = size + byteSwap(low) + high + multiplyFold(low, high);
+					return avalanche(accumulator);
+				} else if(size >= 4) {
+					uint64_t first = loadLittleEndian<uint32_t>(input);
+					uint64_t last = loadLittleEndian<uint32_t>(input + size - 4);
+					uint64_t hash = (last + (first << 32)) ^ (loadLittleEndian<uint64_t>(SECRET + 8) ^ loadLittleEndian<uint64_t>(SECRET + 16));
+					hash ^= rotateLeft(hash, 49) ^ rotateLeft(hash, 24);
+					hash *= 0x9FB21C651E98DF25;
+					hash ^= (hash >> 35) + size;
+					hash *= 0x9FB21C651E98DF25;
+					return hash ^ (hash >> 28);
+				} else if(size > 0) {
+					uint32_t combined = ((uint32_t)input[0] << 16) | ((uint32_t)input[size >> 1] << 24) | (uint32_t)input[size - 1] | ((uint32_t)size << 8);
+					uint64_t bitflip = loadLittleEndian<uint32_t>(SECRET) ^ loadLittleEndian<uint32_t>(SECRET + 4);
+					return avalancheXXH64(combined ^ bitflip);
+				}
+				return avalancheXXH64(loadLittleEndian<uint64_t>(SECRET + 56) ^ loadLittleEndian<uint64_t>(SECRET + 64));
+			}
+
+			uint64_t hashUpTo128(const uint8_t* input, size_t size) {
+				uint64_t accumulator = size * PRIME64_1;
+				if(size > 32) {
+					if(size > 64) {
+						if(size > 96) {
+							accumulator += mix16(input + 48, SECRET + 96);
+							accumulator += mix16(input + size - 64, SECRET + 112);
+						}
+						accumulator += mix16(input + 32, SECRET + 64);
+						accumulator += mix16(input + size - 48, SECRET + 80);
+					}
+					accumulator += mix16(input + 16, SECRET + 32);
+					accumulator += mix16(input + size - 32, SECRET + 48);
+				}
+				accumulator += mix16(input, SECRET);
+				accumulator += mix16(input + size - 16, SECRET + 16);
+				return avalanche(accumulator);
+			}
+
+			uint64_t hashUpTo240(const uint8_t* input, size_t size) {
+				uint64_t accumulator = size * PRIME64_1;
+				for(size_t i=0; i<8; i++) {
+					accumulator += mix16(input + (i * 16), SECRET + (i * 16));
+				}
+				accumulator = avalanche(accumulator);
+				// the remaining rounds use the secret from a 3 byte offset
+				size_t roundCount = size / 16;
+				for(size_t i=8; i<roundCount; i++) {
+					accumulator += mix16(input + (i * 16), SECRET + ((i - 8) * 16) + 3);
+				}
+				accumulator += mix16(input + size - 16, SECRET + 136 - 17);
+				return avalanche(accumulator);
+			}
+
+			/// Mixes one 64 byte stripe into the 8 accumulators
+			inline void accumulateStripe(uint64_t accumulators[8], const uint8_t* input, const uint8_t* secret) {
+				#if defined(FGL_XXH3_SSE2)
+				for(size_t i=0; i<4; i++) {
+					__m128i data = _mm_loadu_si128((const __m128i*)(input + (i * 16)));
+					__m128i dataKey = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*)(secret + (i * 16))));
+					// multiply the low and high 32 bits of each 64-bit lane
+					__m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+					__m128i dataSwapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+					__m128i accumulator = _mm_load_si128((const __m128i*)(accumulators + (i * 2)));
+					accumulator = _mm_add_epi64(_mm_add_epi64(accumulator, dataSwapped), product);
+					_mm_store_si128((__m128i*)(accumulators + (i * 2)), accumulator);
+				}
+				#elif defined(FGL_XXH3_NEON)
+				for(size_t i=0; i<4; i++) {
+					uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(input + (i * 16)));
+					uint64x2_t dataKey = veorq_u64(data, vreinterpretq_u64_u8(vld1q_u8(secret + (i * 16))));
+					uint64x2_t accumulator = vaddq_u64(vld1q_u64(accumulators + (i * 2)), vextq_u64(data, data, 1));
+					// multiply the low and high 32 bits of each 64-bit lane
+					accumulator = vmlal_u32(accumulator, vmovn_u64(dataKey), vshrn_n_u64(dataKey, 32));
+					vst1q_u64(accumulators + (i * 2), accumulator);
+				}
+				#else
+				for(size_t i=0; i<8; i++) {
+					uint64_t data = loadLittleEndian<uint64_t>(input + (i * 8));
+					uint64_t dataKey = data ^ loadLittleEndian<uint64_t>(secret + (i * 8));
+					accumulators[i ^ 1] += data;
+					accumulators[i] += (dataKey & 0xFFFFFFFF) * (dataKey >> 32);
+				}
+				#endif
+			}
+
+			/// Scrambles the accumulators at the end of each block
+			inline void scramble(uint64_t accumulators[8], const uint8_t* secret) {
+				#if defined(FGL_XXH3_SSE2)
+				const __m128i prime = _mm_set1_epi32((int)PRIME32_1);
+				for(size_t i=0; i<4; i++) {
+					__m128i accumulator = _mm_load_si128((const __m128i*)(accumulators + (i * 2)));
+					accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+					accumulator = _mm_xor_si128(accumulator, _mm_loadu_si128((const __m128i*)(secret + (i * 16))));
+					// multiply each 64-bit lane by a 32-bit prime, in two halves
+					__m128i productLow = _mm_mul_epu32(accumulator, prime);
+					__m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(accumulator, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+					_mm_store_si128((__m128i*)(accumulators + (i * 2)), _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+				}
+				#elif defined(FGL_XXH3_NEON)
+				const uint32x2_t prime = vdup_n_u32((uint32_t)PRIME32_1);
+				for(size_t i=0; i<4; i++) {
+					uint64x2_t accumulator = vld1q_u64(accumulators + (i * 2));
+					accumulator = veorq_u64(accumulator, vshrq_n_u64(accumulator, 47));
+					accumulator = veorq_u64(accumulator, vreinterpretq_u64_u8(vld1q_u8(secret + (i * 16))));
+					// multiply each 64-bit lane by a 32-bit prime, in two halves
+					uint64x2_t productHigh = vshlq_n_u64(vmull_u32(vshrn_n_u64(accumulator, 32), prime), 32);
+					vst1q_u64(accumulators + (i * 2), vmlal_u32(productHigh, vmovn_u64(accumulator), prime));
+				}
+				#else
+				for(size_t i=0; i<8; i++) {
+					uint64_t accumulator = accumulators[i];
+					accumulator ^= accumulator >> 47;
+					accumulator ^= loadLittleEndian<uint64_t>(secret + (i * 8));
+					accumulators[i] = accumulator * PRIME32_1;
+				}
+				#endif
+			}
+
+			inline void accumulateStripes(uint64_t accumulators[8], const uint8_t* input, const uint8_t* secret, size_t stripeCount) {
+				for(size_t i=0; i<stripeCount; i++) {
+					accumulateStripe(accumulators, input + (i * STRIPE_SIZE), secret + (i * SECRET_CONSUME_RATE));
+				}
+			}
+
+			/// Accumulates up to a block's worth of stripes, scrambling when they complete the current block
+			void consumeStripes(uint64_t accumulators[8], size_t& blockStripeCount, const uint8_t* input, size_t stripeCount) {
+				size_t stripesToBlockEnd = STRIPES_PER_BLOCK - blockStripeCount;
+				if(stripeCount >= stripesToBlockEnd) {
+					accumulateStripes(accumulators, input, SECRET + (blockStripeCount * SECRET_CONSUME_RATE), stripesToBlockEnd);
+					scramble(accumulators, SECRET + SECRET_SIZE - STRIPE_SIZE);
+					accumulateStripes(accumulators, input + (stripesToBlockEnd * STRIPE_SIZE), SECRET, stripeCount - stripesToBlockEnd);
+					blockStripeCount = stripeCount - stripesToBlockEnd;
+				} else {
+					accumulateStripes(accumulators, input, SECRET + (blockStripeCount * SECRET_CONSUME_RATE), stripeCount);
+					blockStripeCount += stripeCount;
+				}
+			}
+
+			void initAccumulators(uint64_t accumulators[8]) {
+				const uint64_t initial[8] = { PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1 };
+				std::memcpy(accumulators, initial, sizeof(initial));
+			}
+
+			/// Finishes a long hash, given the last 64 bytes of the input
+			uint64_t finishLong(uint64_t accumulators[8], const uint8_t* lastStripe, uint64_t size) {
+				accumulateStripe(accumulators, lastStripe, SECRET + SECRET_SIZE - STRIPE_SIZE - 7);
+				uint64_t result = size * PRIME64_1;
+				for(size_t i=0; i<4; i++) {
+					result += multiplyFold(
+						accumulators[i * 2] ^ loadLittleEndian<uint64_t>(SECRET + 11 + (i * 16)),
+						accumulators[(i * 2) + 1] ^ loadLittleEndian<uint64_t>(SECRET + 11 + (i * 16) + 8));
+				}
+				return avalanche(result);
+			}
+
+			uint64_t hashLong(const uint8_t* input, size_t size) {
+				alignas(16) uint64_t accumulators[8];
+				initAccumulators(accumulators);
+				// the last stripe is always handled by finishLong, even when the size is a multiple of the stripe size
+				size_t blockCount = (size - 1) / BLOCK_SIZE;
+				for(size_t i=0; i<blockCount; i++) {
+					accumulateStripes(accumulators, input + (i * BLOCK_SIZE), SECRET, STRIPES_PER_BLOCK);
+					scramble(accumulators, SECRET + SECRET_SIZE - STRIPE_SIZE);
+				}
+				size_t stripeCount = ((size - 1) - (blockCount * BLOCK_SIZE)) / STRIPE_SIZE;
+				accumulateStripes(accumulators, input + (blockCount * BLOCK_SIZE), SECRET, stripeCount);
+				return finishLong(accumulators, input + size - STRIPE_SIZE, size);
+			}
+		}
+
+
+
+		#pragma mark XXH3 implementation
+
+		XXH3::XXH3() noexcept {
+			reset();
+		}
+
+		void XXH3::reset() noexcept {
+			initAccumulators(_accumulators);
+			_bufferedSize = 0;
+			_stripeCount = 0;
+			_length = 0;
+		}
+
+		void XXH3::update(const void* bytes, size_t size) noexcept {
+			auto input = (const uint8_t*)bytes;
+			_length += size;
+			if(size <= (BUFFER_SIZE - _bufferedSize)) {
+				std::memcpy(_buffer + _bufferedSize, input, size);
+				_bufferedSize += size;
+				return;
+			}
+			// at least 1 byte is always left buffered, so finalize has a last stripe to work with
+			if(_bufferedSize > 0) {
+				size_t count = BUFFER_SIZE - _bufferedSize;
+				std::memcpy(_buffer + _bufferedSize, input, count);
+				input += count;
+				size -= count;
+				consumeStripes(_accumulators, _stripeCount, _buffer, BUFFER_SIZE / STRIPE_SIZE);
+				_bufferedSize = 0;
+			}
+			if(size > BUFFER_SIZE) {
+				do {
+					consumeStripes(_accumulators, _stripeCount, input, BUFFER_SIZE / STRIPE_SIZE);
+					input += BUFFER_SIZE;
+					size -= BUFFER_SIZE;
+				} while(size > BUFFER_SIZE);
+				// keep the stripe before the remaining input, in case finalize needs some of it for the last stripe
+				std::memcpy(_buffer + BUFFER_SIZE - STRIPE_SIZE, input - STRIPE_SIZE, STRIPE_SIZE);
+			}
+			std::memcpy(_buffer, input, size);
+			_bufferedSize = size;
+		}
+
+		XXH3::Digest XXH3::finalize() noexcept {
+			Digest digest;
+			if(_length > MIDSIZE_MAX) {
+				alignas(16) uint64_t accumulators[8];
+				std::memcpy(accumulators, _accumulators, sizeof(accumulators));
+				uint8_t lastStripe[STRIPE_SIZE];
+				if(_bufferedSize >= STRIPE_SIZE) {
+					size_t stripeCount = _stripeCount;
+					consumeStripes(accumulators, stripeCount, _buffer, (_bufferedSize - 1) / STRIPE_SIZE);
+					std::memcpy(lastStripe, _buffer + _bufferedSize - STRIPE_SIZE, STRIPE_SIZE);
+				} else {
+					// the last stripe starts in the input that was already consumed
+					size_t catchupSize = STRIPE_SIZE - _bufferedSize;
+					std::memcpy(lastStripe, _buffer + BUFFER_SIZE - catchupSize, catchupSize);
+					std::memcpy(lastStripe + catchupSize, _buffer, _bufferedSize);
+				}
+				digest = finishLong(accumulators, lastStripe, _length);
+			} else {
+				// short inputs are still entirely in the buffer
+				digest = hash(_buffer, (size_t)_length);
+			}
+			reset();
+			return digest;
+		}
+
+		XXH3::Digest XXH3::hash(const void* bytes, size_t size) noexcept {
+			auto input = (const uint8_t*)bytes;
+			if(size <= 16) {
+				return hashUpTo16(input, size);
+			} else if(size <= 128) {
+				return hashUpTo128(input, size);
+			} else if(size <= MIDSIZE_MAX) {
+				return hashUpTo240(input, size);
+			}
+			return hashLong(input, size);
+		}
+	}
+}
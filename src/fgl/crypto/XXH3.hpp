@@ -0,0 +1,48 @@
+//
+//  XXH3.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/crypto/Hasher.hpp>
+
+namespace fgl {
+	namespace crypto {
+		/// Computes the 64-bit XXH3 hash incrementally, with the default secret and no seed.
+		/// XXH3 isn't cryptographic, but it is much faster than the other hashers, which makes it a good fit for checksums.
+		class XXH3: public BasicHasher<XXH3,uint64_t> {
+		public:
+			static constexpr size_t DIGEST_SIZE = 8;
+
+			using BasicHasher::update;
+			using BasicHasher::hash;
+
+			XXH3() noexcept;
+
+			void update(const void* bytes, size_t size) noexcept;
+			/// Finishes the hash of everything passed to update, and resets the hasher so it can be reused
+			Digest finalize() noexcept;
+			/// Discards everything passed to update since the last finalize
+			void reset() noexcept;
+
+			/// Hashes a whole input at once, which avoids buffering and is much faster for short inputs
+			static Digest hash(const void* bytes, size_t size) noexcept;
+
+		private:
+			static constexpr size_t BUFFER_SIZE = 256;
+
+			alignas(16) uint64_t _accumulators[8];
+			uint8_t _buffer[BUFFER_SIZE];
+			size_t _bufferedSize;
+			/// The number of 64 byte stripes consumed in the current 1 KB block
+			size_t _stripeCount;
+			/// The total number of bytes passed to update
+			uint64_t _length;
+		};
+	}
+}
@@ -11,17 +11,40 @@
 #include <fgl/data/Any.hpp>
 #include <fgl/data/ArrayList.hpp>
 #include <fgl/data/LinkedList.hpp>
+#include <fgl/data/UnrolledList.hpp>
+#include <fgl/data/ColumnTable.hpp>
 #include <fgl/data/Map.hpp>
 #include <fgl/data/String.hpp>
 #include <fgl/data/Data.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/SharedData.hpp>
+#include <fgl/data/DataFile.hpp>
+#include <fgl/data/ByteEncoding.hpp>
 #include <fgl/data/Number.hpp>
 #include <fgl/data/URL.hpp>
 #include <fgl/data/Stringify.hpp>
+#include <fgl/data/JSON.hpp>
+#include <fgl/data/Binary.hpp>
+#include <fgl/data/ByteStream.hpp>
 #include <fgl/data/Optional.hpp>
 #include <fgl/data/Iterator.hpp>
 #include <fgl/data/Variant.hpp>
+#include <fgl/data/CompactVariant.hpp>
 #include <fgl/data/SharedPtr.hpp>
+#include <fgl/data/RefPtr.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/Arena.hpp>
+#include <fgl/data/NodePool.hpp>
+#include <fgl/data/TypeId.hpp>
+#include <fgl/data/Parallel.hpp>
+#include <fgl/crypto/Hasher.hpp>
 #include <fgl/crypto/MD5.hpp>
+#include <fgl/crypto/SHA1.hpp>
+#include <fgl/crypto/SHA256.hpp>
+#include <fgl/crypto/CRC32C.hpp>
+#include <fgl/crypto/XXH3.hpp>
+#include <fgl/crypto/HMAC.hpp>
+#include <fgl/crypto/TreeHash.hpp>
 #include <fgl/error/Error.hpp>
 #include <fgl/time/Date.hpp>
 #include <fgl/time/DateFormatter.hpp>
@@ -25,7 +25,7 @@ namespace fgl {
 		//
 	}
 	
-	Any::Any(Any&& any): _ptr(any._ptr) {
+	Any::Any(Any&& any) noexcept: _ptr(any._ptr) {
 		any._ptr = nullptr;
 	}
 	
@@ -60,7 +60,7 @@ namespace fgl {
 		return *this;
 	}
 	
-	Any& Any::operator=(Any&& any) {
+	Any& Any::operator=(Any&& any) noexcept {
 		if(_ptr == any._ptr) {
 			return *this;
 		}
@@ -134,7 +134,14 @@ namespace fgl {
 		return _ptr->type();
 	}
 
+	TypeId Any::typeId() const noexcept {
+		if(_ptr == nullptr) {
+			return TypeId::of<void>();
+		}
+		return _ptr->typeId;
+	}
+
 	String Any::typeName() const {
-		return stringify_type(_ptr->type());
+		return typeId().name();
 	}
 }
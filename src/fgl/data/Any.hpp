@@ -12,6 +12,7 @@
 #include <fgl/data/Optional.hpp>
 #include <fgl/data/String.hpp>
 #include <fgl/data/Stringify.hpp>
+#include <fgl/data/TypeId.hpp>
 #include <any>
 #include <typeinfo>
 
@@ -20,6 +21,9 @@ namespace fgl {
 	private:
 		class Base {
 		public:
+			const TypeId typeId;
+			
+			Base(TypeId typeId): typeId(typeId) {}
 			virtual ~Base() {}
 			virtual Base* clone() const = 0;
 			virtual void* ptr() const = 0;
@@ -49,7 +53,7 @@ namespace fgl {
 	public:
 		Any();
 		Any(std::nullptr_t);
-		Any(Any&&);
+		Any(Any&&) noexcept;
 		Any(const Any&);
 		template<typename U, typename = std::enable_if_t<!(std::is_same_v<std::decay_t<U>,Any> || std::is_same_v<std::decay_t<U>,std::any>)>>
 		Any(U&&);
@@ -57,7 +61,7 @@ namespace fgl {
 		
 		Any& operator=(std::nullptr_t);
 		Any& operator=(const Any&);
-		Any& operator=(Any&&);
+		Any& operator=(Any&&) noexcept;
 		
 		template<typename U>
 		U& as() &;
@@ -97,6 +101,7 @@ namespace fgl {
 		String toString() const;
 		
 		const std::type_info& type() const noexcept;
+		TypeId typeId() const noexcept;
 		String typeName() const;
 	};
 
@@ -105,12 +110,12 @@ namespace fgl {
 #pragma mark Any implementation
 
 	template<typename T>
-	Any::Derived<T>::Derived(const T& val): value(val) {
+	Any::Derived<T>::Derived(const T& val): Base(TypeId::of<T>()), value(val) {
 		//
 	}
 
 	template<typename T>
-	Any::Derived<T>::Derived(T&& val): value(val) {
+	Any::Derived<T>::Derived(T&& val): Base(TypeId::of<T>()), value(std::move(val)) {
 		//
 	}
 
@@ -140,7 +145,7 @@ namespace fgl {
 	}
 	
 	template<typename U, typename _>
-	Any::Any(U&& value): _ptr(new Derived<typename std::decay<U>::type>(value)) {
+	Any::Any(U&& value): _ptr(new Derived<typename std::decay<U>::type>(std::forward<U>(value))) {
 		//
 	}
 	
@@ -150,22 +155,22 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			throw std::bad_any_cast();
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return derived->value;
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			return std::any_cast<U&>(derived->value);
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return derived->value;
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 			auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 			if(!derived->value.has_value()) {
 				throw std::bad_any_cast();
@@ -181,23 +186,23 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			throw std::bad_any_cast();
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return std::move(derived->value);
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			return std::move(std::any_cast<U&>(derived->value));
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return std::move(derived->value);
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
-			if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
+			if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 				auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 				if(!derived->value.has_value()) {
 					throw std::bad_any_cast();
@@ -214,23 +219,23 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			throw std::bad_any_cast();
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return derived->value;
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			return std::any_cast<const U&>(derived->value);
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return derived->value;
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
-			if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
+			if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 				auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 				if(!derived->value.has_value()) {
 					throw std::bad_any_cast();
@@ -247,11 +252,11 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			return std::nullopt;
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return derived->value;
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			try {
 				return std::any_cast<U>(derived->value);
@@ -261,13 +266,13 @@ namespace fgl {
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return derived->value;
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
-			if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
+			if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 				auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 				if(!derived->value.has_value()) {
 					return std::nullopt;
@@ -284,11 +289,11 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			return std::nullopt;
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return std::ref(derived->value);
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			try {
 				return std::ref(std::any_cast<U&>(derived->value));
@@ -298,13 +303,13 @@ namespace fgl {
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return std::ref(derived->value);
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
-			if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
+			if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 				auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 				if(!derived->value.has_value()) {
 					return std::nullopt;
@@ -321,11 +326,11 @@ namespace fgl {
 		if(_ptr == nullptr) {
 			return std::nullopt;
 		}
-		if(_ptr->type() == typeid(T)) {
+		if(_ptr->typeId == TypeId::of<T>()) {
 			auto derived = static_cast<Derived<T>*>(_ptr);
 			return std::ref(derived->value);
 		}
-		if(_ptr->type() == typeid(std::any)) {
+		if(_ptr->typeId == TypeId::of<std::any>()) {
 			auto derived = static_cast<Derived<std::any>*>(_ptr);
 			try {
 				return std::ref(std::any_cast<const U&>(derived->value));
@@ -335,13 +340,13 @@ namespace fgl {
 		}
 		if constexpr(is_optional_v<T>) {
 			using ValueType = typename Optionalized<T>::value_type;
-			if(_ptr->type() == typeid(ValueType)) {
+			if(_ptr->typeId == TypeId::of<ValueType>()) {
 				auto derived = static_cast<Derived<ValueType>*>(_ptr);
 				return std::ref(derived->value);
 			}
 		}
-		if(_ptr->type() == typeid(Optional<T>)) {
-			if(_ptr->type() == typeid(Optional<T>)) {
+		if(_ptr->typeId == TypeId::of<Optional<T>>()) {
+			if(_ptr->typeId == TypeId::of<Optional<T>>()) {
 				auto derived = static_cast<Derived<Optional<T>>*>(_ptr);
 				if(!derived->value.has_value()) {
 					return std::nullopt;
@@ -354,7 +359,7 @@ namespace fgl {
 	
 	template<typename T>
 	bool Any::is() const {
-		return (_ptr != nullptr && typeid(T) == _ptr->type());
+		return (_ptr != nullptr && _ptr->typeId == TypeId::of<T>());
 	}
 
 	template<typename U>
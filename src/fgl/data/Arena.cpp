@@ -0,0 +1,70 @@
+//
+//  Arena.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/Arena.hpp>
+#include <algorithm>
+#include <new>
+
+namespace fgl {
+	Arena::Arena(size_t blockSize)
+	: _blocks(nullptr), _cursor(nullptr), _end(nullptr),
+	_blockSize(std::max(blockSize, sizeof(Block) + alignof(std::max_align_t))), _capacity(0) {
+		//
+	}
+
+	Arena::~Arena() {
+		release();
+	}
+
+	void* Arena::doAllocate(size_t size, size_t alignment) {
+		return allocate(size, alignment);
+	}
+
+	void Arena::doDeallocate(void* ptr, size_t size, size_t alignment) noexcept {
+		deallocate(ptr, size, alignment);
+	}
+
+	void* Arena::allocateFromNewBlock(size_t size, size_t alignment) {
+		size_t blockSize = std::max(_blockSize, sizeof(Block) + (alignment - 1) + size);
+		auto block = static_cast<Block*>(::operator new(blockSize));
+		block->size = blockSize;
+		_capacity += blockSize;
+		char* blockStart = reinterpret_cast<char*>(block);
+		uintptr_t dataStart = (uintptr_t)(blockStart + sizeof(Block));
+		char* ptr = (char*)((dataStart + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+		char* blockEnd = blockStart + blockSize;
+		if(_blocks != nullptr && (size_t)(blockEnd - (ptr + size)) < (size_t)(_end - _cursor)) {
+			// an oversized allocation; keep bumping from the current block
+			block->next = _blocks->next;
+			_blocks->next = block;
+			return ptr;
+		}
+		block->next = _blocks;
+		_blocks = block;
+		_cursor = ptr + size;
+		_end = blockEnd;
+		return ptr;
+	}
+
+	void Arena::release() {
+		Block* block = _blocks;
+		while(block != nullptr) {
+			Block* next = block->next;
+			::operator delete(block);
+			block = next;
+		}
+		_blocks = nullptr;
+		_cursor = nullptr;
+		_end = nullptr;
+		_capacity = 0;
+	}
+
+	size_t Arena::capacity() const {
+		return _capacity;
+	}
+}
@@ -0,0 +1,154 @@
+//
+//  Arena.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/SharedPtr.hpp>
+#include <cstddef>
+#include <memory>
+
+namespace fgl {
+	/// A monotonic memory arena. Allocations are carved out of large blocks, deallocation is a no-op,
+	/// and all of the memory is returned at once by calling release() or destroying the arena.
+	/// An Arena is not thread safe, and it must outlive every object allocated from it.
+	/// It can be used directly through ArenaAllocator, or as a MemoryResource for the fgl::pmr containers.
+	class Arena: public MemoryResource {
+	public:
+		static constexpr size_t DEFAULT_BLOCK_SIZE = 4096;
+		
+		explicit Arena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+		virtual ~Arena();
+		
+		inline void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+		inline void deallocate(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept;
+		
+		/// Frees every block owned by the arena. Any objects still allocated from the arena must not be used afterwards.
+		void release();
+		
+		/// The total number of bytes reserved by the arena's blocks
+		size_t capacity() const;
+		
+		/// Constructs a SharedPtr whose object and control block are both allocated from this arena
+		template<typename T, typename... Args>
+		SharedPtr<T> newShared(Args&&... args);
+		
+	protected:
+		virtual void* doAllocate(size_t size, size_t alignment) override;
+		virtual void doDeallocate(void* ptr, size_t size, size_t alignment) noexcept override;
+		
+	private:
+		struct Block {
+			Block* next;
+			size_t size;
+		};
+		
+		void* allocateFromNewBlock(size_t size, size_t alignment);
+		
+		Block* _blocks;
+		char* _cursor;
+		char* _end;
+		size_t _blockSize;
+		size_t _capacity;
+	};
+
+
+	/// A standard allocator that allocates from an Arena
+	template<typename T>
+	class ArenaAllocator {
+		template<typename U>
+		friend class ArenaAllocator;
+	public:
+		using value_type = T;
+		
+		inline ArenaAllocator(Arena& arena) noexcept;
+		template<typename U>
+		inline ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept;
+		
+		inline T* allocate(size_t count);
+		inline void deallocate(T* ptr, size_t count) noexcept;
+		
+		inline Arena* arena() const noexcept;
+		
+		template<typename U>
+		inline bool operator==(const ArenaAllocator<U>& allocator) const noexcept;
+		template<typename U>
+		inline bool operator!=(const ArenaAllocator<U>& allocator) const noexcept;
+		
+	private:
+		Arena* _arena;
+	};
+
+
+
+	#pragma mark Arena implementation
+
+	void* Arena::allocate(size_t size, size_t alignment) {
+		uintptr_t cursor = (uintptr_t)_cursor;
+		uintptr_t aligned = (cursor + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+		if(_cursor != nullptr && aligned + size <= (uintptr_t)_end) {
+			_cursor = (char*)(aligned + size);
+			return (void*)aligned;
+		}
+		return allocateFromNewBlock(size, alignment);
+	}
+
+	void Arena::deallocate(void*, size_t, size_t) noexcept {
+		//
+	}
+
+	template<typename T, typename... Args>
+	SharedPtr<T> Arena::newShared(Args&&... args) {
+		return std::allocate_shared<T>(ArenaAllocator<T>(*this), std::forward<Args>(args)...);
+	}
+
+
+
+	#pragma mark ArenaAllocator implementation
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(Arena& arena) noexcept: _arena(&arena) {
+		//
+	}
+
+	template<typename T>
+	template<typename U>
+	ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept: _arena(allocator._arena) {
+		//
+	}
+
+	template<typename T>
+	T* ArenaAllocator<T>::allocate(size_t count) {
+		return static_cast<T*>(_arena->allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	template<typename T>
+	void ArenaAllocator<T>::deallocate(T* ptr, size_t count) noexcept {
+		_arena->deallocate(ptr, sizeof(T) * count, alignof(T));
+	}
+
+	template<typename T>
+	Arena* ArenaAllocator<T>::arena() const noexcept {
+		return _arena;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& allocator) const noexcept {
+		return _arena == allocator._arena;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& allocator) const noexcept {
+		return _arena != allocator._arena;
+	}
+}
@@ -11,6 +11,7 @@
 #include <fgl/data/Common.hpp>
 #include <fgl/data/BasicList.hpp>
 #include <fgl/data/BasicString.hpp>
+#include <fgl/data/MemoryResource.hpp>
 #include <fgl/data/Optional.hpp>
 #include <fgl/data/Stringify.hpp>
 #include <fgl/data/Traits.hpp>
@@ -21,10 +22,10 @@
 #endif
 
 namespace fgl {
-	template<typename T>
-	class ArrayList: public BasicList<std::vector<T>> {
+	template<typename T, typename Allocator = std::allocator<T>>
+	class ArrayList: public BasicList<std::vector<T,Allocator>> {
 	public:
-		using BaseType = std::vector<T>;
+		using BaseType = std::vector<T,Allocator>;
 		using typename BasicList<BaseType>::ValueType;
 		
 		using typename BasicList<BaseType>::value_type;
@@ -72,6 +73,7 @@ namespace fgl {
 		using BaseType::pop_back;
 		using BaseType::erase;
 		using BaseType::clear;
+		using BaseType::get_allocator;
 		
 		static constexpr size_type npos = (size_type)-1;
 		
@@ -102,7 +104,7 @@ namespace fgl {
 		inline OptionalRef<T> maybeRefAt(size_type index);
 		inline OptionalRef<const T> maybeRefAt(size_type index) const;
 		
-		ArrayList<T> slice(size_type offset = 0, size_type count = npos) const;
+		ArrayList slice(size_type offset = 0, size_type count = npos) const;
 		
 		inline void shrinkToFit();
 		
@@ -116,8 +118,8 @@ namespace fgl {
 		inline void popBack();
 		inline T extractBack();
 		
-		ArrayList<T> concat(std::initializer_list<T> items) const&;
-		ArrayList<T> concat(std::initializer_list<T> items) &&;
+		ArrayList concat(std::initializer_list<T> items) const&;
+		ArrayList concat(std::initializer_list<T> items) &&;
 		
 		inline iterator removeAt(size_type pos);
 		inline iterator removeAt(size_type pos, size_type count);
@@ -154,42 +156,43 @@ namespace fgl {
 		inline void unstableSort(Predicate predicate);
 		
 		String toString() const;
+		void toString(StringifyWriter& writer) const;
 	};
 
-	template<typename T, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
-	ArrayList<T> operator+(const ArrayList<T>& left, Collection&& right);
-	template<typename T, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
-	ArrayList<T> operator+(ArrayList<T>&& left, Collection&& right);
-	template<typename T>
-	ArrayList<T> operator+(ArrayList<T>&& left, std::vector<T>&& right);
-	template<typename T>
-	ArrayList<T> operator+(const ArrayList<T>& left, std::vector<T>&& right);
-	template<typename T>
-	ArrayList<T> operator+(ArrayList<T>&& left, const std::vector<T>& right);
+	template<typename T, typename A, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	ArrayList<T,A> operator+(const ArrayList<T,A>& left, Collection&& right);
+	template<typename T, typename A, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, Collection&& right);
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, std::vector<T,A>&& right);
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(const ArrayList<T,A>& left, std::vector<T,A>&& right);
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, const std::vector<T,A>& right);
 	
 	
 	
 #pragma mark ArrayList implementation
 
-	template<typename T>
-	ArrayList<T>::ArrayList(const BaseType& list): BasicList<BaseType>(list) {
+	template<typename T, typename A>
+	ArrayList<T,A>::ArrayList(const BaseType& list): BasicList<BaseType>(list) {
 		//
 	}
 
-	template<typename T>
-	ArrayList<T>::ArrayList(BaseType&& list): BasicList<BaseType>(list) {
+	template<typename T, typename A>
+	ArrayList<T,A>::ArrayList(BaseType&& list): BasicList<BaseType>(list) {
 		//
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename _>
-	ArrayList<T>::ArrayList(Collection&& collection): BasicList<BaseType>(collection.begin(), collection.end()) {
+	ArrayList<T,A>::ArrayList(Collection&& collection): BasicList<BaseType>(collection.begin(), collection.end()) {
 		//
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename Transform, typename _>
-	ArrayList<T>::ArrayList(Collection&& collection, Transform transform) {
+	ArrayList<T,A>::ArrayList(Collection&& collection, Transform transform) {
 		reserve(collection.size());
 		if constexpr(std::is_reference_v<decltype(*collection.begin())>) {
 			for(auto& item : collection) {
@@ -204,9 +207,9 @@ namespace fgl {
 
 	#ifdef __OBJC__
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	ArrayList<T>::ArrayList(NSArray* objcArray, Transform transform) {
+	ArrayList<T,A>::ArrayList(NSArray* objcArray, Transform transform) {
 		reserve((size_type)objcArray.count);
 		for(NSObject* obj in objcArray) {
 			pushBack(transform(obj));
@@ -217,9 +220,9 @@ namespace fgl {
 
 	#ifdef JNIEXPORT
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	ArrayList<T>::ArrayList(JNIEnv* env, jobjectArray javaArray, Transform transform) {
+	ArrayList<T,A>::ArrayList(JNIEnv* env, jobjectArray javaArray, Transform transform) {
 		jsize javaArraySize = env->GetArrayLength(javaArray);
 		reserve((size_type)javaArraySize);
 		for(jsize i=0; i<javaArraySize; i++) {
@@ -231,52 +234,52 @@ namespace fgl {
 
 
 
-	template<typename T>
-	ArrayList<T>& ArrayList<T>::operator=(const BaseType& list) {
+	template<typename T, typename A>
+	ArrayList<T,A>& ArrayList<T,A>::operator=(const BaseType& list) {
 		BaseType::operator=(list);
 		return *this;
 	}
 
-	template<typename T>
-	ArrayList<T>& ArrayList<T>::operator=(BaseType&& list) {
+	template<typename T, typename A>
+	ArrayList<T,A>& ArrayList<T,A>::operator=(BaseType&& list) {
 		BaseType::operator=(list);
 		return *this;
 	}
 
 
 	
-	template<typename T>
-	constexpr typename ArrayList<T>::reference ArrayList<T>::operator[](size_type index) noexcept {
+	template<typename T, typename A>
+	constexpr typename ArrayList<T,A>::reference ArrayList<T,A>::operator[](size_type index) noexcept {
 		FGL_ASSERT(index >= 0 && index < size(), "index out of bounds");
 		return BaseType::operator[](index);
 	}
 	
-	template<typename T>
-	constexpr typename ArrayList<T>::const_reference ArrayList<T>::operator[](size_type index) const noexcept {
+	template<typename T, typename A>
+	constexpr typename ArrayList<T,A>::const_reference ArrayList<T,A>::operator[](size_type index) const noexcept {
 		FGL_ASSERT(index >= 0 && index < size(), "index out of bounds");
 		return BaseType::operator[](index);
 	}
 
 
 
-	template<typename T>
-	Optional<T> ArrayList<T>::maybeAt(size_type index) const {
+	template<typename T, typename A>
+	Optional<T> ArrayList<T,A>::maybeAt(size_type index) const {
 		if(index >= size()) {
 			return std::nullopt;
 		}
 		return BaseType::operator[](index);
 	}
 	
-	template<typename T>
-	OptionalRef<T> ArrayList<T>::maybeRefAt(size_type index) {
+	template<typename T, typename A>
+	OptionalRef<T> ArrayList<T,A>::maybeRefAt(size_type index) {
 		if(index >= size()) {
 			return std::nullopt;
 		}
 		return std::ref<T>(BaseType::operator[](index));
 	}
 	
-	template<typename T>
-	OptionalRef<const T> ArrayList<T>::maybeRefAt(size_type index) const {
+	template<typename T, typename A>
+	OptionalRef<const T> ArrayList<T,A>::maybeRefAt(size_type index) const {
 		if(index >= size()) {
 			return std::nullopt;
 		}
@@ -285,63 +288,66 @@ namespace fgl {
 
 
 
-	template<typename T>
-	ArrayList<T> ArrayList<T>::slice(size_type offset, size_type count) const {
-		ArrayList<T> sublist;
-		sublist.reserve(std::min(size(), count));
+	template<typename T, typename A>
+	ArrayList<T,A> ArrayList<T,A>::slice(size_type offset, size_type count) const {
+		ArrayList<T,A> sublist(get_allocator());
+		if(offset >= size()) {
+			return sublist;
+		}
+		sublist.reserve(std::min(size() - offset, count));
 		for(size_t i=offset; i<size() && sublist.size() < count; i++) {
-			sublist.pushBack(BaseType::operator[](offset));
+			sublist.pushBack(BaseType::operator[](i));
 		}
 		return sublist;
 	}
 	
 	
 	
-	template<typename T>
-	void ArrayList<T>::shrinkToFit() {
+	template<typename T, typename A>
+	void ArrayList<T,A>::shrinkToFit() {
 		shrink_to_fit();
 	}
 	
 	
 	
-	template<typename T>
-	void ArrayList<T>::pushBack(const T& value) {
+	template<typename T, typename A>
+	void ArrayList<T,A>::pushBack(const T& value) {
 		push_back(value);
 	}
 	
-	template<typename T>
-	void ArrayList<T>::pushBack(T&& value) {
-		push_back(value);
+	template<typename T, typename A>
+	void ArrayList<T,A>::pushBack(T&& value) {
+		push_back(std::move(value));
 	}
 	
-	template<typename T>
-	void ArrayList<T>::pushBackList(const ArrayList<T>& list) {
+	template<typename T, typename A>
+	void ArrayList<T,A>::pushBackList(const ArrayList<T,A>& list) {
 		insert(end(), list.begin(), list.end());
 	}
-	template<typename T>
-	void ArrayList<T>::pushBackList(ArrayList<T>&& list) {
+	template<typename T, typename A>
+	void ArrayList<T,A>::pushBackList(ArrayList<T,A>&& list) {
 		insert(end(), std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
 	}
 
-	template<typename T>
-	void ArrayList<T>::pushBackList(std::initializer_list<T> list) {
+	template<typename T, typename A>
+	void ArrayList<T,A>::pushBackList(std::initializer_list<T> list) {
 		insert(end(), std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename _>
-	void ArrayList<T>::pushBackList(Collection&& collection) {
+	void ArrayList<T,A>::pushBackList(Collection&& collection) {
 		insert(end(), collection.begin(), collection.end());
 	}
 	
-	template<typename T>
-	void ArrayList<T>::popBack() {
+	template<typename T, typename A>
+	void ArrayList<T,A>::popBack() {
 		FGL_ASSERT(size() > 0, "cannot call popBack on empty array");
 		pop_back();
 	}
 	
-	template<typename T>
-	T ArrayList<T>::extractBack() {
+	template<typename T, typename A>
+	T ArrayList<T,A>::extractBack() {
 		FGL_ASSERT(size() > 0, "cannot call extractBack on empty array");
 		auto value = std::move(back());
 		pop_back();
@@ -350,15 +356,15 @@ namespace fgl {
 
 
 
-	template<typename T>
-	ArrayList<T> ArrayList<T>::concat(std::initializer_list<T> list) const& {
+	template<typename T, typename A>
+	ArrayList<T,A> ArrayList<T,A>::concat(std::initializer_list<T> list) const& {
 		auto newList = *this;
 		newList.pushBackList(list);
 		return newList;
 	}
 
-	template<typename T>
-	ArrayList<T> ArrayList<T>::concat(std::initializer_list<T> list) && {
+	template<typename T, typename A>
+	ArrayList<T,A> ArrayList<T,A>::concat(std::initializer_list<T> list) && {
 		auto newList = std::move(*this);
 		newList.pushBackList(list);
 		return std::move(newList);
@@ -366,19 +372,19 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
-	typename ArrayList<T>::iterator ArrayList<T>::removeAt(size_type pos) {
+	template<typename T, typename A>
+	typename ArrayList<T,A>::iterator ArrayList<T,A>::removeAt(size_type pos) {
 		return erase(begin()+pos);
 	}
 	
-	template<typename T>
-	typename ArrayList<T>::iterator ArrayList<T>::removeAt(size_type pos, size_type count) {
+	template<typename T, typename A>
+	typename ArrayList<T,A>::iterator ArrayList<T,A>::removeAt(size_type pos, size_type count) {
 		auto start = begin() + pos;
 		return erase(start, start+count);
 	}
 	
-	template<typename T>
-	typename ArrayList<T>::size_type ArrayList<T>::removeEqual(const T& value) {
+	template<typename T, typename A>
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::removeEqual(const T& value) {
 		size_type removeCount = 0;
 		size_t firstRemoveIndex = -1;
 		for(size_t i=(size()-1); i!=-1; i--) {
@@ -401,8 +407,8 @@ namespace fgl {
 		return removeCount;
 	}
 	
-	template<typename T>
-	bool ArrayList<T>::removeFirstEqual(const T& value) {
+	template<typename T, typename A>
+	bool ArrayList<T,A>::removeFirstEqual(const T& value) {
 		auto it = findEqual(value);
 		if(it == end()) {
 			return false;
@@ -411,8 +417,8 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename T>
-	bool ArrayList<T>::removeLastEqual(const T& value) {
+	template<typename T, typename A>
+	bool ArrayList<T,A>::removeLastEqual(const T& value) {
 		auto it = findLastEqual(value);
 		if(it == end()) {
 			return false;
@@ -421,9 +427,9 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	typename ArrayList<T>::size_type ArrayList<T>::removeWhere(Predicate predicate) {
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::removeWhere(Predicate predicate) {
 		size_type removeCount = 0;
 		size_t firstRemoveIndex = -1;
 		for(size_t i=(size()-1); i!=-1; i--) {
@@ -446,9 +452,9 @@ namespace fgl {
 		return removeCount;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	bool ArrayList<T>::removeFirstWhere(Predicate predicate) {
+	bool ArrayList<T,A>::removeFirstWhere(Predicate predicate) {
 		auto it = findWhere(predicate);
 		if(it == end()) {
 			return false;
@@ -457,9 +463,9 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	bool ArrayList<T>::removeLastWhere(Predicate predicate) {
+	bool ArrayList<T,A>::removeLastWhere(Predicate predicate) {
 		auto it = findLastWhere(predicate);
 		if(it == end()) {
 			return false;
@@ -470,37 +476,37 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
-	typename ArrayList<T>::size_type ArrayList<T>::indexOf(const T& value) const {
+	template<typename T, typename A>
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::indexOf(const T& value) const {
 		return findEqual(value) - begin();
 	}
 	
-	template<typename T>
-	typename ArrayList<T>::size_type ArrayList<T>::lastIndexOf(const T& value) const {
+	template<typename T, typename A>
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::lastIndexOf(const T& value) const {
 		return findLastEqual(value) - begin();
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	typename ArrayList<T>::size_type ArrayList<T>::indexWhere(Predicate predicate) const {
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::indexWhere(Predicate predicate) const {
 		return findWhere(predicate) - begin();
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	typename ArrayList<T>::size_type ArrayList<T>::lastIndexWhere(Predicate predicate) const {
+	typename ArrayList<T,A>::size_type ArrayList<T,A>::lastIndexWhere(Predicate predicate) const {
 		return findLastWhere(predicate) - begin();
 	}
 
 
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	ArrayList<T> ArrayList<T>::where(Predicate predicate) const {
-		std::list<T> newList;
+	ArrayList<T,A> ArrayList<T,A>::where(Predicate predicate) const {
+		ArrayList<T,A> newList(get_allocator());
 		for(const_reference item : *this) {
 			if(predicate(item)) {
-				newList.push_back(item);
+				newList.pushBack(item);
 			}
 		}
 		return newList;
@@ -508,11 +514,13 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	auto ArrayList<T>::map(Transform transform) {
+	auto ArrayList<T,A>::map(Transform transform) {
 		using ReturnType = decltype(transform(front()));
-		ArrayList<ReturnType> newArray;
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		ArrayList<ReturnType,ReturnAllocator> newArray(allocator);
 		newArray.reserve(size());
 		for(reference item : *this) {
 			newArray.pushBack(transform(item));
@@ -520,11 +528,13 @@ namespace fgl {
 		return newArray;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	auto ArrayList<T>::map(Transform transform) const {
+	auto ArrayList<T,A>::map(Transform transform) const {
 		using ReturnType = decltype(transform(front()));
-		ArrayList<ReturnType> newArray;
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		ArrayList<ReturnType,ReturnAllocator> newArray(allocator);
 		newArray.reserve(size());
 		for(const_reference item : *this) {
 			newArray.pushBack(transform(item));
@@ -534,80 +544,96 @@ namespace fgl {
 
 
 
-	template<typename T>
-	void ArrayList<T>::sort() {
+	template<typename T, typename A>
+	void ArrayList<T,A>::sort() {
 		std::stable_sort(begin(), end());
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	void ArrayList<T>::sort(Predicate predicate) {
+	void ArrayList<T,A>::sort(Predicate predicate) {
 		std::stable_sort(begin(), end(), predicate);
 	}
 	
-	template<typename T>
-	void ArrayList<T>::unstableSort() {
+	template<typename T, typename A>
+	void ArrayList<T,A>::unstableSort() {
 		std::sort(begin(), end());
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	void ArrayList<T>::unstableSort(Predicate predicate) {
+	void ArrayList<T,A>::unstableSort(Predicate predicate) {
 		std::sort(begin(), end(), predicate);
 	}
 
 
 
-	template<typename T>
-	String ArrayList<T>::toString() const {
+	template<typename T, typename A>
+	String ArrayList<T,A>::toString() const {
+		String str;
+		StringifyWriter writer(str);
+		toString(writer);
+		return str;
+	}
+
+	template<typename T, typename A>
+	void ArrayList<T,A>::toString(StringifyWriter& writer) const {
+		writer.write("ArrayList<");
+		writer.write(stringify_type<T>());
 		if(size() == 0) {
-			return String::join({"ArrayList<", stringify_type<T>(), ">[]"});
+			writer.write(">[]");
+			return;
 		}
-		return String::join({
-			"ArrayList<", stringify_type<T>(), ">[\n\t",
-			String::join(map([](const_reference item) -> String {
-				return stringify<T>(item);
-			}), ",\n\t"), "\n]" });
+		writer.writeItems(begin(), end(), ">[\n\t", ",\n\t", "\n]", [&](const_reference item) {
+			stringifyTo<T>(writer, item);
+		});
 	}
 	
 	
 	
-	template<typename T, typename Collection, typename _>
-	ArrayList<T> operator+(const ArrayList<T>& left, Collection&& right) {
-		ArrayList<T> newList;
+	template<typename T, typename A, typename Collection, typename _>
+	ArrayList<T,A> operator+(const ArrayList<T,A>& left, Collection&& right) {
+		ArrayList<T,A> newList(left.get_allocator());
 		newList.reserve(left.size() + right.size());
 		newList.pushBackList(left);
 		newList.pushBackList(std::forward<Collection>(right));
 		return newList;
 	}
 
-	template<typename T, typename Collection, typename _>
-	ArrayList<T> operator+(ArrayList<T>&& left, Collection&& right) {
+	template<typename T, typename A, typename Collection, typename _>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, Collection&& right) {
 		auto newList = std::move(left);
 		newList.pushBackList(std::forward<Collection>(right));
 		return newList;
 	}
 
-	template<typename T>
-	ArrayList<T> operator+(ArrayList<T>&& left, std::vector<T>&& right) {
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, std::vector<T,A>&& right) {
 		auto newList = std::move(left);
 		newList.pushBackList(right);
 		return newList;
 	}
 
-	template<typename T>
-	ArrayList<T> operator+(const ArrayList<T>& left, std::vector<T>&& right) {
-		ArrayList<T> newList;
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(const ArrayList<T,A>& left, std::vector<T,A>&& right) {
+		ArrayList<T,A> newList(left.get_allocator());
 		newList.reserve(left.size() + right.size());
 		newList.pushBackList(left);
 		newList.pushBackList(right);
 		return newList;
 	}
 
-	template<typename T>
-	ArrayList<T> operator+(ArrayList<T>&& left, const std::vector<T>& right) {
+	template<typename T, typename A>
+	ArrayList<T,A> operator+(ArrayList<T,A>&& left, const std::vector<T,A>& right) {
 		auto newList = std::move(left);
 		newList.pushBackList(right);
 		return newList;
 	}
+
+
+
+	namespace pmr {
+		template<typename T>
+		using ArrayList = fgl::ArrayList<T,PolymorphicAllocator<T>>;
+	}
 }
@@ -10,6 +10,8 @@
 
 #include <fgl/data/Common.hpp>
 #include <fgl/data/BasicStringUtils.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/NodePool.hpp>
 #include <fgl/data/Optional.hpp>
 #include <fgl/data/Traits.hpp>
 #include <initializer_list>
@@ -23,20 +25,22 @@
 #endif
 
 namespace fgl {
-	template<typename T>
+	template<typename T, typename Allocator = DefaultNodeAllocator<T>>
 	class LinkedList;
 
 	template<typename Char>
 	using BasicStringView = std::basic_string_view<Char>;
 
-	template<typename Char>
-	class BasicString: public std::basic_string<Char> {
-		template<typename OtherChar>
+	template<typename Char, typename Allocator>
+	class BasicString: public std::basic_string<Char,std::char_traits<Char>,Allocator> {
+		template<typename OtherChar, typename OtherAllocator>
 		friend class BasicString;
 		friend class BasicStringUtils;
 	public:
 		using CharType = Char;
-		using BaseType = std::basic_string<Char>;
+		using BaseType = std::basic_string<Char,std::char_traits<Char>,Allocator>;
+		using ListType = LinkedList<BasicString<Char,Allocator>,rebind_node_allocator_t<Allocator,BasicString<Char,Allocator>>>;
+		using PooledListType = LinkedList<BasicString<Char,Allocator>,PoolAllocator<BasicString<Char,Allocator>>>;
 		
 		using typename BaseType::size_type;
 		using typename BaseType::reference;
@@ -66,6 +70,7 @@ namespace fgl {
 		using BaseType::substr;
 		using BaseType::find;
 		using BaseType::replace;
+		using BaseType::get_allocator;
 		using BaseType::operator std::basic_string_view<Char>;
 		
 		BasicString(const BaseType&);
@@ -137,9 +142,9 @@ namespace fgl {
 		
 		
 		inline explicit operator const Char*() const noexcept;
-		inline operator std::basic_string<Char>&() & noexcept;
-		inline operator std::basic_string<Char>&&() && noexcept;
-		inline operator const std::basic_string<Char>&() const& noexcept;
+		inline operator BaseType&() & noexcept;
+		inline operator BaseType&&() && noexcept;
+		inline operator const BaseType&() const& noexcept;
 		
 		
 		#ifdef __OBJC__
@@ -196,42 +201,42 @@ namespace fgl {
 		
 		
 		
-		BasicString<Char>& operator=(const BaseType&);
-		BasicString<Char>& operator=(BaseType&&);
+		BasicString<Char,Allocator>& operator=(const BaseType&);
+		BasicString<Char,Allocator>& operator=(BaseType&&);
 		
 		#ifdef __OBJC__
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char, Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator=(NSString* nsString);
+		BasicString<Char,Allocator>& operator=(NSString* nsString);
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char, Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator=(NSString* nsString);
+		BasicString<Char,Allocator>& operator=(NSString* nsString);
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char, Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator=(NSString* nsString);
+		BasicString<Char,Allocator>& operator=(NSString* nsString);
 		#endif
 		
 		template<typename OtherChar,
 			typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const OtherChar* str);
+		inline BasicString<Char,Allocator>& operator=(const OtherChar* str);
 		template<typename OtherChar,
 			typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const OtherChar* str);
+		inline BasicString<Char,Allocator>& operator=(const OtherChar* str);
 		
 		template<typename OtherChar, typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const BasicString<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator=(const BasicString<OtherChar>& str);
 		template<typename OtherChar, typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const BasicString<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator=(const BasicString<OtherChar>& str);
 		template<typename OtherChar, typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const std::basic_string<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator=(const std::basic_string<OtherChar>& str);
 		template<typename OtherChar, typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator=(const std::basic_string<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator=(const std::basic_string<OtherChar>& str);
 		
 		
 		
@@ -240,62 +245,62 @@ namespace fgl {
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator+=(NSString* nsString);
+		BasicString<Char,Allocator>& operator+=(NSString* nsString);
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator+=(NSString* nsString);
+		BasicString<Char,Allocator>& operator+=(NSString* nsString);
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 				&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type = nullptr>
-		BasicString<Char>& operator+=(NSString* nsString);
+		BasicString<Char,Allocator>& operator+=(NSString* nsString);
 		#endif
 		
 		template<typename OtherChar,
 			typename BasicStringUtils::same_size_convertable_with_char_type<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(OtherChar c);
+		inline BasicString<Char,Allocator>& operator+=(OtherChar c);
 		template<typename OtherChar,
 			typename BasicStringUtils::diff_size_convertable_with_char_type<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(OtherChar c);
+		inline BasicString<Char,Allocator>& operator+=(OtherChar c);
 		
 		template<typename OtherChar,
 			typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const OtherChar* str);
+		inline BasicString<Char,Allocator>& operator+=(const OtherChar* str);
 		template<typename OtherChar,
 			typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const OtherChar* str);
+		inline BasicString<Char,Allocator>& operator+=(const OtherChar* str);
 		
 		template<typename OtherChar,
 			typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const BasicString<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator+=(const BasicString<OtherChar>& str);
 		template<typename OtherChar,
 			typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const BasicString<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator+=(const BasicString<OtherChar>& str);
 		template<typename OtherChar,
 			typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const std::basic_string<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator+=(const std::basic_string<OtherChar>& str);
 		template<typename OtherChar,
 			typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(const std::basic_string<OtherChar>& str);
+		inline BasicString<Char,Allocator>& operator+=(const std::basic_string<OtherChar>& str);
 		
 		template<typename Bool,
 			typename BasicStringUtils::string_type_convertable_with_bool<Char,Bool>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(Bool);
+		inline BasicString<Char,Allocator>& operator+=(Bool);
 		template<typename Num,
 			typename BasicStringUtils::string_type_convertable_with_number_or_enum<Char,Num>::null_type = nullptr>
-		inline BasicString<Char>& operator+=(Num);
+		inline BasicString<Char,Allocator>& operator+=(Num);
 		
 		
 		
 		inline int compare(const Char* cmp, size_type length, const std::locale& locale) const;
 		inline int compare(const Char* cmp, const std::locale& locale) const;
-		inline int compare(const std::basic_string<Char>& cmp, const std::locale& locale) const;
+		inline int compare(const BaseType& cmp, const std::locale& locale) const;
 		
 		constexpr bool equals(const Char* str, size_type length) const;
 		inline bool equals(const Char* str) const;
-		inline bool equals(const std::basic_string<Char>& str) const;
+		inline bool equals(const BaseType& str) const;
 		
 		
 		
@@ -306,54 +311,58 @@ namespace fgl {
 		inline const_reference charAt(size_type index) const;
 		
 		inline size_type indexOf(Char find, size_type startIndex=0) const noexcept;
-		inline size_type indexOf(const std::basic_string<Char>& find, size_type startIndex=0) const noexcept;
+		inline size_type indexOf(const BaseType& find, size_type startIndex=0) const noexcept;
 		inline size_type indexOf(const Char* find, size_type startIndex=0) const;
 		inline size_type lastIndexOf(Char find, size_type startIndex = npos) const noexcept;
-		inline size_type lastIndexOf(const std::basic_string<Char>& find, size_type startIndex = npos) const noexcept;
+		inline size_type lastIndexOf(const BaseType& find, size_type startIndex = npos) const noexcept;
 		inline size_type lastIndexOf(const Char* find, size_type startIndex = npos) const;
 		
 		inline bool contains(Char find) const noexcept;
-		inline bool contains(const std::basic_string<Char>& find) const noexcept;
+		inline bool contains(const BaseType& find) const noexcept;
 		inline bool contains(const Char* find) const;
 		template<typename Predicate>
 		inline bool containsWhere(Predicate) const;
 		
 		bool startsWith(const Char* str, size_type length) const;
 		inline bool startsWith(const Char* str) const;
-		inline bool startsWith(const std::basic_string<Char>& str) const;
+		inline bool startsWith(const BaseType& str) const;
 		bool endsWith(const Char* str, size_type length) const;
 		inline bool endsWith(const Char* str) const;
-		inline bool endsWith(const std::basic_string<Char>& str) const;
+		inline bool endsWith(const BaseType& str) const;
 		
 		
 		
-		BasicString<Char> replacing(Char find, Char replace) const;
-		BasicString<Char> replacing(const std::basic_string<Char>& find, const std::basic_string<Char>& replace) const;
-		inline BasicString<Char> replacing(const std::basic_regex<Char>& find, const std::basic_string<Char>& replace, std::regex_constants::match_flag_type flags = std::regex_constants::match_default) const;
+		BasicString<Char,Allocator> replacing(Char find, Char replace) const;
+		BasicString<Char,Allocator> replacing(const BaseType& find, const BaseType& replace) const;
+		inline BasicString<Char,Allocator> replacing(const std::basic_regex<Char>& find, const BaseType& replace, std::regex_constants::match_flag_type flags = std::regex_constants::match_default) const;
 		template<typename InputIt>
-		BasicString<Char> replacing(size_type startIndex, size_type count, InputIt first, InputIt last) const;
-		inline BasicString<Char> replacing(size_type startIndex, size_type count, const std::basic_string<Char>& replace) const;
+		BasicString<Char,Allocator> replacing(size_type startIndex, size_type count, InputIt first, InputIt last) const;
+		inline BasicString<Char,Allocator> replacing(size_type startIndex, size_type count, const BaseType& replace) const;
 
-		inline BasicString<Char> substring(size_type startIndex = 0, size_type count = npos) const;
+		inline BasicString<Char,Allocator> substring(size_type startIndex = 0, size_type count = npos) const;
 		inline BasicStringView<Char> viewSubstring(size_type startIndex, size_type count = npos) const;
 		
-		LinkedList<BasicString<Char>> split(Char delim) const;
-		LinkedList<BasicString<Char>> split(const Char* delim) const;
-		LinkedList<BasicString<Char>> split(const std::basic_string<Char>& delim) const;
+		ListType split(Char delim) const;
+		ListType split(const Char* delim) const;
+		ListType split(const BaseType& delim) const;
+		/// Splits the same way as split, but the list's nodes come from the NodePool, whatever the default node allocator is
+		PooledListType splitPooled(Char delim) const;
+		PooledListType splitPooled(const Char* delim) const;
+		PooledListType splitPooled(const BaseType& delim) const;
 		
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename BasicStringUtils::can_convert_string_type<_Char>::null_type = nullptr>
-		BasicString<Char> trim(const std::locale& locale = std::locale()) const;
+		BasicString<Char,Allocator> trim(const std::locale& locale = std::locale()) const;
 		
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename BasicStringUtils::can_convert_string_type<_Char>::null_type = nullptr>
-		BasicString<Char> toLowerCase(const std::locale& locale = std::locale()) const;
+		BasicString<Char,Allocator> toLowerCase(const std::locale& locale = std::locale()) const;
 		template<typename _Char=Char,
 			typename BasicStringUtils::is_same<_Char,Char>::null_type = nullptr,
 			typename BasicStringUtils::can_convert_string_type<_Char>::null_type = nullptr>
-		BasicString<Char> toUpperCase(const std::locale& locale = std::locale()) const;
+		BasicString<Char,Allocator> toUpperCase(const std::locale& locale = std::locale()) const;
 		
 		template<typename Num,
 			typename BasicStringUtils::string_type_convertable_with_number<Char,Num>::null_type = nullptr>
@@ -365,21 +374,31 @@ namespace fgl {
 		
 		
 		
-		static bool isNullOrEmpty(const Optional<BasicString<Char>>& str);
+		static bool isNullOrEmpty(const Optional<BasicString<Char,Allocator>>& str);
 		
-		template<typename Collection, typename = IsCollectionOf<BasicString<Char>,std::remove_reference_t<Collection>>>
-		static BasicString<Char> join(Collection&& collection, const BasicString<Char>& separator = BasicString<Char>());
-		static BasicString<Char> join(std::initializer_list<BasicString<Char>> list, const BasicString<Char>& separator = BasicString<Char>());
+		template<typename Collection, typename = IsCollectionOf<BasicString<Char,Allocator>,std::remove_reference_t<Collection>>>
+		static BasicString<Char,Allocator> join(Collection&& collection, const BasicString<Char,Allocator>& separator = BasicString<Char,Allocator>());
+		static BasicString<Char,Allocator> join(std::initializer_list<BasicString<Char,Allocator>> list, const BasicString<Char,Allocator>& separator = BasicString<Char,Allocator>());
 		
-		static BasicString<Char> random(size_t length, const std::vector<Char>& charSet);
-		static BasicString<Char> random(size_t length, const std::string& charSet);
+		static BasicString<Char,Allocator> random(size_t length, const std::vector<Char>& charSet);
+		static BasicString<Char,Allocator> random(size_t length, const std::string& charSet);
+		/// A string of hex digits encoding byteCount bytes from std::random_device, such as for tokens
+		static BasicString<Char,Allocator> randomHex(size_t byteCount);
 
 		template<typename StreamableType>
-		static BasicString<Char> stream(StreamableType streamable) {
+		static BasicString<Char,Allocator> stream(StreamableType streamable) {
 			std::basic_ostringstream<Char> ss;
 			ss << streamable;
 			return ss.str();
 		}
+		
+	private:
+		template<typename List>
+		inline typename List::allocator_type listAllocator() const;
+		template<typename List>
+		List splitAs(Char delim) const;
+		template<typename List>
+		List splitAs(const Char* delim, size_t delimSize) const;
 	};
 
 
@@ -528,4 +547,9 @@ namespace fgl {
 	typedef BasicStringView<std::string_view::value_type> StringView;
 	typedef BasicString<std::wstring::value_type> WideString;
 	typedef BasicStringView<std::wstring_view::value_type> WideStringView;
+
+	namespace pmr {
+		typedef BasicString<std::string::value_type,PolymorphicAllocator<std::string::value_type>> String;
+		typedef BasicString<std::wstring::value_type,PolymorphicAllocator<std::wstring::value_type>> WideString;
+	}
 }
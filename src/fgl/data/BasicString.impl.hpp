@@ -9,10 +9,13 @@
 #pragma once
 
 #include <fgl/data/BasicString.hpp>
+#include <fgl/data/ByteEncoding.hpp>
 #include <fgl/data/LinkedList.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <type_traits>
 
@@ -21,25 +24,25 @@
 #endif
 
 namespace fgl {
-	template<typename Char>
-	BasicString<Char>::BasicString(const BaseType& str): BaseType(str) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::BasicString(const BaseType& str): BaseType(str) {
 		//
 	}
 
-	template<typename Char>
-	BasicString<Char>::BasicString(BaseType&& str): BaseType(str) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::BasicString(BaseType&& str): BaseType(std::move(str)) {
 		//
 	}
 
 
 	#ifdef __OBJC__
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>::BasicString(NSString* nsString) {
+	BasicString<Char,Allocator>::BasicString(NSString* nsString) {
 		if(nsString == nil) {
 			return;
 		}
@@ -50,22 +53,22 @@ namespace fgl {
 		[nsString getCharacters:(unichar*)((Char*)data()) range:range];
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>::BasicString(NSString* nsString)
+	BasicString<Char,Allocator>::BasicString(NSString* nsString)
 	: BaseType((nsString != nil) ? (const Char*)[nsString UTF8String] : "") {
 		//
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>::BasicString(NSString* nsString) {
+	BasicString<Char,Allocator>::BasicString(NSString* nsString) {
 		if(nsString == nil) {
 			return;
 		}
@@ -80,8 +83,8 @@ namespace fgl {
 
 	#ifdef JNIEXPORT
 
-	template<typename Char>
-	BasicString<Char>::BasicString(JNIEnv* env, jstring javaString) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::BasicString(JNIEnv* env, jstring javaString) {
 		const char* javaStringChars = env->GetStringUTFChars(javaString, nullptr);
 		operator=(javaStringChars);
 		env->ReleaseStringUTFChars(javaString, javaStringChars);
@@ -91,8 +94,8 @@ namespace fgl {
 
 	#ifdef NODE_API_MODULE
 	
-	template<typename Char>
-	BasicString<Char>::BasicString(Napi::String napiString) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::BasicString(Napi::String napiString) {
 		if(napiString.IsEmpty() || napiString.IsNull() || napiString.IsUndefined()) {
 			return;
 		}
@@ -103,8 +106,8 @@ namespace fgl {
 
 	#ifdef NAPI_MODULE
 
-	template<typename Char>
-	BasicString<Char>::BasicString(napi_env env, napi_value value) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::BasicString(napi_env env, napi_value value) {
 		if(value == nullptr) {
 			return;
 		}
@@ -121,146 +124,146 @@ namespace fgl {
 	#endif
 
 
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const OtherChar* str, size_type length)
+	BasicString<Char,Allocator>::BasicString(const OtherChar* str, size_type length)
 	: BaseType((const Char*)str, length) {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const OtherChar* str, size_type length)
+	BasicString<Char,Allocator>::BasicString(const OtherChar* str, size_type length)
 	: BaseType(BasicStringUtils::convert<Char,OtherChar>(str, length)) {
 		//
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const OtherChar* str)
+	BasicString<Char,Allocator>::BasicString(const OtherChar* str)
 	: BaseType((const Char*)str) {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		// same char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const OtherChar* str)
+	BasicString<Char,Allocator>::BasicString(const OtherChar* str)
 	: BaseType(BasicStringUtils::convert<Char,OtherChar>(str, BasicStringUtils::strlen<OtherChar>(str))) {
 		// different char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const BasicString<OtherChar>& str)
+	BasicString<Char,Allocator>::BasicString(const BasicString<OtherChar>& str)
 	: BaseType(str) {
 		// same char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(BasicString<OtherChar>&& str)
+	BasicString<Char,Allocator>::BasicString(BasicString<OtherChar>&& str)
 	: BaseType(str) {
 		// same char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const BasicString<OtherChar>& str)
+	BasicString<Char,Allocator>::BasicString(const BasicString<OtherChar>& str)
 	: BaseType(BasicStringUtils::convert<Char,OtherChar>(str.data(), str.length())) {
 		// different char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const std::basic_string<OtherChar>& str)
+	BasicString<Char,Allocator>::BasicString(const std::basic_string<OtherChar>& str)
 	: BaseType(str) {
 		// same char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 	typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(std::basic_string<OtherChar>&& str)
+	BasicString<Char,Allocator>::BasicString(std::basic_string<OtherChar>&& str)
 	: BaseType(str) {
 		// same char size
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>::BasicString(const std::basic_string<OtherChar>& str)
+	BasicString<Char,Allocator>::BasicString(const std::basic_string<OtherChar>& str)
 	: BaseType(BasicStringUtils::convert<Char,OtherChar>(str.data(), str.length())) {
 		// different char size
 	}
 	
 	
 	
-	template<typename Char>
-	BasicString<Char>::operator const Char*() const noexcept {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::operator const Char*() const noexcept {
 		return c_str();
 	}
 	
-	template<typename Char>
-	BasicString<Char>::operator std::basic_string<Char>&() & noexcept {
-		return (std::basic_string<Char>&)*this;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::operator BaseType&() & noexcept {
+		return (BaseType&)*this;
 	}
 
-	template<typename Char>
-	BasicString<Char>::operator std::basic_string<Char>&&() && noexcept {
-		return (std::basic_string<Char>&&)*this;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::operator BaseType&&() && noexcept {
+		return (BaseType&&)*this;
 	}
 	
-	template<typename Char>
-	BasicString<Char>::operator const std::basic_string<Char>&() const& noexcept {
-		return (const std::basic_string<Char>&)*this;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>::operator const BaseType&() const& noexcept {
+		return (const BaseType&)*this;
 	}
 	
 	
 	
 	#ifdef __OBJC__
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	NSString* BasicString<Char>::toNSString() const {
+	NSString* BasicString<Char,Allocator>::toNSString() const {
 		return [NSString stringWithCharacters:(const unichar*)data() length:(NSUInteger)length()];
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type>
-	NSString* BasicString<Char>::toNSString() const {
+	NSString* BasicString<Char,Allocator>::toNSString() const {
 		return [NSString stringWithUTF8String:(const char*)data()];
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	NSString* BasicString<Char>::toNSString() const {
+	NSString* BasicString<Char,Allocator>::toNSString() const {
 		auto output = BasicStringUtils::convert<unichar,Char>(data(), length());
 		return [NSString stringWithCharacters:(const unichar*)output.c_str() length:(NSUInteger)output.length()];
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename BasicStringUtils::can_convert_string_type<_Char>::null_type>
-	BasicString<Char>::operator NSString*() const {
+	BasicString<Char,Allocator>::operator NSString*() const {
 		return toNSString();
 	}
 	
@@ -268,8 +271,8 @@ namespace fgl {
 
 	#ifdef JNIEXPORT
 
-	template<typename Char>
-	jstring BasicString<Char>::toJavaString(JNIEnv* env) const {
+	template<typename Char, typename Allocator>
+	jstring BasicString<Char,Allocator>::toJavaString(JNIEnv* env) const {
 		if constexpr(std::is_same<Char,char>::value) {
 			return env->NewStringUTF(c_str());
 		} else {
@@ -281,8 +284,8 @@ namespace fgl {
 
 	#ifdef NODE_API_MODULE
 
-	template<typename Char>
-	Napi::String BasicString<Char>::toNapiString(napi_env env) const {
+	template<typename Char, typename Allocator>
+	Napi::String BasicString<Char,Allocator>::toNapiString(napi_env env) const {
 		return Napi::String::New(env, *this);
 	}
 
@@ -290,8 +293,8 @@ namespace fgl {
 
 	#ifdef NAPI_MODULE
 
-	template<typename Char>
-	napi_value BasicString<Char>::toNodeJSValue(napi_env env) const {
+	template<typename Char, typename Allocator>
+	napi_value BasicString<Char,Allocator>::toNodeJSValue(napi_env env) const {
 		if constexpr(sizeof(Char) == 1 && std::is_integral<Char>::value) {
 			napi_value value = nullptr;
 			DATACPP_NAPI_CALL(env, "failed to create napi_value", napi_create_string_utf8(env, data(), length(), &value));
@@ -306,69 +309,71 @@ namespace fgl {
 
 	#endif
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	std::basic_string<OtherChar> BasicString<Char>::toStdString() const {
+	std::basic_string<OtherChar> BasicString<Char,Allocator>::toStdString() const {
 		// same char size
 		return std::basic_string<OtherChar>((const OtherChar*)data(), length());
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	std::basic_string<OtherChar> BasicString<Char>::toStdString() const {
+	std::basic_string<OtherChar> BasicString<Char,Allocator>::toStdString() const {
 		// different char size
 		return BasicStringUtils::convert<OtherChar,Char>(data(), length());
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename SameChar,
 		typename BasicStringUtils::is_same<Char,SameChar>::null_type>
-	std::basic_string<SameChar> BasicString<Char>::toStdString() const {
+	std::basic_string<SameChar> BasicString<Char,Allocator>::toStdString() const {
 		// same char
 		return std::basic_string<SameChar>(data(), length());
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename SomeChar,
 		typename BasicStringUtils::can_convert_string_types<Char,SomeChar>::null_type>
-	BasicString<SomeChar> BasicString<Char>::toBasicString() const {
+	BasicString<SomeChar> BasicString<Char,Allocator>::toBasicString() const {
 		return BasicString<SomeChar>(data(), length());
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::can_convert_string_types<Char,char>::null_type>
-	BasicString<char> BasicString<Char>::toString() const {
-		if constexpr(std::is_same<Char,char>::value) {
+	BasicString<char> BasicString<Char,Allocator>::toString() const {
+		if constexpr(std::is_same<BasicString<Char,Allocator>,BasicString<char>>::value) {
 			return *this;
+		} else if constexpr(std::is_same<Char,char>::value) {
+			return BasicString<char>(data(), length());
 		}
 		return BasicStringUtils::convert<char,Char>(data(), length());
 	}
 	
 	
 
-	template<typename Char>
-	BasicString<Char>& BasicString<Char>::operator=(const BaseType& str) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const BaseType& str) {
 		BaseType::operator=(str);
 		return *this;
 	}
 
-	template<typename Char>
-	BasicString<Char>& BasicString<Char>::operator=(BaseType&& str) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(BaseType&& str) {
 		BaseType::operator=(str);
 		return *this;
 	}
 	
 	#ifdef __OBJC__
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(NSString* nsString) {
 		if(nsString == nil) {
 			clear();
 			return *this;
@@ -381,12 +386,12 @@ namespace fgl {
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(NSString* nsString) {
 		if(nsString == nil) {
 			clear();
 			return *this;
@@ -395,12 +400,12 @@ namespace fgl {
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(NSString* nsString) {
 		if(nsString == nil) {
 			clear();
 			return *this;
@@ -418,55 +423,55 @@ namespace fgl {
 	
 	#endif
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const OtherChar* str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const OtherChar* str) {
 		// same char size
 		assign((const Char*)str);
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const OtherChar* str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const OtherChar* str) {
 		// different char size
 		assign(std::move(BasicStringUtils::convert<Char,OtherChar>(str, BasicStringUtils::strlen<OtherChar>(str))));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const BasicString<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const BasicString<OtherChar>& str) {
 		// same char size
 		assign((const Char*)str.data(), str.length());
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const BasicString<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const BasicString<OtherChar>& str) {
 		// different char size
 		assign(std::move(BasicStringUtils::convert<Char,OtherChar>(str.data(), str.length())));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const std::basic_string<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const std::basic_string<OtherChar>& str) {
 		// same char size
 		assign((const Char*)str.c_str(), str.length());
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_strings<Char, OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator=(const std::basic_string<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator=(const std::basic_string<OtherChar>& str) {
 		// different char size
 		assign(std::move(BasicStringUtils::convert<Char,OtherChar>(str.data(), str.length())));
 		return *this;
@@ -477,12 +482,12 @@ namespace fgl {
 
 	#ifdef __OBJC__
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)==sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator+=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(NSString* nsString) {
 		if(nsString == nil) {
 			return *this;
 		}
@@ -495,12 +500,12 @@ namespace fgl {
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(_Char)==sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator+=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(NSString* nsString) {
 		if(nsString == nil) {
 			return *this;
 		}
@@ -508,12 +513,12 @@ namespace fgl {
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char,Char>::null_type,
 		typename std::enable_if<(BasicStringUtils::can_convert_string_type<_Char>::value
 			&& sizeof(unichar)!=sizeof(_Char) && sizeof(_Char)!=sizeof(char)), std::nullptr_t>::type>
-	BasicString<Char>& BasicString<Char>::operator+=(NSString* nsString) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(NSString* nsString) {
 		if(nsString == nil) {
 			return *this;
 		}
@@ -531,84 +536,84 @@ namespace fgl {
 	
 	#endif
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::same_size_convertable_with_char_type<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(OtherChar c) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(OtherChar c) {
 		// same char size
 		append((Char)c);
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar,
 		typename BasicStringUtils::diff_size_convertable_with_char_type<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(OtherChar c) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(OtherChar c) {
 		// different char size
 		append(BasicStringUtils::convert<Char,OtherChar>(std::basic_string<OtherChar>(c).data(), 1));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const OtherChar* str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const OtherChar* str) {
 		// same char size
 		append((const Char*)str, BasicStringUtils::strlen<OtherChar>(str));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const OtherChar* str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const OtherChar* str) {
 		// different char size
 		append(BasicStringUtils::convert<Char,OtherChar>(str, BasicStringUtils::strlen<Char>(str)));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const BasicString<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const BasicString<OtherChar>& str) {
 		// same char size
 		append((const Char*)str.characters, str.size);
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const BasicString<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const BasicString<OtherChar>& str) {
 		// different char size
 		append(BasicStringUtils::convert<Char,OtherChar>(str.characters, str.size));
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::same_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const std::basic_string<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const std::basic_string<OtherChar>& str) {
 		// same char size
 		append((const Char*)str.data(), str.length());
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename OtherChar, typename BasicStringUtils::diff_size_convertable_strings<Char,OtherChar>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(const std::basic_string<OtherChar>& str) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(const std::basic_string<OtherChar>& str) {
 		// different char size
 		auto output = BasicStringUtils::convert<Char,OtherChar>(str.c_str(), str.length());
 		append(output.c_str(), output.length());
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Bool, typename BasicStringUtils::string_type_convertable_with_bool<Char,Bool>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(Bool b) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(Bool b) {
 		auto output = BasicStringUtils::fromBool<Char>(b);
 		append(output.characters, output.size);
 		return *this;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Num, typename BasicStringUtils::string_type_convertable_with_number_or_enum<Char,Num>::null_type>
-	BasicString<Char>& BasicString<Char>::operator+=(Num num) {
+	BasicString<Char,Allocator>& BasicString<Char,Allocator>::operator+=(Num num) {
 		auto output = BasicStringUtils::fromNumber<Char,Num>(num);
 		append(output.c_str(), output.length());
 		return *this;
@@ -617,25 +622,25 @@ namespace fgl {
 	
 	
 
-	template<typename Char>
-	int BasicString<Char>::compare(const Char* cmp, size_type cmp_length, const std::locale& locale) const {
+	template<typename Char, typename Allocator>
+	int BasicString<Char,Allocator>::compare(const Char* cmp, size_type cmp_length, const std::locale& locale) const {
 		FGL_ASSERT(cmp != nullptr, "cmp cannot be null");
 		return std::use_facet<std::collate<Char>>(locale).compare(data(), data()+length(), cmp, cmp+cmp_length);
 	}
 	
-	template<typename Char>
-	int BasicString<Char>::compare(const Char* cmp, const std::locale& locale) const {
+	template<typename Char, typename Allocator>
+	int BasicString<Char,Allocator>::compare(const Char* cmp, const std::locale& locale) const {
 		FGL_ASSERT(cmp != nullptr, "cmp cannot be null");
 		return compare(cmp, BasicStringUtils::strlen<Char>(cmp), locale);
 	}
 	
-	template<typename Char>
-	int BasicString<Char>::compare(const std::basic_string<Char>& cmp, const std::locale& locale) const {
+	template<typename Char, typename Allocator>
+	int BasicString<Char,Allocator>::compare(const BaseType& cmp, const std::locale& locale) const {
 		return compare(cmp.data(), cmp.length(), locale);
 	}
 	
-	template<typename Char>
-	constexpr bool BasicString<Char>::equals(const Char* str, size_type str_length) const {
+	template<typename Char, typename Allocator>
+	constexpr bool BasicString<Char,Allocator>::equals(const Char* str, size_type str_length) const {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		if(length() != str_length) {
 			return false;
@@ -648,101 +653,101 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::equals(const Char* str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::equals(const Char* str) const {
 		return equals(str, BasicStringUtils::strlen<Char>(str));
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::equals(const std::basic_string<Char>& str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::equals(const BaseType& str) const {
 		return equals(str.data(), str.length());
 	}
 
 
 
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::maxSize() const noexcept {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::maxSize() const noexcept {
 		return max_size();
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::reference BasicString<Char>::operator[](size_type index) {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::reference BasicString<Char,Allocator>::operator[](size_type index) {
 		FGL_ASSERT(index >= 0 && index < (length() + 1), "index out of bounds");
 		return BaseType::operator[](index);
 	}
 
-	template<typename Char>
-	typename BasicString<Char>::const_reference BasicString<Char>::operator[](size_type index) const {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::const_reference BasicString<Char,Allocator>::operator[](size_type index) const {
 		FGL_ASSERT(index >= 0 && index < (length() + 1), "index out of bounds");
 		return BaseType::operator[](index);
 	}
 
-	template<typename Char>
-	typename BasicString<Char>::reference BasicString<Char>::charAt(size_type index) {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::reference BasicString<Char,Allocator>::charAt(size_type index) {
 		return at(index);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::const_reference BasicString<Char>::charAt(size_type index) const {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::const_reference BasicString<Char,Allocator>::charAt(size_type index) const {
 		return at(index);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::indexOf(Char c, size_type startIndex) const noexcept {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::indexOf(Char c, size_type startIndex) const noexcept {
 		return find(c, startIndex);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::indexOf(const std::basic_string<Char>& str, size_type startIndex) const noexcept {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::indexOf(const BaseType& str, size_type startIndex) const noexcept {
 		return find(str, startIndex);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::indexOf(const Char* str, size_type startIndex) const {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::indexOf(const Char* str, size_type startIndex) const {
 		FGL_ASSERT(str != nullptr, "find cannot be null");
 		return find(str, startIndex);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::lastIndexOf(Char c, size_type startIndex) const noexcept {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::lastIndexOf(Char c, size_type startIndex) const noexcept {
 		return rfind(c, startIndex);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::lastIndexOf(const std::basic_string<Char>& str, size_type startIndex) const noexcept {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::lastIndexOf(const BaseType& str, size_type startIndex) const noexcept {
 		return rfind(str, startIndex);
 	}
 	
-	template<typename Char>
-	typename BasicString<Char>::size_type BasicString<Char>::lastIndexOf(const Char* str, size_type startIndex) const {
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::size_type BasicString<Char,Allocator>::lastIndexOf(const Char* str, size_type startIndex) const {
 		FGL_ASSERT(str != nullptr, "find cannot be null");
 		return rfind(str, startIndex);
 	}
 
-	template<typename Char>
-	bool BasicString<Char>::contains(Char c) const noexcept {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::contains(Char c) const noexcept {
 		return find(c) != npos;
 	}
 
-	template<typename Char>
-	bool BasicString<Char>::contains(const std::basic_string<Char>& str) const noexcept {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::contains(const BaseType& str) const noexcept {
 		return find(str) != npos;
 	}
 
-	template<typename Char>
-	bool BasicString<Char>::contains(const Char* str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::contains(const Char* str) const {
 		return find(str) != npos;
 	}
 
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Predicate>
-	bool BasicString<Char>::containsWhere(Predicate predicate) const {
+	bool BasicString<Char,Allocator>::containsWhere(Predicate predicate) const {
 		auto endIt = end();
 		return std::find_if(begin(), endIt, predicate) != endIt;
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::startsWith(const Char* str, size_type str_length) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::startsWith(const Char* str, size_type str_length) const {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		if(str_length > length()) {
 			return false;
@@ -755,8 +760,8 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::startsWith(const Char* str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::startsWith(const Char* str) const {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		size_t i = 0;
 		Char c = str[i];
@@ -773,13 +778,13 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::startsWith(const std::basic_string<Char>& str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::startsWith(const BaseType& str) const {
 		return startsWith(str.data(), str.length());
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::endsWith(const Char* str, size_type str_length) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::endsWith(const Char* str, size_type str_length) const {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		if(str_length > length()) {
 			return false;
@@ -795,22 +800,22 @@ namespace fgl {
 		return true;
 	}
 
-	template<typename Char>
-	bool BasicString<Char>::endsWith(const Char* str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::endsWith(const Char* str) const {
 		FGL_ASSERT(str != nullptr, "str cannot be null");
 		return endsWith(str, BasicStringUtils::strlen<Char>(str));
 	}
 	
-	template<typename Char>
-	bool BasicString<Char>::endsWith(const std::basic_string<Char>& str) const {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::endsWith(const BaseType& str) const {
 		return endsWith(str.data(), str.length());
 	}
 	
 	
 	
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::replacing(Char find, Char replace) const {
-		BasicString<Char> newStr;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::replacing(Char find, Char replace) const {
+		BasicString<Char,Allocator> newStr(get_allocator());
 		newStr.reserve(length());
 		for(size_type i=0; i<length(); i++) {
 			Char c = BaseType::operator[](i);
@@ -824,8 +829,8 @@ namespace fgl {
 		return newStr;
 	}
 	
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::replacing(const std::basic_string<Char>& find, const std::basic_string<Char>& replace) const {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::replacing(const BaseType& find, const BaseType& replace) const {
 		if(find.length() == 0) {
 			return *this;
 		}
@@ -833,11 +838,11 @@ namespace fgl {
 			return *this;
 		}
 		LinkedList<size_type> indexes;
-		size_type finish = length() - find.size;
+		size_type finish = length() - find.size();
 		for(size_type i=0; i<=finish; i++) {
 			if(BaseType::operator[](i) == find[0]) {
 				bool match = true;
-				for(size_t j=1; j<find.size; j++) {
+				for(size_t j=1; j<find.size(); j++) {
 					if(BaseType::operator[](i+j) != find[j]) {
 						match = false;
 						break;
@@ -845,7 +850,7 @@ namespace fgl {
 				}
 				if(match) {
 					indexes.pushBack(i);
-					i += (find.size-1);
+					i += (find.size()-1);
 				}
 			}
 		}
@@ -853,8 +858,8 @@ namespace fgl {
 		if(indexes_size == 0) {
 			return *this;
 		}
-		BasicString<Char> newStr;
-		size_type size_new = length() + (replace.size*indexes_size) - (find.size*indexes_size);
+		BasicString<Char,Allocator> newStr(get_allocator());
+		size_type size_new = length() + (replace.size()*indexes_size) - (find.size()*indexes_size);
 		newStr.reserve(size_new);
 		size_t oldStr_counter = 0;
 		auto indexes_it = indexes.begin();
@@ -876,14 +881,14 @@ namespace fgl {
 		return newStr;
 	}
 	
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::replacing(const std::basic_regex<Char>& find, const std::basic_string<Char>& replace, std::regex_constants::match_flag_type flags) const {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::replacing(const std::basic_regex<Char>& find, const BaseType& replace, std::regex_constants::match_flag_type flags) const {
 		return std::regex_replace(*this, find, replace, flags);
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename InputIt>
-	BasicString<Char> BasicString<Char>::replacing(size_type startIndex, size_type count, InputIt first, InputIt last) const {
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::replacing(size_type startIndex, size_type count, InputIt first, InputIt last) const {
 		size_type endIndex = startIndex + count;
 		if(startIndex >= length()) {
 			throw std::out_of_range("index " + std::to_string(startIndex) + " is out of bounds in BasicString<" + typeid(Char).name() + "> with a length of " + std::to_string(length()));
@@ -892,7 +897,7 @@ namespace fgl {
 			throw std::out_of_range("index " + std::to_string(startIndex) + " plus count " + std::to_string(count) + " is out of bounds in BasicString<" + typeid(Char).name() + "> with a length of " + std::to_string(length()));
 		}
 		size_type replaceLength = std::distance(first, last);
-		BasicString<Char> newStr;
+		BasicString<Char,Allocator> newStr(get_allocator());
 		size_type size_new = BasicStringUtils::get_safe_resize<Char>(length() - count, replaceLength);
 		newStr.reserve(size_new);
 		newStr.append(data(), startIndex);
@@ -901,18 +906,18 @@ namespace fgl {
 		return newStr;
 	}
 	
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::replacing(size_type startIndex, size_type count, const std::basic_string<Char>& replace) const {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::replacing(size_type startIndex, size_type count, const BaseType& replace) const {
 		return replacing(startIndex, count, replace.begin(), replace.end());
 	}
 	
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::substring(size_type startIndex, size_type count) const {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::substring(size_type startIndex, size_type count) const {
 		return substr(startIndex, count);
 	}
 
-	template<typename Char>
-	BasicStringView<Char> BasicString<Char>::viewSubstring(size_type startIndex, size_type count) const {
+	template<typename Char, typename Allocator>
+	BasicStringView<Char> BasicString<Char,Allocator>::viewSubstring(size_type startIndex, size_type count) const {
 		if(startIndex > size()) {
 			throw std::out_of_range("startIndex must be within the range of the string");
 		}
@@ -924,9 +929,21 @@ namespace fgl {
 		return BasicStringView<Char>(start, adjustedCount);
 	}
 	
-	template<typename Char>
-	LinkedList<BasicString<Char>> BasicString<Char>::split(Char delim) const {
-		LinkedList<BasicString<Char>> items;
+	template<typename Char, typename Allocator>
+	template<typename List>
+	typename List::allocator_type BasicString<Char,Allocator>::listAllocator() const {
+		using ListAllocator = typename List::allocator_type;
+		if constexpr(std::is_constructible_v<ListAllocator,Allocator>) {
+			return ListAllocator(get_allocator());
+		} else {
+			return ListAllocator();
+		}
+	}
+	
+	template<typename Char, typename Allocator>
+	template<typename List>
+	List BasicString<Char,Allocator>::splitAs(Char delim) const {
+		List items(listAllocator<List>());
 		size_t lastStart = 0;
 		for(size_t i=0; i<length(); i++) {
 			if(BaseType::operator[](i) == delim) {
@@ -938,16 +955,14 @@ namespace fgl {
 		return items;
 	}
 	
-	template<typename Char>
-	LinkedList<BasicString<Char>> BasicString<Char>::split(const Char* delim) const {
-		FGL_ASSERT(delim != nullptr, "delim cannot be null");
-		size_t delim_size = BasicStringUtils::strlen<Char>(delim);
+	template<typename Char, typename Allocator>
+	template<typename List>
+	List BasicString<Char,Allocator>::splitAs(const Char* delim, size_t delim_size) const {
+		List items(listAllocator<List>());
 		if(delim_size == 0 || delim_size > length()) {
-			LinkedList<BasicString<Char>> elements;
-			elements.pushBack(*this);
-			return elements;
+			items.pushBack(*this);
+			return items;
 		}
-		LinkedList<BasicString<Char>> items;
 		size_t lastStart = 0;
 		size_t finish = length() - delim_size;
 		for(size_t i=0; i<=finish; i++) {
@@ -970,41 +985,43 @@ namespace fgl {
 		return items;
 	}
 	
-	template<typename Char>
-	LinkedList<BasicString<Char>> BasicString<Char>::split(const std::basic_string<Char>& delim) const {
-		if(delim.length() == 0 || delim.length() > length()) {
-			LinkedList<BasicString<Char>> items;
-			items.pushBack(*this);
-			return items;
-		}
-		LinkedList<BasicString<Char>> items;
-		size_t lastStart = 0;
-		size_t finish = length() - delim.length();
-		for(size_t i=0; i<=finish; i++) {
-			if(BaseType::operator[](i) == delim[0]) {
-				bool match = true;
-				for(size_t j=1; j<delim.length(); j++) {
-					if(BaseType::operator[](i+j) != delim[j]) {
-						match = false;
-						break;
-					}
-				}
-				if(match) {
-					items.pushBack(substring(lastStart, i-lastStart));
-					lastStart = i+delim.size;
-					i = lastStart-1;
-				}
-			}
-		}
-		items.pushBack(substring(lastStart, length()-lastStart));
-		return items;
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::ListType BasicString<Char,Allocator>::split(Char delim) const {
+		return splitAs<ListType>(delim);
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::ListType BasicString<Char,Allocator>::split(const Char* delim) const {
+		FGL_ASSERT(delim != nullptr, "delim cannot be null");
+		return splitAs<ListType>(delim, BasicStringUtils::strlen<Char>(delim));
+	}
+	
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::ListType BasicString<Char,Allocator>::split(const BaseType& delim) const {
+		return splitAs<ListType>(delim.data(), delim.length());
+	}
+	
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::PooledListType BasicString<Char,Allocator>::splitPooled(Char delim) const {
+		return splitAs<PooledListType>(delim);
+	}
+	
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::PooledListType BasicString<Char,Allocator>::splitPooled(const Char* delim) const {
+		FGL_ASSERT(delim != nullptr, "delim cannot be null");
+		return splitAs<PooledListType>(delim, BasicStringUtils::strlen<Char>(delim));
+	}
+	
+	template<typename Char, typename Allocator>
+	typename BasicString<Char,Allocator>::PooledListType BasicString<Char,Allocator>::splitPooled(const BaseType& delim) const {
+		return splitAs<PooledListType>(delim.data(), delim.length());
+	}
+	
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 	typename BasicStringUtils::is_same<_Char, Char>::null_type,
 	typename BasicStringUtils::can_convert_string_type<_Char>::null_type>
-	BasicString<Char> BasicString<Char>::trim(const std::locale& locale) const {
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::trim(const std::locale& locale) const {
 		typedef typename BasicStringUtils::utf_eqv<Char>::type utf_char;
 		if(length() == 0) {
 			return *this;
@@ -1018,7 +1035,7 @@ namespace fgl {
 			}
 		}
 		if(!hitLetter) {
-			return BasicString<Char>();
+			return BasicString<Char,Allocator>(get_allocator());
 		}
 		hitLetter = false;
 		size_type endIndex = length();
@@ -1031,12 +1048,12 @@ namespace fgl {
 		return substring(startIndex, endIndex-startIndex);
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename BasicStringUtils::can_convert_string_type<_Char>::null_type>
-	BasicString<Char> BasicString<Char>::toLowerCase(const std::locale& locale) const {
-		BasicString<Char> newStr;
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::toLowerCase(const std::locale& locale) const {
+		BasicString<Char,Allocator> newStr(get_allocator());
 		newStr.reserve(length());
 		for(size_type i=0; i<length(); i++) {
 			typedef typename BasicStringUtils::utf_eqv<Char>::type UTFChar;
@@ -1045,12 +1062,12 @@ namespace fgl {
 		return newStr;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename _Char,
 		typename BasicStringUtils::is_same<_Char, Char>::null_type,
 		typename BasicStringUtils::can_convert_string_type<_Char>::null_type>
-	BasicString<Char> BasicString<Char>::toUpperCase(const std::locale& locale) const {
-		BasicString<Char> newStr;
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::toUpperCase(const std::locale& locale) const {
+		BasicString<Char,Allocator> newStr(get_allocator());
 		newStr.reserve(length());
 		for(size_type i=0; i<length(); i++) {
 			typedef typename BasicStringUtils::utf_eqv<Char>::type UTFChar;
@@ -1059,10 +1076,10 @@ namespace fgl {
 		return newStr;
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Num,
 		typename BasicStringUtils::string_type_convertable_with_number<Char,Num>::null_type>
-	Num BasicString<Char>::toArithmeticValue(const std::locale& locale) const {
+	Num BasicString<Char,Allocator>::toArithmeticValue(const std::locale& locale) const {
 		std::basic_istringstream<Char> convert(*this);
 		convert.imbue(locale);
 		Num numVal = 0;
@@ -1073,10 +1090,10 @@ namespace fgl {
 		return numVal;
 	}
 
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Num,
 		typename BasicStringUtils::string_type_convertable_with_number<Char,Num>::null_type>
-	Optional<Num> BasicString<Char>::maybeToArithmeticValue(const std::locale& locale) const {
+	Optional<Num> BasicString<Char,Allocator>::maybeToArithmeticValue(const std::locale& locale) const {
 		std::basic_istringstream<Char> convert(*this);
 		convert.imbue(locale);
 		Num numVal = 0;
@@ -1090,16 +1107,16 @@ namespace fgl {
 	
 	
 	
-	template<typename Char>
-	bool BasicString<Char>::isNullOrEmpty(const Optional<BasicString<Char>>& str) {
+	template<typename Char, typename Allocator>
+	bool BasicString<Char,Allocator>::isNullOrEmpty(const Optional<BasicString<Char,Allocator>>& str) {
 		return !str.hasValue() || str->empty();
 	}
 	
-	template<typename Char>
+	template<typename Char, typename Allocator>
 	template<typename Collection, typename _>
-	BasicString<Char> BasicString<Char>::join(Collection&& collection, const BasicString<Char>& separator) {
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::join(Collection&& collection, const BasicString<Char,Allocator>& separator) {
 		if(collection.size() == 0) {
-			return BasicString<Char>();
+			return BasicString<Char,Allocator>(separator.get_allocator());
 		}
 		size_type listSize = 0;
 		size_type i = 0;
@@ -1111,7 +1128,7 @@ namespace fgl {
 			}
 			i++;
 		}
-		BasicString<Char> joined;
+		BasicString<Char,Allocator> joined(separator.get_allocator());
 		joined.reserve(listSize);
 		i = 0;
 		for(auto& str : collection) {
@@ -1124,10 +1141,10 @@ namespace fgl {
 		return joined;
 	}
 
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::join(std::initializer_list<BasicString<Char>> list, const BasicString<Char>& separator) {
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::join(std::initializer_list<BasicString<Char,Allocator>> list, const BasicString<Char,Allocator>& separator) {
 		if(list.size() == 0) {
-			return BasicString<Char>();
+			return BasicString<Char,Allocator>(separator.get_allocator());
 		}
 		size_type listSize = 0;
 		size_type i = 0;
@@ -1139,7 +1156,7 @@ namespace fgl {
 			}
 			i++;
 		}
-		BasicString<Char> joined;
+		BasicString<Char,Allocator> joined(separator.get_allocator());
 		joined.reserve(listSize);
 		i = 0;
 		for(auto& str : list) {
@@ -1153,9 +1170,9 @@ namespace fgl {
 	}
 
 
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::random(size_t length, const std::vector<Char>& charSet) {
-		BasicString<Char> str;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::random(size_t length, const std::vector<Char>& charSet) {
+		BasicString<Char,Allocator> str;
 		str.reserve(length);
 		for(size_t i=0; i<length; i++) {
 			size_t randIndex = (size_t)(((double)rand() / (double)RAND_MAX) * charSet.size());
@@ -1164,9 +1181,9 @@ namespace fgl {
 		return str;
 	}
 
-	template<typename Char>
-	BasicString<Char> BasicString<Char>::random(size_t length, const std::string& charSet) {
-		BasicString<Char> str;
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::random(size_t length, const std::string& charSet) {
+		BasicString<Char,Allocator> str;
 		str.reserve(length);
 		for(size_t i=0; i<length; i++) {
 			size_t randIndex = (size_t)(((double)rand() / (double)RAND_MAX) * charSet.size());
@@ -1174,6 +1191,25 @@ namespace fgl {
 		}
 		return str;
 	}
+
+	template<typename Char, typename Allocator>
+	BasicString<Char,Allocator> BasicString<Char,Allocator>::randomHex(size_t byteCount) {
+		std::random_device device;
+		std::vector<uint8_t> bytes(byteCount);
+		for(size_t i=0; i<byteCount; i+=sizeof(uint32_t)) {
+			uint32_t value = (uint32_t)device();
+			std::memcpy(bytes.data() + i, &value, std::min(sizeof(value), byteCount - i));
+		}
+		if constexpr(std::is_same_v<Char,char>) {
+			BasicString<Char,Allocator> str(Hex::encodedSize(byteCount), '\0');
+			Hex::encode(bytes.data(), byteCount, str.data());
+			return str;
+		} else {
+			std::string hex(Hex::encodedSize(byteCount), '\0');
+			Hex::encode(bytes.data(), byteCount, hex.data());
+			return BasicString<Char,Allocator>(hex.begin(), hex.end());
+		}
+	}
 	
 	
 
@@ -22,7 +22,7 @@
 namespace fgl {
 	#define NULLCHAR 0
 	
-	template<typename Char>
+	template<typename Char, typename Allocator = std::allocator<Char>>
 	class BasicString;
 	
 	class BasicStringUtils {
@@ -0,0 +1,165 @@
+//
+//  Binary.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/Binary.hpp>
+
+namespace fgl {
+	namespace {
+		constexpr uint8_t BINARY_SIGNATURE[4] = { 'F', 'G', 'L', 'B' };
+		// items that encode to nothing can't be bounded by the input, so their count is capped instead
+		constexpr uint64_t MAX_EMPTY_ITEM_COUNT = (uint64_t)1 << 24;
+	}
+
+
+
+	#pragma mark BinaryDecodeError implementation
+
+	BinaryDecodeError::BinaryDecodeError(const std::string& message, size_t offset)
+	: std::invalid_argument(message + " at offset " + std::to_string(offset)), _offset(offset) {
+		//
+	}
+
+	size_t BinaryDecodeError::offset() const noexcept {
+		return _offset;
+	}
+
+
+
+	#pragma mark _Varint implementation
+
+	const char* _Varint::decode(const uint8_t*& position, const uint8_t* end, uint64_t& value) noexcept {
+		const uint8_t* ptr = position;
+		uint64_t result = 0;
+		for(size_t i=0; i<MAX_SIZE; i++) {
+			if(ptr == end) {
+				return "Unexpected end of input";
+			}
+			uint8_t byte = *ptr;
+			ptr++;
+			// the 10th byte can only hold the top bit of a 64-bit value
+			if(i == (MAX_SIZE - 1) && byte > 1) {
+				break;
+			}
+			result |= (uint64_t)(byte & 0x7F) << (i * 7);
+			if(byte < 0x80) {
+				position = ptr;
+				value = result;
+				return nullptr;
+			}
+		}
+		return "Varint is too long";
+	}
+
+
+
+	#pragma mark BinaryEncoder implementation
+
+	BinaryEncoder::BinaryEncoder(Data& output)
+	: _output(output) {
+		//
+	}
+
+	void BinaryEncoder::writeHeader() {
+		writeRaw(BINARY_SIGNATURE, sizeof(BINARY_SIGNATURE));
+		writeVarint(Binary::VERSION);
+	}
+
+	void BinaryEncoder::writeBytes(std::span<const uint8_t> bytes) {
+		writeVarint(bytes.size());
+		writeRaw(bytes.data(), bytes.size());
+	}
+
+	void BinaryEncoder::writeString(std::string_view str) {
+		writeVarint(str.size());
+		writeRaw(str.data(), str.size());
+	}
+
+
+
+	#pragma mark BinaryDecoder implementation
+
+	BinaryDecoder::BinaryDecoder(const void* bytes, size_t size)
+	: _begin((const uint8_t*)bytes), _position((const uint8_t*)bytes), _end((const uint8_t*)bytes + size) {
+		//
+	}
+
+	BinaryDecoder::BinaryDecoder(std::span<const uint8_t> bytes)
+	: BinaryDecoder(bytes.data(), bytes.size()) {
+		//
+	}
+
+	uint32_t BinaryDecoder::readHeader() {
+		if(remaining() < sizeof(BINARY_SIGNATURE) || std::memcmp(_position, BINARY_SIGNATURE, sizeof(BINARY_SIGNATURE)) != 0) {
+			fail("Missing binary format signature");
+		}
+		_position += sizeof(BINARY_SIGNATURE);
+		size_t start = offset();
+		uint64_t version = readVarint();
+		if(version == 0 || version > Binary::VERSION) {
+			throw BinaryDecodeError("Unsupported binary format version " + std::to_string(version), start);
+		}
+		return (uint32_t)version;
+	}
+
+	uint64_t BinaryDecoder::readVarintSlow() {
+		uint64_t value = 0;
+		if(auto error = _Varint::decode(_position, _end, value)) {
+			fail(error);
+		}
+		return value;
+	}
+
+	uint8_t BinaryDecoder::readByte() {
+		if(_position == _end) {
+			fail("Unexpected end of input");
+		}
+		uint8_t byte = *_position;
+		_position++;
+		return byte;
+	}
+
+	void BinaryDecoder::readRaw(void* bytes, size_t size) {
+		if(size > remaining()) {
+			fail("Unexpected end of input");
+		} else if(size == 0) {
+			return;
+		}
+		std::memcpy(bytes, _position, size);
+		_position += size;
+	}
+
+	std::span<const uint8_t> BinaryDecoder::readBytes() {
+		size_t start = offset();
+		uint64_t size = readVarint();
+		if(size > remaining()) {
+			throw BinaryDecodeError("Byte length " + std::to_string(size) + " is longer than the remaining input", start);
+		}
+		auto bytes = std::span<const uint8_t>(_position, (size_t)size);
+		_position += size;
+		return bytes;
+	}
+
+	std::string_view BinaryDecoder::readString() {
+		auto bytes = readBytes();
+		return std::string_view((const char*)bytes.data(), bytes.size());
+	}
+
+	size_t BinaryDecoder::readCount(size_t minItemSize) {
+		size_t start = offset();
+		uint64_t count = readVarint();
+		uint64_t maxCount = (minItemSize > 0) ? (uint64_t)(remaining() / minItemSize) : MAX_EMPTY_ITEM_COUNT;
+		if(count > maxCount) {
+			throw BinaryDecodeError("Collection length " + std::to_string(count) + " is longer than the remaining input", start);
+		}
+		return (size_t)count;
+	}
+
+	void BinaryDecoder::fail(const std::string& message) const {
+		throw BinaryDecodeError(message, offset());
+	}
+}
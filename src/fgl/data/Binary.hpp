@@ -0,0 +1,595 @@
+//
+//  Binary.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/Data.hpp>
+#include <fgl/data/Optional.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/data/Traits.hpp>
+#include <fgl/data/Variant.hpp>
+#include <fgl/time/Date.hpp>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace fgl {
+	class BinaryEncoder;
+	class BinaryDecoder;
+
+	/// Thrown when binary input is truncated, malformed, or doesn't match the type being decoded
+	class BinaryDecodeError: public std::invalid_argument {
+	public:
+		BinaryDecodeError(const std::string& message, size_t offset);
+
+		/// The byte offset in the input where the problem was found
+		size_t offset() const noexcept;
+
+	private:
+		size_t _offset;
+	};
+
+
+	/// Converts a type to and from the binary format.
+	/// Specialize this with static void encode(BinaryEncoder&, const T&) and static T decode(BinaryDecoder&) to support your own types.
+	/// Specializations take priority over the built in encodings.
+	template<typename T>
+	struct binary_traits;
+
+
+	/// Appends values to a Data buffer in the binary format.
+	/// Values carry no type tags, so they must be decoded as the same types they were encoded with.
+	/// Integers are written as varints (zigzag encoded when signed), floating point values as little endian bytes,
+	/// and strings, byte buffers and collections with a varint length prefix.
+	/// Dates are written as signed nanoseconds since 1970, so they must fall between the years 1677 and 2262.
+	class BinaryEncoder {
+	public:
+		explicit BinaryEncoder(Data& output);
+
+		/// Writes the format signature and version, which BinaryDecoder::readHeader checks
+		void writeHeader();
+
+		inline void writeVarint(uint64_t value);
+		inline void writeSignedVarint(int64_t value);
+		inline void writeByte(uint8_t byte);
+		/// Writes bytes as they are, without a length prefix
+		inline void writeRaw(const void* bytes, size_t size);
+		/// Writes a length prefix followed by the bytes
+		void writeBytes(std::span<const uint8_t> bytes);
+		void writeString(std::string_view str);
+
+		template<typename T>
+		void write(const T& value);
+
+		inline Data& output() noexcept;
+
+	private:
+		template<typename Tuple, size_t... Indexes>
+		void writeTuple(const Tuple& tuple, std::index_sequence<Indexes...>);
+
+		Data& _output;
+	};
+
+
+	/// Reads values in the binary format from memory, such as a Data buffer or a memory mapped file.
+	/// std::string_view and std::span<const uint8_t> values are decoded as views into the input, without copying.
+	class BinaryDecoder {
+	public:
+		BinaryDecoder(const void* bytes, size_t size);
+		explicit BinaryDecoder(std::span<const uint8_t> bytes);
+		template<typename Allocator>
+		explicit BinaryDecoder(const BasicData<Allocator>& data);
+
+		/// Checks the format signature and returns the version the input was written with
+		uint32_t readHeader();
+
+		inline uint64_t readVarint();
+		inline int64_t readSignedVarint();
+		uint8_t readByte();
+		/// Reads bytes without a length prefix
+		void readRaw(void* bytes, size_t size);
+		/// Reads a length prefix and returns a view of the bytes that follow it
+		std::span<const uint8_t> readBytes();
+		std::string_view readString();
+
+		template<typename T>
+		T read();
+		template<typename T>
+		inline void read(T& value);
+
+		/// The number of bytes read so far
+		inline size_t offset() const noexcept;
+		inline size_t remaining() const noexcept;
+		inline bool atEnd() const noexcept;
+
+		[[noreturn]] void fail(const std::string& message) const;
+
+	private:
+		uint64_t readVarintSlow();
+		/// Reads a collection length, which can't claim more items than the remaining input can hold when each item takes at least minItemSize bytes
+		size_t readCount(size_t minItemSize);
+		template<typename Tuple, size_t... Indexes>
+		Tuple readTuple(std::index_sequence<Indexes...>);
+		template<typename VariantType, size_t Index = 0>
+		VariantType readVariantAlternative(size_t index);
+
+		const uint8_t* _begin;
+		const uint8_t* _position;
+		const uint8_t* _end;
+	};
+
+
+	class Binary {
+	public:
+		/// The current version of the format, written by BinaryEncoder::writeHeader
+		static constexpr uint32_t VERSION = 1;
+
+		/// Encodes a value with a header
+		template<typename T>
+		static Data encode(const T& value);
+		/// Appends a value with a header to the given buffer
+		template<typename T>
+		static void encodeTo(Data& output, const T& value);
+
+		/// Decodes a value written by encode, and checks that the whole input was used
+		template<typename T>
+		static T decode(std::span<const uint8_t> bytes);
+		template<typename T, typename Allocator>
+		static T decode(const BasicData<Allocator>& data);
+	};
+
+
+
+	template<typename T>
+	struct _is_binary_string: std::false_type {};
+	template<typename Allocator>
+	struct _is_binary_string<BasicString<char,Allocator>>: std::true_type {};
+	template<typename Traits, typename Allocator>
+	struct _is_binary_string<std::basic_string<char,Traits,Allocator>>: std::true_type {};
+
+	/// Collections of these types are copied in bulk, since their encoding matches their memory layout
+	template<typename T>
+	constexpr bool _is_binary_bulk_type = (sizeof(T) == 1 && std::is_integral_v<T> && !std::is_same_v<T,bool>)
+		|| ((std::is_same_v<T,float> || std::is_same_v<T,double>) && std::endian::native == std::endian::little);
+
+	template<typename Collection>
+	concept _BinaryBulkCollection = _is_binary_bulk_type<typename Collection::value_type>
+		&& std::contiguous_iterator<typename Collection::const_iterator>;
+
+	/// The fewest bytes that an encoded T can take. Empty tuples and arrays take none,
+	/// and neither may types with binary_traits, since their encoding isn't known.
+	template<typename T>
+	constexpr size_t _binaryMinSize() {
+		using Type = std::remove_cvref_t<T>;
+		if constexpr(requires(BinaryEncoder& encoder, const Type& value) { binary_traits<Type>::encode(encoder, value); }) {
+			return 0;
+		}
+		else if constexpr(requires { std::tuple_size<Type>::value; }) {
+			return []<size_t... Indexes>(std::index_sequence<Indexes...>) {
+				return ((size_t)0 + ... + _binaryMinSize<std::tuple_element_t<Indexes,Type>>());
+			}(std::make_index_sequence<std::tuple_size_v<Type>>());
+		}
+		else {
+			return 1;
+		}
+	}
+
+	/// The LEB128 varint and zigzag encodings, shared by BinaryEncoder/BinaryDecoder and ByteWriter/ByteReader so the two can't drift apart
+	struct _Varint {
+		static constexpr size_t MAX_SIZE = 10;
+		
+		/// Writes the value into output, which must have room for MAX_SIZE bytes, and returns the number of bytes written
+		static inline size_t encode(uint64_t value, uint8_t* output) noexcept;
+		static inline uint64_t zigzagEncode(int64_t value) noexcept;
+		static inline int64_t zigzagDecode(uint64_t value) noexcept;
+		
+		/// Decodes a varint without bounds checks when the longest one fits before end.
+		/// Returns false without reading anything when it doesn't fit, or when the varint is longer than 9 bytes.
+		static inline bool decodeFast(const uint8_t*& position, const uint8_t* end, uint64_t& value) noexcept;
+		/// Decodes a varint with bounds checks, advancing position past it.
+		/// Returns a description of the problem if the input ends or the varint is too long, or null on success.
+		static const char* decode(const uint8_t*& position, const uint8_t* end, uint64_t& value) noexcept;
+	};
+
+
+
+#pragma mark _Varint implementation
+
+	size_t _Varint::encode(uint64_t value, uint8_t* output) noexcept {
+		size_t size = 0;
+		while(value >= 0x80) {
+			output[size] = (uint8_t)(value | 0x80);
+			value >>= 7;
+			size++;
+		}
+		output[size] = (uint8_t)value;
+		return size + 1;
+	}
+
+	uint64_t _Varint::zigzagEncode(int64_t value) noexcept {
+		// zigzag encoding keeps small negative numbers small
+		return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	}
+
+	int64_t _Varint::zigzagDecode(uint64_t value) noexcept {
+		return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+	}
+
+	bool _Varint::decodeFast(const uint8_t*& position, const uint8_t* end, uint64_t& value) noexcept {
+		if((size_t)(end - position) < MAX_SIZE) {
+			return false;
+		}
+		const uint8_t* ptr = position;
+		uint64_t result = 0;
+		for(size_t i=0; i<(MAX_SIZE - 1); i++) {
+			uint8_t byte = ptr[i];
+			result |= (uint64_t)(byte & 0x7F) << (i * 7);
+			if(byte < 0x80) {
+				position = ptr + i + 1;
+				value = result;
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+
+#pragma mark BinaryEncoder implementation
+
+	void BinaryEncoder::writeVarint(uint64_t value) {
+		if(value < 0x80) {
+			_output.push_back((uint8_t)value);
+			return;
+		}
+		uint8_t bytes[_Varint::MAX_SIZE];
+		writeRaw(bytes, _Varint::encode(value, bytes));
+	}
+
+	void BinaryEncoder::writeSignedVarint(int64_t value) {
+		writeVarint(_Varint::zigzagEncode(value));
+	}
+
+	void BinaryEncoder::writeByte(uint8_t byte) {
+		_output.push_back(byte);
+	}
+
+	void BinaryEncoder::writeRaw(const void* bytes, size_t size) {
+		auto ptr = (const uint8_t*)bytes;
+		_output.insert(_output.end(), ptr, ptr + size);
+	}
+
+	Data& BinaryEncoder::output() noexcept {
+		return _output;
+	}
+
+	template<typename T>
+	void BinaryEncoder::write(const T& value) {
+		using Type = std::remove_cvref_t<T>;
+		if constexpr(requires { binary_traits<Type>::encode(*this, value); }) {
+			binary_traits<Type>::encode(*this, value);
+		}
+		else if constexpr(std::is_same_v<Type,bool>) {
+			writeByte(value ? 1 : 0);
+		}
+		else if constexpr(std::is_enum_v<Type>) {
+			write((std::underlying_type_t<Type>)value);
+		}
+		else if constexpr(std::is_integral_v<Type> && sizeof(Type) == 1) {
+			writeByte((uint8_t)value);
+		}
+		else if constexpr(std::is_integral_v<Type> && std::is_signed_v<Type>) {
+			writeSignedVarint((int64_t)value);
+		}
+		else if constexpr(std::is_integral_v<Type>) {
+			writeVarint((uint64_t)value);
+		}
+		else if constexpr(std::is_same_v<Type,float> || std::is_same_v<Type,double>) {
+			using Bits = std::conditional_t<std::is_same_v<Type,float>,uint32_t,uint64_t>;
+			Bits bits = std::bit_cast<Bits>(value);
+			uint8_t bytes[sizeof(Bits)];
+			for(size_t i=0; i<sizeof(Bits); i++) {
+				bytes[i] = (uint8_t)(bits >> (i * 8));
+			}
+			writeRaw(bytes, sizeof(bytes));
+		}
+		else if constexpr(_is_binary_string<Type>::value || std::is_same_v<Type,std::string_view>) {
+			writeString(std::string_view(value));
+		}
+		else if constexpr(std::is_same_v<Type,const char*> || std::is_same_v<Type,char*>) {
+			writeString(std::string_view(value));
+		}
+		else if constexpr(std::is_same_v<Type,std::span<const uint8_t>>) {
+			writeBytes(value);
+		}
+		else if constexpr(std::is_same_v<Type,Date>) {
+			auto interval = value.timeSince1970();
+			if constexpr(std::ratio_greater_v<TimeInterval::period,std::nano>) {
+				// a coarser clock can hold dates that overflow nanoseconds
+				if(interval > std::chrono::duration_cast<TimeInterval>(std::chrono::nanoseconds::max())
+				   || interval < std::chrono::duration_cast<TimeInterval>(std::chrono::nanoseconds::min())) {
+					throw std::out_of_range("Date is outside the range that the binary format can encode");
+				}
+			}
+			auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(interval);
+			writeSignedVarint((int64_t)nanoseconds.count());
+		}
+		else if constexpr(is_optional<Type>::value) {
+			if(value) {
+				writeByte(1);
+				write(*value);
+			} else {
+				writeByte(0);
+			}
+		}
+		else if constexpr(is_variant<Type>::value) {
+			if constexpr(requires { value.valueless_by_exception(); }) {
+				if(value.valueless_by_exception()) {
+					throw std::invalid_argument("Cannot encode a valueless variant");
+				}
+			} else if constexpr(requires { value.valuelessByException(); }) {
+				if(value.valuelessByException()) {
+					throw std::invalid_argument("Cannot encode a valueless variant");
+				}
+			}
+			writeVarint(value.index());
+			visitVariants([&](auto& alternative) {
+				write(alternative);
+			}, value);
+		}
+		else if constexpr(is_pair<Type>::value) {
+			write(value.first);
+			write(value.second);
+		}
+		else if constexpr(is_collection<Type>::value) {
+			// std::array has a fixed size, so its items are written without a length
+			if constexpr(!requires { std::tuple_size<Type>::value; }) {
+				writeVarint((uint64_t)std::distance(value.begin(), value.end()));
+			}
+			if constexpr(_BinaryBulkCollection<Type>) {
+				writeRaw(std::to_address(value.begin()), sizeof(typename Type::value_type) * (size_t)(value.end() - value.begin()));
+			} else {
+				for(auto& item : value) {
+					write(item);
+				}
+			}
+		}
+		else if constexpr(requires { std::tuple_size<Type>::value; }) {
+			writeTuple(value, std::make_index_sequence<std::tuple_size_v<Type>>());
+		}
+		else {
+			static_assert(std::is_same_v<Type,void>, "Type has no binary encoding. Specialize binary_traits to support it.");
+		}
+	}
+
+	template<typename Tuple, size_t... Indexes>
+	void BinaryEncoder::writeTuple(const Tuple& tuple, std::index_sequence<Indexes...>) {
+		(write(std::get<Indexes>(tuple)), ...);
+	}
+
+
+
+#pragma mark BinaryDecoder implementation
+
+	template<typename Allocator>
+	BinaryDecoder::BinaryDecoder(const BasicData<Allocator>& data)
+	: BinaryDecoder(data.data(), data.size()) {
+		//
+	}
+
+	uint64_t BinaryDecoder::readVarint() {
+		uint64_t value;
+		if(_Varint::decodeFast(_position, _end, value)) {
+			return value;
+		}
+		return readVarintSlow();
+	}
+
+	int64_t BinaryDecoder::readSignedVarint() {
+		return _Varint::zigzagDecode(readVarint());
+	}
+
+	template<typename T>
+	void BinaryDecoder::read(T& value) {
+		value = read<T>();
+	}
+
+	size_t BinaryDecoder::offset() const noexcept {
+		return (size_t)(_position - _begin);
+	}
+
+	size_t BinaryDecoder::remaining() const noexcept {
+		return (size_t)(_end - _position);
+	}
+
+	bool BinaryDecoder::atEnd() const noexcept {
+		return _position == _end;
+	}
+
+	template<typename T>
+	T BinaryDecoder::read() {
+		using Type = std::remove_cvref_t<T>;
+		if constexpr(requires(BinaryDecoder& decoder) { { binary_traits<Type>::decode(decoder) } -> std::convertible_to<Type>; }) {
+			return binary_traits<Type>::decode(*this);
+		}
+		else if constexpr(std::is_same_v<Type,bool>) {
+			size_t start = offset();
+			uint8_t byte = readByte();
+			if(byte > 1) {
+				throw BinaryDecodeError("Invalid bool value", start);
+			}
+			return byte != 0;
+		}
+		else if constexpr(std::is_enum_v<Type>) {
+			return (Type)read<std::underlying_type_t<Type>>();
+		}
+		else if constexpr(std::is_integral_v<Type> && sizeof(Type) == 1) {
+			return (Type)readByte();
+		}
+		else if constexpr(std::is_integral_v<Type> && std::is_signed_v<Type>) {
+			size_t start = offset();
+			int64_t value = readSignedVarint();
+			if(value < (int64_t)std::numeric_limits<Type>::min() || value > (int64_t)std::numeric_limits<Type>::max()) {
+				throw BinaryDecodeError("Integer is out of range for " + std::to_string(sizeof(Type) * 8) + "-bit type", start);
+			}
+			return (Type)value;
+		}
+		else if constexpr(std::is_integral_v<Type>) {
+			size_t start = offset();
+			uint64_t value = readVarint();
+			if(value > (uint64_t)std::numeric_limits<Type>::max()) {
+				throw BinaryDecodeError("Integer is out of range for " + std::to_string(sizeof(Type) * 8) + "-bit type", start);
+			}
+			return (Type)value;
+		}
+		else if constexpr(std::is_same_v<Type,float> || std::is_same_v<Type,double>) {
+			using Bits = std::conditional_t<std::is_same_v<Type,float>,uint32_t,uint64_t>;
+			uint8_t bytes[sizeof(Bits)];
+			readRaw(bytes, sizeof(bytes));
+			Bits bits = 0;
+			for(size_t i=0; i<sizeof(Bits); i++) {
+				bits |= (Bits)bytes[i] << (i * 8);
+			}
+			return std::bit_cast<Type>(bits);
+		}
+		else if constexpr(std::is_same_v<Type,std::string_view>) {
+			return readString();
+		}
+		else if constexpr(_is_binary_string<Type>::value) {
+			auto str = readString();
+			return Type(str.data(), str.size());
+		}
+		else if constexpr(std::is_same_v<Type,std::span<const uint8_t>>) {
+			return readBytes();
+		}
+		else if constexpr(std::is_same_v<Type,Date>) {
+			auto nanoseconds = std::chrono::nanoseconds(readSignedVarint());
+			return Date::fromTimeSince1970(std::chrono::duration_cast<TimeInterval>(nanoseconds));
+		}
+		else if constexpr(is_optional<Type>::value) {
+			using ValueType = std::remove_cvref_t<decltype(*std::declval<Type&>())>;
+			size_t start = offset();
+			uint8_t present = readByte();
+			if(present == 0) {
+				return Type();
+			} else if(present != 1) {
+				throw BinaryDecodeError("Invalid optional marker", start);
+			}
+			return Type(read<ValueType>());
+		}
+		else if constexpr(is_variant<Type>::value) {
+			size_t start = offset();
+			uint64_t index = readVarint();
+			if(index >= _VariantAccess<Type>::size) {
+				throw BinaryDecodeError("Variant index " + std::to_string(index) + " is out of range", start);
+			}
+			return readVariantAlternative<Type>((size_t)index);
+		}
+		else if constexpr(is_pair<Type>::value) {
+			// braced initialization reads the members in order
+			using FirstType = std::remove_const_t<typename Type::first_type>;
+			using SecondType = std::remove_const_t<typename Type::second_type>;
+			return Type{ read<FirstType>(), read<SecondType>() };
+		}
+		else if constexpr(is_collection<Type>::value && requires { std::tuple_size<Type>::value; }) {
+			Type array;
+			for(auto& item : array) {
+				item = read<typename Type::value_type>();
+			}
+			return array;
+		}
+		else if constexpr(is_collection<Type>::value) {
+			using ValueType = typename Type::value_type;
+			Type collection;
+			if constexpr(_BinaryBulkCollection<Type> && requires { collection.resize(0); collection.data(); }) {
+				size_t count = readCount(sizeof(ValueType));
+				collection.resize(count);
+				readRaw(collection.data(), count * sizeof(ValueType));
+			} else {
+				constexpr size_t minItemSize = _binaryMinSize<ValueType>();
+				size_t count = readCount(minItemSize);
+				if constexpr(minItemSize > 0 && requires { collection.reserve(count); }) {
+					collection.reserve(count);
+				}
+				for(size_t i=0; i<count; i++) {
+					if constexpr(requires { collection.push_back(read<ValueType>()); }) {
+						collection.push_back(read<ValueType>());
+					} else {
+						collection.insert(collection.end(), read<ValueType>());
+					}
+				}
+			}
+			return collection;
+		}
+		else if constexpr(requires { std::tuple_size<Type>::value; }) {
+			return readTuple<Type>(std::make_index_sequence<std::tuple_size_v<Type>>());
+		}
+		else {
+			static_assert(std::is_same_v<Type,void>, "Type has no binary encoding. Specialize binary_traits to support it.");
+		}
+	}
+
+	template<typename Tuple, size_t... Indexes>
+	Tuple BinaryDecoder::readTuple(std::index_sequence<Indexes...>) {
+		// braced initialization reads the elements in order
+		return Tuple{ read<std::tuple_element_t<Indexes,Tuple>>()... };
+	}
+
+	template<typename VariantType, size_t Index>
+	VariantType BinaryDecoder::readVariantAlternative(size_t index) {
+		using AlternativeType = std::remove_cvref_t<decltype(_VariantAccess<VariantType>::template get<Index>(std::declval<VariantType&>()))>;
+		if constexpr((Index + 1) < _VariantAccess<VariantType>::size) {
+			if(index != Index) {
+				return readVariantAlternative<VariantType,(Index + 1)>(index);
+			}
+		}
+		return VariantType(std::in_place_index<Index>, read<AlternativeType>());
+	}
+
+
+
+#pragma mark Binary implementation
+
+	template<typename T>
+	Data Binary::encode(const T& value) {
+		Data output;
+		encodeTo(output, value);
+		return output;
+	}
+
+	template<typename T>
+	void Binary::encodeTo(Data& output, const T& value) {
+		BinaryEncoder encoder(output);
+		encoder.writeHeader();
+		encoder.write(value);
+	}
+
+	template<typename T>
+	T Binary::decode(std::span<const uint8_t> bytes) {
+		BinaryDecoder decoder(bytes);
+		decoder.readHeader();
+		T value = decoder.read<T>();
+		if(!decoder.atEnd()) {
+			decoder.fail("Unexpected data after the encoded value");
+		}
+		return value;
+	}
+
+	template<typename T, typename Allocator>
+	T Binary::decode(const BasicData<Allocator>& data) {
+		return decode<T>(std::span<const uint8_t>(data.data(), data.size()));
+	}
+}
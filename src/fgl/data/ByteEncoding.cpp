@@ -0,0 +1,559 @@
+//
+//  ByteEncoding.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/ByteEncoding.hpp>
+#include <fgl/data/Data.hpp>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(FGL_BYTE_ENCODING_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	#define FGL_BYTE_ENCODING_SIMD_SSE2
+	#if defined(__SSSE3__) || defined(__AVX__)
+		#include <tmmintrin.h>
+		#define FGL_BYTE_ENCODING_SIMD_SSSE3
+	#endif
+#elif !defined(FGL_BYTE_ENCODING_DISABLE_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+	#include <arm_neon.h>
+	#define FGL_BYTE_ENCODING_SIMD_NEON
+#endif
+
+namespace fgl {
+	namespace {
+		constexpr uint8_t INVALID_SEXTET = 0xFF;
+		constexpr uint8_t INVALID_NIBBLE = 0xFF;
+
+		struct Base64Alphabet {
+			char chars[64];
+			uint8_t values[256];
+			// Tables for validating and decoding 16 characters at a time by their nibbles.
+			// A character is valid when lowNibbleClasses[low] & highNibbleClasses[high] is 0.
+			uint8_t lowNibbleClasses[16];
+			uint8_t highNibbleClasses[16];
+			// Adding deltas[high] to a character gives its value, except for exceptionChar, whose delta is stored at index 1.
+			int8_t deltas[16];
+			char exceptionChar;
+
+			constexpr Base64Alphabet(char char62, char char63): chars(), values(), lowNibbleClasses(), highNibbleClasses(), deltas(), exceptionChar(0) {
+				for(size_t i=0; i<256; i++) {
+					values[i] = INVALID_SEXTET;
+				}
+				for(uint8_t i=0; i<26; i++) {
+					chars[i] = (char)('A' + i);
+					chars[26 + i] = (char)('a' + i);
+				}
+				for(uint8_t i=0; i<10; i++) {
+					chars[52 + i] = (char)('0' + i);
+				}
+				chars[62] = char62;
+				chars[63] = char63;
+				for(uint8_t i=0; i<64; i++) {
+					values[(uint8_t)chars[i]] = i;
+				}
+				// give each set of high nibbles that allow the same low nibbles its own class bit
+				uint16_t validLowNibbles[16] = {};
+				for(size_t i=0; i<64; i++) {
+					validLowNibbles[(uint8_t)chars[i] >> 4] |= (uint16_t)(1 << (chars[i] & 0x0F));
+				}
+				uint8_t nextClass = 1;
+				for(size_t high=0; high<16; high++) {
+					for(size_t prevHigh=0; prevHigh<high; prevHigh++) {
+						if(validLowNibbles[prevHigh] == validLowNibbles[high]) {
+							highNibbleClasses[high] = highNibbleClasses[prevHigh];
+							break;
+						}
+					}
+					if(highNibbleClasses[high] == 0) {
+						highNibbleClasses[high] = nextClass;
+						nextClass <<= 1;
+					}
+					for(size_t low=0; low<16; low++) {
+						if((validLowNibbles[high] & (1 << low)) == 0) {
+							lowNibbleClasses[low] |= highNibbleClasses[high];
+						}
+					}
+				}
+				// characters sharing a high nibble share a delta, except for one of char62 and char63
+				bool hasDelta[16] = {};
+				for(size_t i=0; i<64; i++) {
+					uint8_t high = (uint8_t)chars[i] >> 4;
+					int8_t delta = (int8_t)((int)i - (int)chars[i]);
+					if(!hasDelta[high]) {
+						deltas[high] = delta;
+						hasDelta[high] = true;
+					} else if(deltas[high] != delta) {
+						exceptionChar = chars[i];
+						deltas[1] = delta;
+					}
+				}
+			}
+		};
+
+		constexpr Base64Alphabet standardAlphabet('+', '/');
+		constexpr Base64Alphabet urlAlphabet('-', '_');
+
+		struct HexTable {
+			/// The 2 characters for each byte value
+			char pairs[512];
+			uint8_t values[256];
+
+			constexpr HexTable(): pairs(), values() {
+				constexpr char digits[] = "0123456789abcdef";
+				for(size_t i=0; i<256; i++) {
+					pairs[i * 2] = digits[i >> 4];
+					pairs[(i * 2) + 1] = digits[i & 0x0F];
+					values[i] = INVALID_NIBBLE;
+				}
+				for(uint8_t i=0; i<10; i++) {
+					values['0' + i] = i;
+				}
+				for(uint8_t i=0; i<6; i++) {
+					values['a' + i] = 10 + i;
+					values['A' + i] = 10 + i;
+				}
+			}
+		};
+
+		constexpr HexTable hexTable;
+
+		inline const Base64Alphabet& base64AlphabetFor(Base64::Alphabet alphabet) {
+			return (alphabet == Base64::Alphabet::URL) ? urlAlphabet : standardAlphabet;
+		}
+
+		[[noreturn]] void throwInvalidCharacter(const char* encoding, std::string_view str, size_t offset) {
+			throw std::invalid_argument(std::string("Invalid ") + encoding + " character '" + str[offset] + "' at offset " + std::to_string(offset));
+		}
+
+		/// Finds the invalid character in a group that failed to decode, and throws for it
+		[[noreturn]] void throwInvalidBase64(const Base64Alphabet& alphabet, std::string_view str, size_t offset, size_t count) {
+			for(size_t i=offset; i<(offset + count); i++) {
+				if(alphabet.values[(uint8_t)str[i]] == INVALID_SEXTET) {
+					throwInvalidCharacter("base64", str, i);
+				}
+			}
+			throw std::invalid_argument("Invalid base64 at offset " + std::to_string(offset));
+		}
+
+		[[noreturn]] void throwInvalidHex(std::string_view str, size_t offset, size_t count) {
+			for(size_t i=offset; i<(offset + count); i++) {
+				if(hexTable.values[(uint8_t)str[i]] == INVALID_NIBBLE) {
+					throwInvalidCharacter("hex", str, i);
+				}
+			}
+			throw std::invalid_argument("Invalid hex at offset " + std::to_string(offset));
+		}
+
+
+
+		#pragma mark SIMD kernels
+		// Each kernel handles as many whole blocks as it can, and returns the number of input bytes or characters it consumed.
+		// Decode kernels stop at the first block with an invalid character, leaving it for the scalar loop to report.
+
+		#if defined(FGL_BYTE_ENCODING_SIMD_SSSE3)
+
+		size_t encodeBase64Blocks(const uint8_t* bytes, size_t size, char* output, const Base64Alphabet& alphabet) {
+			// 12 bytes are encoded per iteration, but 16 are loaded
+			const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+			const __m128i offsets = _mm_setr_epi8(
+				'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, (char)(alphabet.chars[62] - 62), (char)(alphabet.chars[63] - 63), 'A', 0, 0);
+			size_t consumed = 0;
+			while((size - consumed) >= 16) {
+				__m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(bytes + consumed)), shuffle);
+				// split each group of 3 bytes into 4 sextets, one per byte
+				__m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+				__m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+				__m128i sextets = _mm_or_si128(t0, t1);
+				// map each sextet range to the offset from its value to its character
+				__m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+				range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+				__m128i chars = _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range));
+				_mm_storeu_si128((__m128i*)(output + ((consumed / 3) * 4)), chars);
+				consumed += 12;
+			}
+			return consumed;
+		}
+
+		size_t decodeBase64Blocks(const char* str, size_t length, uint8_t* output, const Base64Alphabet& alphabet) {
+			const __m128i lowNibbleClasses = _mm_loadu_si128((const __m128i*)alphabet.lowNibbleClasses);
+			const __m128i highNibbleClasses = _mm_loadu_si128((const __m128i*)alphabet.highNibbleClasses);
+			const __m128i deltas = _mm_loadu_si128((const __m128i*)alphabet.deltas);
+			const __m128i exceptionChar = _mm_set1_epi8(alphabet.exceptionChar);
+			const __m128i lowNibble = _mm_set1_epi8(0x0F);
+			const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+			size_t consumed = 0;
+			while((length - consumed) >= 16) {
+				__m128i chars = _mm_loadu_si128((const __m128i*)(str + consumed));
+				__m128i high = _mm_and_si128(_mm_srli_epi32(chars, 4), lowNibble);
+				__m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowNibbleClasses, _mm_and_si128(chars, lowNibble)), _mm_shuffle_epi8(highNibbleClasses, high));
+				if(_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF) {
+					break;
+				}
+				__m128i isException = _mm_cmpeq_epi8(chars, exceptionChar);
+				__m128i deltaIndex = _mm_or_si128(_mm_andnot_si128(isException, high), _mm_and_si128(isException, _mm_set1_epi8(1)));
+				__m128i sextets = _mm_add_epi8(chars, _mm_shuffle_epi8(deltas, deltaIndex));
+				// merge pairs of sextets into 12 bits, then pairs of those into 24 bits, then drop the empty byte of each
+				__m128i merged = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+				merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+				merged = _mm_shuffle_epi8(merged, pack);
+				uint8_t* out = output + ((consumed / 4) * 3);
+				if((length - consumed) >= 24) {
+					// the 4 bytes past the block will be overwritten by the next one
+					_mm_storeu_si128((__m128i*)out, merged);
+				} else {
+					_mm_storel_epi64((__m128i*)out, merged);
+					uint32_t last = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(merged, 8));
+					std::memcpy(out + 8, &last, 4);
+				}
+				consumed += 16;
+			}
+			return consumed;
+		}
+
+		#elif defined(FGL_BYTE_ENCODING_SIMD_NEON)
+
+		inline uint8x16x4_t loadTable(const uint8_t* table) {
+			uint8x16x4_t tables;
+			tables.val[0] = vld1q_u8(table);
+			tables.val[1] = vld1q_u8(table + 16);
+			tables.val[2] = vld1q_u8(table + 32);
+			tables.val[3] = vld1q_u8(table + 48);
+			return tables;
+		}
+
+		size_t encodeBase64Blocks(const uint8_t* bytes, size_t size, char* output, const Base64Alphabet& alphabet) {
+			const uint8x16x4_t chars = loadTable((const uint8_t*)alphabet.chars);
+			const uint8x16_t lowSextet = vdupq_n_u8(0x3F);
+			size_t consumed = 0;
+			while((size - consumed) >= 48) {
+				// load 16 groups of 3 bytes, deinterleaved
+				uint8x16x3_t in = vld3q_u8(bytes + consumed);
+				uint8x16x4_t sextets;
+				sextets.val[0] = vshrq_n_u8(in.val[0], 2);
+				sextets.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), lowSextet);
+				sextets.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), lowSextet);
+				sextets.val[3] = vandq_u8(in.val[2], lowSextet);
+				for(size_t i=0; i<4; i++) {
+					sextets.val[i] = vqtbl4q_u8(chars, sextets.val[i]);
+				}
+				vst4q_u8((uint8_t*)output + ((consumed / 3) * 4), sextets);
+				consumed += 48;
+			}
+			return consumed;
+		}
+
+		size_t decodeBase64Blocks(const char* str, size_t length, uint8_t* output, const Base64Alphabet& alphabet) {
+			const uint8x16x4_t lowValues = loadTable(alphabet.values);
+			const uint8x16x4_t highValues = loadTable(alphabet.values + 64);
+			const uint8x16_t invalid = vdupq_n_u8(INVALID_SEXTET);
+			const uint8x16_t highBit = vdupq_n_u8(0x40);
+			size_t consumed = 0;
+			while((length - consumed) >= 64) {
+				// load 16 groups of 4 characters, deinterleaved
+				uint8x16x4_t in = vld4q_u8((const uint8_t*)str + consumed);
+				uint8x16_t invalidBits = vdupq_n_u8(0);
+				for(size_t i=0; i<4; i++) {
+					// characters 0-63 come from the first table and 64-127 from the second. Anything else stays invalid.
+					uint8x16_t sextets = vqtbx4q_u8(invalid, lowValues, in.val[i]);
+					in.val[i] = vqtbx4q_u8(sextets, highValues, veorq_u8(in.val[i], highBit));
+					invalidBits = vorrq_u8(invalidBits, in.val[i]);
+				}
+				if((vmaxvq_u8(invalidBits) & 0xC0) != 0) {
+					break;
+				}
+				uint8x16x3_t out;
+				out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+				out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+				out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+				vst3q_u8(output + ((consumed / 4) * 3), out);
+				consumed += 64;
+			}
+			return consumed;
+		}
+
+		#else
+
+		size_t encodeBase64Blocks(const uint8_t*, size_t, char*, const Base64Alphabet&) {
+			return 0;
+		}
+
+		size_t decodeBase64Blocks(const char*, size_t, uint8_t*, const Base64Alphabet&) {
+			return 0;
+		}
+
+		#endif
+
+		#if defined(FGL_BYTE_ENCODING_SIMD_SSE2)
+
+		inline __m128i hexDigits(__m128i nibbles) {
+			// '0' + n, plus the gap between '9' and 'a' for nibbles above 9
+			__m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+			return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+		}
+
+		size_t encodeHexBlocks(const uint8_t* bytes, size_t size, char* output) {
+			const __m128i lowNibble = _mm_set1_epi8(0x0F);
+			size_t consumed = 0;
+			while((size - consumed) >= 16) {
+				__m128i in = _mm_loadu_si128((const __m128i*)(bytes + consumed));
+				__m128i high = hexDigits(_mm_and_si128(_mm_srli_epi16(in, 4), lowNibble));
+				__m128i low = hexDigits(_mm_and_si128(in, lowNibble));
+				char* out = output + (consumed * 2);
+				_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(high, low));
+				_mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi8(high, low));
+				consumed += 16;
+			}
+			return consumed;
+		}
+
+		/// Converts hex characters to nibbles, and sets valid to 0xFF for each character that is a hex digit
+		inline __m128i hexNibbles(__m128i chars, __m128i& valid) {
+			__m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+			__m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+			__m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+			__m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+			valid = _mm_or_si128(isDigit, isLetter);
+			return _mm_or_si128(_mm_and_si128(isDigit, digits), _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+		}
+
+		size_t decodeHexBlocks(const char* str, size_t length, uint8_t* output) {
+			const __m128i lowByte = _mm_set1_epi16(0x00FF);
+			size_t consumed = 0;
+			while((length - consumed) >= 32) {
+				__m128i valid0, valid1;
+				__m128i nibbles0 = hexNibbles(_mm_loadu_si128((const __m128i*)(str + consumed)), valid0);
+				__m128i nibbles1 = hexNibbles(_mm_loadu_si128((const __m128i*)(str + consumed + 16)), valid1);
+				if(_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF) {
+					break;
+				}
+				// each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte
+				__m128i bytes0 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles0, lowByte), 4), _mm_srli_epi16(nibbles0, 8));
+				__m128i bytes1 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles1, lowByte), 4), _mm_srli_epi16(nibbles1, 8));
+				_mm_storeu_si128((__m128i*)(output + (consumed / 2)), _mm_packus_epi16(bytes0, bytes1));
+				consumed += 32;
+			}
+			return consumed;
+		}
+
+		#elif defined(FGL_BYTE_ENCODING_SIMD_NEON)
+
+		size_t encodeHexBlocks(const uint8_t* bytes, size_t size, char* output) {
+			const uint8_t digitChars[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+			const uint8x16_t digits = vld1q_u8(digitChars);
+			size_t consumed = 0;
+			while((size - consumed) >= 16) {
+				uint8x16_t in = vld1q_u8(bytes + consumed);
+				uint8x16x2_t out;
+				out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+				out.val[1] = vqtbl1q_u8(digits, vandq_u8(in, vdupq_n_u8(0x0F)));
+				vst2q_u8((uint8_t*)output + (consumed * 2), out);
+				consumed += 16;
+			}
+			return consumed;
+		}
+
+		inline uint8x16_t hexNibbles(uint8x16_t chars, uint8x16_t& valid) {
+			uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('0'));
+			uint8x16_t isDigit = vcleq_u8(digits, vdupq_n_u8(9));
+			uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+			uint8x16_t isLetter = vcleq_u8(letters, vdupq_n_u8(5));
+			valid = vorrq_u8(isDigit, isLetter);
+			return vbslq_u8(isDigit, digits, vaddq_u8(letters, vdupq_n_u8(10)));
+		}
+
+		size_t decodeHexBlocks(const char* str, size_t length, uint8_t* output) {
+			size_t consumed = 0;
+			while((length - consumed) >= 32) {
+				// load 16 pairs of characters, deinterleaved
+				uint8x16x2_t in = vld2q_u8((const uint8_t*)str + consumed);
+				uint8x16_t validHigh, validLow;
+				uint8x16_t high = hexNibbles(in.val[0], validHigh);
+				uint8x16_t low = hexNibbles(in.val[1], validLow);
+				if(vminvq_u8(vandq_u8(validHigh, validLow)) != 0xFF) {
+					break;
+				}
+				vst1q_u8(output + (consumed / 2), vorrq_u8(vshlq_n_u8(high, 4), low));
+				consumed += 32;
+			}
+			return consumed;
+		}
+
+		#else
+
+		size_t encodeHexBlocks(const uint8_t* bytes, size_t size, char* output) {
+			return 0;
+		}
+
+		size_t decodeHexBlocks(const char* str, size_t length, uint8_t* output) {
+			return 0;
+		}
+
+		#endif
+	}
+
+
+
+	#pragma mark Base64 implementation
+
+	size_t Base64::encode(const uint8_t* bytes, size_t size, char* output, Alphabet alphabet) noexcept {
+		auto& table = base64AlphabetFor(alphabet);
+		size_t i = encodeBase64Blocks(bytes, size, output, table);
+		char* out = output + ((i / 3) * 4);
+		for(; (size - i) >= 3; i += 3) {
+			uint32_t group = ((uint32_t)bytes[i] << 16) | ((uint32_t)bytes[i + 1] << 8) | (uint32_t)bytes[i + 2];
+			out[0] = table.chars[group >> 18];
+			out[1] = table.chars[(group >> 12) & 0x3F];
+			out[2] = table.chars[(group >> 6) & 0x3F];
+			out[3] = table.chars[group & 0x3F];
+			out += 4;
+		}
+		size_t remaining = size - i;
+		if(remaining > 0) {
+			uint32_t group = (uint32_t)bytes[i] << 16;
+			if(remaining == 2) {
+				group |= (uint32_t)bytes[i + 1] << 8;
+			}
+			out[0] = table.chars[group >> 18];
+			out[1] = table.chars[(group >> 12) & 0x3F];
+			out += 2;
+			if(remaining == 2) {
+				*out = table.chars[(group >> 6) & 0x3F];
+				out++;
+			}
+			if(alphabet == Alphabet::Standard) {
+				for(size_t j=remaining; j<3; j++) {
+					*out = '=';
+					out++;
+				}
+			}
+		}
+		return (size_t)(out - output);
+	}
+
+	size_t Base64::decode(std::string_view str, uint8_t* output, Alphabet alphabet) {
+		auto& table = base64AlphabetFor(alphabet);
+		size_t length = str.size();
+		if((length % 4) != 0 && (alphabet == Alphabet::Standard || (length % 4) == 1)) {
+			throw std::invalid_argument("Invalid base64 length " + std::to_string(length));
+		}
+		// strip padding, which is only allowed to complete the last group of 4
+		if((length % 4) == 0 && length > 0 && str[length - 1] == '=') {
+			length--;
+			if(str[length - 1] == '=') {
+				length--;
+			}
+		}
+		size_t i = decodeBase64Blocks(str.data(), length, output, table);
+		uint8_t* out = output + ((i / 4) * 3);
+		const uint8_t* chars = (const uint8_t*)str.data();
+		for(; (length - i) >= 4; i += 4) {
+			uint32_t a = table.values[chars[i]];
+			uint32_t b = table.values[chars[i + 1]];
+			uint32_t c = table.values[chars[i + 2]];
+			uint32_t d = table.values[chars[i + 3]];
+			if(((a | b | c | d) & 0xC0) != 0) {
+				throwInvalidBase64(table, str, i, 4);
+			}
+			uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+			out[0] = (uint8_t)(group >> 16);
+			out[1] = (uint8_t)(group >> 8);
+			out[2] = (uint8_t)group;
+			out += 3;
+		}
+		size_t remaining = length - i;
+		if(remaining > 0) {
+			uint32_t a = table.values[chars[i]];
+			uint32_t b = table.values[chars[i + 1]];
+			uint32_t c = (remaining == 3) ? table.values[chars[i + 2]] : 0;
+			if(((a | b | c) & 0xC0) != 0) {
+				throwInvalidBase64(table, str, i, remaining);
+			}
+			uint32_t group = (a << 18) | (b << 12) | (c << 6);
+			// reject encodings with bits set past the end of the data, so each byte sequence has exactly one encoding
+			uint32_t unusedBits = (remaining == 2) ? (group & 0xFFFF) : (group & 0xFF);
+			if(unusedBits != 0) {
+				throw std::invalid_argument("Invalid base64 trailing bits at offset " + std::to_string(i + remaining - 1));
+			}
+			out[0] = (uint8_t)(group >> 16);
+			out++;
+			if(remaining == 3) {
+				*out = (uint8_t)(group >> 8);
+				out++;
+			}
+		}
+		return (size_t)(out - output);
+	}
+
+
+
+	#pragma mark Hex implementation
+
+	void Hex::encode(const uint8_t* bytes, size_t size, char* output) noexcept {
+		size_t i = encodeHexBlocks(bytes, size, output);
+		for(; i<size; i++) {
+			std::memcpy(output + (i * 2), hexTable.pairs + (bytes[i] * 2), 2);
+		}
+	}
+
+	void Hex::decode(std::string_view str, uint8_t* output) {
+		size_t length = str.size();
+		if((length % 2) != 0) {
+			throw std::invalid_argument("Invalid hex length " + std::to_string(length));
+		}
+		size_t i = decodeHexBlocks(str.data(), length, output);
+		const uint8_t* chars = (const uint8_t*)str.data();
+		for(; i<length; i+=2) {
+			uint8_t high = hexTable.values[chars[i]];
+			uint8_t low = hexTable.values[chars[i + 1]];
+			if(((high | low) & 0xF0) != 0) {
+				throwInvalidHex(str, i, 2);
+			}
+			output[i / 2] = (uint8_t)((high << 4) | low);
+		}
+	}
+
+
+
+	#pragma mark Data implementation
+
+	String Data::toBase64() const {
+		String str(Base64::encodedSize(size()), '\0');
+		Base64::encode(data(), size(), str.data());
+		return str;
+	}
+
+	String Data::toBase64URL() const {
+		String str(Base64::encodedSize(size(), Base64::Alphabet::URL), '\0');
+		Base64::encode(data(), size(), str.data(), Base64::Alphabet::URL);
+		return str;
+	}
+
+	String Data::toHex() const {
+		String str(Hex::encodedSize(size()), '\0');
+		Hex::encode(data(), size(), str.data());
+		return str;
+	}
+
+	Data Data::fromBase64(std::string_view str) {
+		Data data(Base64::maxDecodedSize(str.size()));
+		data.resize(Base64::decode(str, data.data()));
+		return data;
+	}
+
+	Data Data::fromBase64URL(std::string_view str) {
+		Data data(Base64::maxDecodedSize(str.size()));
+		data.resize(Base64::decode(str, data.data(), Base64::Alphabet::URL));
+		return data;
+	}
+
+	Data Data::fromHex(std::string_view str) {
+		Data data(Hex::decodedSize(str.size()));
+		Hex::decode(str, data.data());
+		return data;
+	}
+}
@@ -0,0 +1,83 @@
+//
+//  ByteEncoding.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <string_view>
+
+namespace fgl {
+	/// Base64 encoding from RFC 4648, into and out of caller provided buffers.
+	/// Data::toBase64 and Data::fromBase64 wrap these for whole buffers.
+	class Base64 {
+	public:
+		enum class Alphabet {
+			/// The standard alphabet, with '+' and '/'. Encoded output is always padded, and padding is required when decoding.
+			Standard,
+			/// The URL and filename safe alphabet, with '-' and '_'. Encoded output is never padded, and padding is optional when decoding.
+			URL
+		};
+
+		Base64() = delete;
+
+		/// The exact number of characters that encode writes for the given number of bytes
+		static constexpr size_t encodedSize(size_t byteCount, Alphabet alphabet = Alphabet::Standard) noexcept;
+		/// The most bytes that decode can write for an input of the given length
+		static constexpr size_t maxDecodedSize(size_t length) noexcept;
+
+		/// Writes exactly encodedSize(size, alphabet) characters to output, and returns that number
+		static size_t encode(const uint8_t* bytes, size_t size, char* output, Alphabet alphabet = Alphabet::Standard) noexcept;
+		/// Validates and decodes the given characters in one pass, writing at most maxDecodedSize(str.size()) bytes to output.
+		/// Returns the number of bytes written, or throws std::invalid_argument with the offset of the first invalid character.
+		static size_t decode(std::string_view str, uint8_t* output, Alphabet alphabet = Alphabet::Standard);
+	};
+
+
+	/// Lowercase hexadecimal encoding, into and out of caller provided buffers.
+	/// Data::toHex and Data::fromHex wrap these for whole buffers.
+	class Hex {
+	public:
+		Hex() = delete;
+
+		static constexpr size_t encodedSize(size_t byteCount) noexcept;
+		static constexpr size_t decodedSize(size_t length) noexcept;
+
+		/// Writes exactly encodedSize(size) characters to output
+		static void encode(const uint8_t* bytes, size_t size, char* output) noexcept;
+		/// Validates and decodes the given characters in one pass, writing decodedSize(str.size()) bytes to output.
+		/// Both uppercase and lowercase digits are accepted. Throws std::invalid_argument if the input has an odd length or an invalid character.
+		static void decode(std::string_view str, uint8_t* output);
+	};
+
+
+
+#pragma mark Base64 implementation
+
+	constexpr size_t Base64::encodedSize(size_t byteCount, Alphabet alphabet) noexcept {
+		if(alphabet == Alphabet::URL) {
+			return (byteCount / 3) * 4 + ((byteCount % 3) == 0 ? 0 : (byteCount % 3) + 1);
+		}
+		return ((byteCount + 2) / 3) * 4;
+	}
+
+	constexpr size_t Base64::maxDecodedSize(size_t length) noexcept {
+		return (length / 4) * 3 + ((length % 4) * 3) / 4;
+	}
+
+
+
+#pragma mark Hex implementation
+
+	constexpr size_t Hex::encodedSize(size_t byteCount) noexcept {
+		return byteCount * 2;
+	}
+
+	constexpr size_t Hex::decodedSize(size_t length) noexcept {
+		return length / 2;
+	}
+}
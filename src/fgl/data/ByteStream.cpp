@@ -0,0 +1,88 @@
+//
+//  ByteStream.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/ByteStream.hpp>
+
+namespace fgl {
+	namespace {
+		constexpr size_t MIN_WRITER_CAPACITY = 64;
+	}
+
+
+
+	#pragma mark ByteWriter implementation
+
+	ByteWriter::ByteWriter()
+	: _size(0) {
+		//
+	}
+
+	ByteWriter::ByteWriter(size_t capacity)
+	: _buffer(capacity), _size(0) {
+		//
+	}
+
+	ByteWriter::ByteWriter(Data&& buffer)
+	: _buffer(std::move(buffer)), _size(_buffer.size()) {
+		//
+	}
+
+	Data ByteWriter::take() {
+		_buffer.resize(_size);
+		Data data = std::move(_buffer);
+		_buffer = Data();
+		_size = 0;
+		return data;
+	}
+
+	uint8_t* ByteWriter::grow(size_t count) {
+		if(count > (_buffer.max_size() - _size)) {
+			throw std::length_error("ByteWriter cannot grow past its maximum size");
+		}
+		size_t capacity = std::max({ _size + count, _buffer.size() * 2, MIN_WRITER_CAPACITY });
+		_buffer.resize(capacity);
+		return _buffer.data() + _size;
+	}
+
+
+
+	#pragma mark ByteReader implementation
+
+	ByteReader::ByteReader(const void* bytes, size_t size) noexcept
+	: _begin((const uint8_t*)bytes), _position((const uint8_t*)bytes), _end((const uint8_t*)bytes + size) {
+		//
+	}
+
+	ByteReader::ByteReader(DataView bytes) noexcept
+	: ByteReader(bytes.data(), bytes.size()) {
+		//
+	}
+
+	void ByteReader::seek(size_t offset) {
+		if(offset > (size_t)(_end - _begin)) {
+			fail("Cannot seek to offset " + std::to_string(offset) + " past the end of " + std::to_string(_end - _begin) + " bytes");
+		}
+		_position = _begin + offset;
+	}
+
+	uint64_t ByteReader::readVarintSlow() {
+		uint64_t value = 0;
+		if(auto error = _Varint::decode(_position, _end, value)) {
+			fail(error);
+		}
+		return value;
+	}
+
+	void ByteReader::fail(const std::string& message) const {
+		throw BinaryDecodeError(message, offset());
+	}
+
+	void ByteReader::failEnd(size_t size) const {
+		fail("Cannot read " + std::to_string(size) + " bytes with only " + std::to_string(remaining()) + " remaining");
+	}
+}
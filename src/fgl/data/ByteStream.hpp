@@ -0,0 +1,423 @@
+//
+//  ByteStream.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/Binary.hpp>
+#include <fgl/data/Data.hpp>
+#include <fgl/data/DataView.hpp>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace fgl {
+	template<typename T>
+	concept _ByteStreamValue = std::is_arithmetic_v<T> && !std::is_same_v<T,bool>;
+
+	/// Reverses the bytes of an integer or floating point value
+	template<_ByteStreamValue T>
+	inline T byteSwap(T value) noexcept;
+
+
+	/// Writes fixed width values in either byte order, varints, and length prefixed strings into a growable buffer.
+	class ByteWriter {
+	public:
+		/// A slot reserved for a value that isn't known until later, such as the length of what follows it
+		template<_ByteStreamValue T>
+		struct Placeholder {
+			size_t offset;
+		};
+
+		ByteWriter();
+		explicit ByteWriter(size_t capacity);
+		/// Appends to the given buffer
+		explicit ByteWriter(Data&& buffer);
+
+		inline size_t size() const noexcept;
+		inline size_t capacity() const noexcept;
+		inline void reserve(size_t capacity);
+		/// A view of the bytes written so far, which is invalidated by the next write
+		inline DataView view() const noexcept;
+		/// Moves the written bytes out, leaving the writer empty
+		Data take();
+
+		inline void writeU8(uint8_t value);
+		inline void writeU16LE(uint16_t value);
+		inline void writeU16BE(uint16_t value);
+		inline void writeU32LE(uint32_t value);
+		inline void writeU32BE(uint32_t value);
+		inline void writeU64LE(uint64_t value);
+		inline void writeU64BE(uint64_t value);
+		template<_ByteStreamValue T>
+		inline void writeLE(T value);
+		template<_ByteStreamValue T>
+		inline void writeBE(T value);
+
+		/// Writes a varint in the same encoding as BinaryEncoder
+		inline void writeVarint(uint64_t value);
+		/// Writes a zigzag encoded varint in the same encoding as BinaryEncoder
+		inline void writeSignedVarint(int64_t value);
+		/// Writes bytes as they are, without a length prefix
+		inline void writeRaw(const void* bytes, size_t size);
+		/// Writes a varint length prefix followed by the bytes
+		inline void writeBytes(std::span<const uint8_t> bytes);
+		inline void writeString(std::string_view str);
+
+		/// Reserves space for a value to be written later with patchLE or patchBE
+		template<_ByteStreamValue T>
+		inline Placeholder<T> placeholder();
+		template<_ByteStreamValue T>
+		inline void patchLE(Placeholder<T> placeholder, T value) noexcept;
+		template<_ByteStreamValue T>
+		inline void patchBE(Placeholder<T> placeholder, T value) noexcept;
+
+	private:
+		/// Makes room for at least count more bytes and returns where they start
+		inline uint8_t* ensure(size_t count);
+		uint8_t* grow(size_t count);
+		template<std::endian Order, typename T>
+		inline void writeOrdered(T value);
+		template<std::endian Order, typename T>
+		inline void storeOrdered(size_t offset, T value) noexcept;
+
+		/// The buffer is kept resized to its capacity, and _size tracks how much of it has been written
+		Data _buffer;
+		size_t _size;
+	};
+
+
+	/// A bounds checked cursor that reads fixed width values in either byte order, varints, and length prefixed strings.
+	/// It doesn't own the bytes, and strings and byte ranges it reads are views into them, so reads never allocate.
+	/// Reading past the end throws BinaryDecodeError.
+	class ByteReader {
+	public:
+		ByteReader(const void* bytes, size_t size) noexcept;
+		ByteReader(DataView bytes) noexcept;
+
+		inline uint8_t readU8();
+		inline uint16_t readU16LE();
+		inline uint16_t readU16BE();
+		inline uint32_t readU32LE();
+		inline uint32_t readU32BE();
+		inline uint64_t readU64LE();
+		inline uint64_t readU64BE();
+		template<_ByteStreamValue T>
+		inline T readLE();
+		template<_ByteStreamValue T>
+		inline T readBE();
+
+		inline uint64_t readVarint();
+		inline int64_t readSignedVarint();
+		/// Reads bytes without a length prefix
+		inline void readRaw(void* bytes, size_t size);
+		/// Returns a view of the next size bytes
+		inline DataView readView(size_t size);
+		/// Reads a varint length prefix and returns a view of the bytes that follow it
+		inline DataView readBytes();
+		inline std::string_view readString();
+		inline void skip(size_t size);
+		void seek(size_t offset);
+
+		/// The number of bytes read so far
+		inline size_t offset() const noexcept;
+		inline size_t remaining() const noexcept;
+		inline bool atEnd() const noexcept;
+
+		[[noreturn]] void fail(const std::string& message) const;
+
+	private:
+		template<std::endian Order, typename T>
+		inline T readOrdered();
+		uint64_t readVarintSlow();
+		[[noreturn]] void failEnd(size_t size) const;
+
+		const uint8_t* _begin;
+		const uint8_t* _position;
+		const uint8_t* _end;
+	};
+
+
+
+#pragma mark byteSwap implementation
+
+	template<_ByteStreamValue T>
+	T byteSwap(T value) noexcept {
+		if constexpr(sizeof(T) == 1) {
+			return value;
+		} else {
+			using Bits = std::conditional_t<sizeof(T) == 2,uint16_t,std::conditional_t<sizeof(T) == 4,uint32_t,uint64_t>>;
+			Bits bits = std::bit_cast<Bits>(value);
+			if constexpr(sizeof(T) == 2) {
+				bits = (Bits)((bits >> 8) | (bits << 8));
+			} else if constexpr(sizeof(T) == 4) {
+				bits = ((bits >> 24) & 0x000000FF) | ((bits >> 8) & 0x0000FF00) | ((bits << 8) & 0x00FF0000) | (bits << 24);
+			} else {
+				bits = ((bits >> 56) & 0x00000000000000FF) | ((bits >> 40) & 0x000000000000FF00)
+					| ((bits >> 24) & 0x0000000000FF0000) | ((bits >> 8) & 0x00000000FF000000)
+					| ((bits << 8) & 0x000000FF00000000) | ((bits << 24) & 0x0000FF0000000000)
+					| ((bits << 40) & 0x00FF000000000000) | (bits << 56);
+			}
+			return std::bit_cast<T>(bits);
+		}
+	}
+
+
+
+#pragma mark ByteWriter implementation
+
+	size_t ByteWriter::size() const noexcept {
+		return _size;
+	}
+
+	size_t ByteWriter::capacity() const noexcept {
+		return _buffer.size();
+	}
+
+	void ByteWriter::reserve(size_t capacity) {
+		if(capacity > _buffer.size()) {
+			_buffer.resize(capacity);
+		}
+	}
+
+	DataView ByteWriter::view() const noexcept {
+		return DataView(_buffer.data(), _size);
+	}
+
+	uint8_t* ByteWriter::ensure(size_t count) {
+		if((_buffer.size() - _size) < count) {
+			return grow(count);
+		}
+		return _buffer.data() + _size;
+	}
+
+	template<std::endian Order, typename T>
+	void ByteWriter::writeOrdered(T value) {
+		if constexpr(Order != std::endian::native) {
+			value = byteSwap(value);
+		}
+		std::memcpy(ensure(sizeof(T)), &value, sizeof(T));
+		_size += sizeof(T);
+	}
+
+	template<std::endian Order, typename T>
+	void ByteWriter::storeOrdered(size_t offset, T value) noexcept {
+		if constexpr(Order != std::endian::native) {
+			value = byteSwap(value);
+		}
+		std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+	}
+
+	void ByteWriter::writeU8(uint8_t value) {
+		*ensure(1) = value;
+		_size++;
+	}
+
+	void ByteWriter::writeU16LE(uint16_t value) {
+		writeOrdered<std::endian::little>(value);
+	}
+
+	void ByteWriter::writeU16BE(uint16_t value) {
+		writeOrdered<std::endian::big>(value);
+	}
+
+	void ByteWriter::writeU32LE(uint32_t value) {
+		writeOrdered<std::endian::little>(value);
+	}
+
+	void ByteWriter::writeU32BE(uint32_t value) {
+		writeOrdered<std::endian::big>(value);
+	}
+
+	void ByteWriter::writeU64LE(uint64_t value) {
+		writeOrdered<std::endian::little>(value);
+	}
+
+	void ByteWriter::writeU64BE(uint64_t value) {
+		writeOrdered<std::endian::big>(value);
+	}
+
+	template<_ByteStreamValue T>
+	void ByteWriter::writeLE(T value) {
+		writeOrdered<std::endian::little>(value);
+	}
+
+	template<_ByteStreamValue T>
+	void ByteWriter::writeBE(T value) {
+		writeOrdered<std::endian::big>(value);
+	}
+
+	void ByteWriter::writeVarint(uint64_t value) {
+		_size += _Varint::encode(value, ensure(_Varint::MAX_SIZE));
+	}
+
+	void ByteWriter::writeSignedVarint(int64_t value) {
+		writeVarint(_Varint::zigzagEncode(value));
+	}
+
+	void ByteWriter::writeRaw(const void* bytes, size_t size) {
+		if(size == 0) {
+			return;
+		}
+		std::memcpy(ensure(size), bytes, size);
+		_size += size;
+	}
+
+	void ByteWriter::writeBytes(std::span<const uint8_t> bytes) {
+		writeVarint(bytes.size());
+		writeRaw(bytes.data(), bytes.size());
+	}
+
+	void ByteWriter::writeString(std::string_view str) {
+		writeVarint(str.size());
+		writeRaw(str.data(), str.size());
+	}
+
+	template<_ByteStreamValue T>
+	ByteWriter::Placeholder<T> ByteWriter::placeholder() {
+		size_t offset = _size;
+		std::memset(ensure(sizeof(T)), 0, sizeof(T));
+		_size += sizeof(T);
+		return Placeholder<T>{ offset };
+	}
+
+	template<_ByteStreamValue T>
+	void ByteWriter::patchLE(Placeholder<T> placeholder, T value) noexcept {
+		storeOrdered<std::endian::little>(placeholder.offset, value);
+	}
+
+	template<_ByteStreamValue T>
+	void ByteWriter::patchBE(Placeholder<T> placeholder, T value) noexcept {
+		storeOrdered<std::endian::big>(placeholder.offset, value);
+	}
+
+
+
+#pragma mark ByteReader implementation
+
+	template<std::endian Order, typename T>
+	T ByteReader::readOrdered() {
+		if((size_t)(_end - _position) < sizeof(T)) {
+			failEnd(sizeof(T));
+		}
+		T value;
+		std::memcpy(&value, _position, sizeof(T));
+		_position += sizeof(T);
+		if constexpr(Order != std::endian::native) {
+			value = byteSwap(value);
+		}
+		return value;
+	}
+
+	uint8_t ByteReader::readU8() {
+		if(_position == _end) {
+			failEnd(1);
+		}
+		uint8_t value = *_position;
+		_position++;
+		return value;
+	}
+
+	uint16_t ByteReader::readU16LE() {
+		return readOrdered<std::endian::little,uint16_t>();
+	}
+
+	uint16_t ByteReader::readU16BE() {
+		return readOrdered<std::endian::big,uint16_t>();
+	}
+
+	uint32_t ByteReader::readU32LE() {
+		return readOrdered<std::endian::little,uint32_t>();
+	}
+
+	uint32_t ByteReader::readU32BE() {
+		return readOrdered<std::endian::big,uint32_t>();
+	}
+
+	uint64_t ByteReader::readU64LE() {
+		return readOrdered<std::endian::little,uint64_t>();
+	}
+
+	uint64_t ByteReader::readU64BE() {
+		return readOrdered<std::endian::big,uint64_t>();
+	}
+
+	template<_ByteStreamValue T>
+	T ByteReader::readLE() {
+		return readOrdered<std::endian::little,T>();
+	}
+
+	template<_ByteStreamValue T>
+	T ByteReader::readBE() {
+		return readOrdered<std::endian::big,T>();
+	}
+
+	uint64_t ByteReader::readVarint() {
+		uint64_t value;
+		if(_Varint::decodeFast(_position, _end, value)) {
+			return value;
+		}
+		return readVarintSlow();
+	}
+
+	int64_t ByteReader::readSignedVarint() {
+		return _Varint::zigzagDecode(readVarint());
+	}
+
+	void ByteReader::readRaw(void* bytes, size_t size) {
+		if((size_t)(_end - _position) < size) {
+			failEnd(size);
+		} else if(size == 0) {
+			return;
+		}
+		std::memcpy(bytes, _position, size);
+		_position += size;
+	}
+
+	DataView ByteReader::readView(size_t size) {
+		if((size_t)(_end - _position) < size) {
+			failEnd(size);
+		}
+		auto view = DataView(_position, size);
+		_position += size;
+		return view;
+	}
+
+	DataView ByteReader::readBytes() {
+		uint64_t size = readVarint();
+		if(size > (uint64_t)(_end - _position)) {
+			failEnd((size_t)std::min(size, (uint64_t)SIZE_MAX));
+		}
+		return readView((size_t)size);
+	}
+
+	std::string_view ByteReader::readString() {
+		return readBytes().stringView();
+	}
+
+	void ByteReader::skip(size_t size) {
+		if((size_t)(_end - _position) < size) {
+			failEnd(size);
+		}
+		_position += size;
+	}
+
+	size_t ByteReader::offset() const noexcept {
+		return (size_t)(_position - _begin);
+	}
+
+	size_t ByteReader::remaining() const noexcept {
+		return (size_t)(_end - _position);
+	}
+
+	bool ByteReader::atEnd() const noexcept {
+		return _position == _end;
+	}
+}
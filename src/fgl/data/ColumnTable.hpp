@@ -0,0 +1,923 @@
+//
+//  ColumnTable.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/BasicString.hpp>
+#include <fgl/data/Stringify.hpp>
+#include <fgl/data/Traits.hpp>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fgl {
+	template<typename... Fields>
+	class ColumnTable;
+
+
+	/// A reference to a single row of a ColumnTable.
+	/// Fields are accessed with get<Index>(), which also allows structured bindings.
+	template<typename Table, bool Const>
+	class ColumnTableRow {
+		template<typename... Fields>
+		friend class ColumnTable;
+		template<typename, bool>
+		friend class ColumnTableRow;
+	public:
+		using TableType = std::conditional_t<Const, const Table, Table>;
+		using TupleType = typename Table::TupleType;
+		using size_type = typename Table::size_type;
+		template<size_t Index>
+		using FieldType = typename Table::template FieldType<Index>;
+		template<size_t Index>
+		using ReferenceType = std::conditional_t<Const, const FieldType<Index>&, FieldType<Index>&>;
+
+		template<bool C = Const, typename = std::enable_if_t<C>>
+		ColumnTableRow(const ColumnTableRow<Table,false>& row) noexcept;
+
+		template<size_t Index>
+		inline ReferenceType<Index> get() const;
+		inline size_type index() const noexcept;
+
+		inline TupleType toTuple() const;
+		inline operator TupleType() const;
+		template<typename Struct>
+		inline Struct toStruct() const;
+
+		template<bool C = Const, typename = std::enable_if_t<!C>>
+		inline const ColumnTableRow& operator=(const TupleType& values) const;
+
+		inline bool operator==(const TupleType& values) const;
+		inline bool operator!=(const TupleType& values) const;
+
+	private:
+		inline ColumnTableRow(TableType* table, size_type index) noexcept;
+
+		template<size_t... Indexes>
+		inline TupleType toTuple(std::index_sequence<Indexes...>) const;
+
+		TableType* _table;
+		size_type _index;
+	};
+
+
+	/// A list of records stored as one contiguous array per field (structure of arrays).
+	/// Scanning a single column only touches the memory of that column, and the column scan
+	/// functions take a field index, such as countWhere<1>(predicate), and loop over a plain array.
+	/// Iterating the table itself yields ColumnTableRow references.
+	template<typename... Fields>
+	class ColumnTable {
+		static_assert(sizeof...(Fields) > 0, "ColumnTable must have at least one field");
+		// std::vector<bool> packs its values into bits, so it can't give out references or contiguous spans
+		static_assert((!std::is_same_v<std::remove_cv_t<Fields>,bool> && ...), "ColumnTable can't store bool fields. Use uint8_t instead.");
+		template<typename, bool>
+		friend class ColumnTableRow;
+	public:
+		using TupleType = std::tuple<Fields...>;
+		template<size_t Index>
+		using FieldType = std::tuple_element_t<Index,TupleType>;
+
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using Row = ColumnTableRow<ColumnTable,false>;
+		using ConstRow = ColumnTableRow<ColumnTable,true>;
+
+		template<bool Const>
+		class Iterator {
+			friend class ColumnTable;
+			template<bool> friend class Iterator;
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = TupleType;
+			using difference_type = std::ptrdiff_t;
+			using reference = std::conditional_t<Const, ConstRow, Row>;
+			using pointer = void;
+
+			Iterator() noexcept: _table(nullptr), _index(0) {
+				//
+			}
+
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			Iterator(const Iterator<false>& it) noexcept: _table(it._table), _index(it._index) {
+				//
+			}
+
+			inline reference operator*() const {
+				return reference(_table, _index);
+			}
+
+			inline reference operator[](difference_type offset) const {
+				return reference(_table, _index + offset);
+			}
+
+			inline Iterator& operator++() {
+				_index++;
+				return *this;
+			}
+
+			inline Iterator operator++(int) {
+				auto copy = *this;
+				_index++;
+				return copy;
+			}
+
+			inline Iterator& operator--() {
+				_index--;
+				return *this;
+			}
+
+			inline Iterator operator--(int) {
+				auto copy = *this;
+				_index--;
+				return copy;
+			}
+
+			inline Iterator& operator+=(difference_type offset) {
+				_index += offset;
+				return *this;
+			}
+
+			inline Iterator& operator-=(difference_type offset) {
+				_index -= offset;
+				return *this;
+			}
+
+			inline Iterator operator+(difference_type offset) const {
+				return Iterator(_table, _index + offset);
+			}
+
+			inline Iterator operator-(difference_type offset) const {
+				return Iterator(_table, _index - offset);
+			}
+
+			inline friend Iterator operator+(difference_type offset, const Iterator& it) {
+				return it + offset;
+			}
+
+			template<bool C>
+			inline difference_type operator-(const Iterator<C>& it) const {
+				return (difference_type)_index - (difference_type)it._index;
+			}
+
+			template<bool C>
+			inline bool operator==(const Iterator<C>& it) const {
+				return _index == it._index;
+			}
+
+			template<bool C>
+			inline bool operator!=(const Iterator<C>& it) const {
+				return _index != it._index;
+			}
+
+			template<bool C>
+			inline bool operator<(const Iterator<C>& it) const {
+				return _index < it._index;
+			}
+
+			template<bool C>
+			inline bool operator<=(const Iterator<C>& it) const {
+				return _index <= it._index;
+			}
+
+			template<bool C>
+			inline bool operator>(const Iterator<C>& it) const {
+				return _index > it._index;
+			}
+
+			template<bool C>
+			inline bool operator>=(const Iterator<C>& it) const {
+				return _index >= it._index;
+			}
+
+		private:
+			using TableType = std::conditional_t<Const, const ColumnTable, ColumnTable>;
+
+			Iterator(TableType* table, size_type index) noexcept: _table(table), _index(index) {
+				//
+			}
+
+			TableType* _table;
+			size_type _index;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		static constexpr size_t columnCount = sizeof...(Fields);
+		static constexpr size_type npos = (size_type)-1;
+
+		ColumnTable();
+		ColumnTable(std::initializer_list<TupleType> rows);
+		template<typename Collection, typename = IsCollectionOf<TupleType,std::decay_t<Collection>>>
+		ColumnTable(const Collection& rows);
+		/// Copies the given members out of each struct in the collection, one member per column
+		template<typename Collection, typename Struct>
+		ColumnTable(const Collection& records, Fields Struct::*... members);
+
+		inline size_type size() const noexcept;
+		inline bool empty() const noexcept;
+		inline size_type capacity() const noexcept;
+		void reserve(size_type capacity);
+		void resize(size_type size);
+		void shrinkToFit();
+		void clear() noexcept;
+
+		inline iterator begin();
+		inline const_iterator begin() const;
+		inline const_iterator cbegin() const;
+		inline iterator end();
+		inline const_iterator end() const;
+		inline const_iterator cend() const;
+
+		inline Row operator[](size_type index) noexcept;
+		inline ConstRow operator[](size_type index) const noexcept;
+		Row at(size_type index);
+		ConstRow at(size_type index) const;
+
+		/// The contiguous values of a single field
+		template<size_t Index>
+		inline std::span<FieldType<Index>> column() noexcept;
+		template<size_t Index>
+		inline std::span<const FieldType<Index>> column() const noexcept;
+
+		/// Adds a row. If adding any field throws, the fields already added are removed again, so every column keeps the same size.
+		void pushBack(const TupleType& row);
+		void pushBack(TupleType&& row);
+		template<typename... Args>
+		void emplaceBack(Args&&... values);
+		void popBack();
+
+		void removeAt(size_type index);
+		template<typename Predicate>
+		size_type removeWhere(Predicate predicate);
+		template<size_t Index, typename Predicate>
+		size_type removeWhere(Predicate predicate);
+
+		template<typename Predicate>
+		size_type countWhere(Predicate predicate) const;
+		template<size_t Index, typename Predicate>
+		size_type countWhere(Predicate predicate) const;
+
+		template<typename Predicate>
+		inline bool containsWhere(Predicate predicate) const;
+		template<size_t Index, typename Predicate>
+		inline bool containsWhere(Predicate predicate) const;
+
+		template<typename Predicate>
+		size_type indexWhere(Predicate predicate) const;
+		template<size_t Index, typename Predicate>
+		size_type indexWhere(Predicate predicate) const;
+
+		template<typename Predicate>
+		ColumnTable where(Predicate predicate) const;
+		template<size_t Index, typename Predicate>
+		ColumnTable where(Predicate predicate) const;
+
+		template<typename T, typename Transform>
+		T reduce(T initialValue, Transform transform) const;
+		template<size_t Index, typename T, typename Transform>
+		T reduce(T initialValue, Transform transform) const;
+
+		/// Converts each row into a tuple, or into an aggregate initialized from the fields in order
+		template<typename Struct = TupleType>
+		ArrayList<Struct> toArrayList() const;
+		/// Converts each row into a default-constructed struct with the given members assigned, one member per column
+		template<typename Struct>
+		ArrayList<Struct> toArrayList(Fields Struct::*... members) const;
+
+		bool operator==(const ColumnTable& table) const;
+		bool operator!=(const ColumnTable& table) const;
+
+		String toString() const;
+		void toString(StringifyWriter& writer) const;
+
+	private:
+		template<size_t... Indexes, typename Collection, typename Struct>
+		void appendStructs(std::index_sequence<Indexes...>, const Collection& records, Fields Struct::*... members);
+		template<typename Append>
+		void appendOrRollBack(Append append);
+		template<typename Struct, size_t... Indexes>
+		inline Struct rowToStruct(std::index_sequence<Indexes...>, size_type index) const;
+		template<typename Struct, size_t... Indexes>
+		inline Struct rowToStruct(std::index_sequence<Indexes...>, size_type index, Fields Struct::*... members) const;
+		template<typename Function>
+		inline void forEachColumn(Function function);
+		template<typename Function>
+		inline void forEachColumn(Function function) const;
+		void keepRows(const std::vector<size_type>& indexes);
+		ColumnTable selectRows(const std::vector<size_type>& indexes) const;
+
+		std::tuple<std::vector<Fields>...> _columns;
+	};
+
+
+
+#pragma mark ColumnTableRow implementation
+
+	template<typename Table, bool Const>
+	ColumnTableRow<Table,Const>::ColumnTableRow(TableType* table, size_type index) noexcept
+	: _table(table), _index(index) {
+		//
+	}
+
+	template<typename Table, bool Const>
+	template<bool C, typename _>
+	ColumnTableRow<Table,Const>::ColumnTableRow(const ColumnTableRow<Table,false>& row) noexcept
+	: _table(row._table), _index(row._index) {
+		//
+	}
+
+	template<typename Table, bool Const>
+	template<size_t Index>
+	typename ColumnTableRow<Table,Const>::template ReferenceType<Index> ColumnTableRow<Table,Const>::get() const {
+		return std::get<Index>(_table->_columns)[_index];
+	}
+
+	template<typename Table, bool Const>
+	typename ColumnTableRow<Table,Const>::size_type ColumnTableRow<Table,Const>::index() const noexcept {
+		return _index;
+	}
+
+	template<typename Table, bool Const>
+	typename ColumnTableRow<Table,Const>::TupleType ColumnTableRow<Table,Const>::toTuple() const {
+		return toTuple(std::make_index_sequence<std::tuple_size_v<TupleType>>());
+	}
+
+	template<typename Table, bool Const>
+	template<size_t... Indexes>
+	typename ColumnTableRow<Table,Const>::TupleType ColumnTableRow<Table,Const>::toTuple(std::index_sequence<Indexes...>) const {
+		return TupleType(get<Indexes>()...);
+	}
+
+	template<typename Table, bool Const>
+	ColumnTableRow<Table,Const>::operator TupleType() const {
+		return toTuple();
+	}
+
+	template<typename Table, bool Const>
+	template<typename Struct>
+	Struct ColumnTableRow<Table,Const>::toStruct() const {
+		return _table->template rowToStruct<Struct>(std::make_index_sequence<std::tuple_size_v<TupleType>>(), _index);
+	}
+
+	template<typename Table, bool Const>
+	template<bool C, typename _>
+	const ColumnTableRow<Table,Const>& ColumnTableRow<Table,Const>::operator=(const TupleType& values) const {
+		[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+			((get<Indexes>() = std::get<Indexes>(values)), ...);
+		}(std::make_index_sequence<std::tuple_size_v<TupleType>>());
+		return *this;
+	}
+
+	template<typename Table, bool Const>
+	bool ColumnTableRow<Table,Const>::operator==(const TupleType& values) const {
+		return [&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+			return ((get<Indexes>() == std::get<Indexes>(values)) && ...);
+		}(std::make_index_sequence<std::tuple_size_v<TupleType>>());
+	}
+
+	template<typename Table, bool Const>
+	bool ColumnTableRow<Table,Const>::operator!=(const TupleType& values) const {
+		return !operator==(values);
+	}
+
+
+
+#pragma mark ColumnTable implementation
+
+	template<typename... Fields>
+	ColumnTable<Fields...>::ColumnTable() {
+		//
+	}
+
+	template<typename... Fields>
+	ColumnTable<Fields...>::ColumnTable(std::initializer_list<TupleType> rows) {
+		reserve(rows.size());
+		for(auto& row : rows) {
+			pushBack(row);
+		}
+	}
+
+	template<typename... Fields>
+	template<typename Collection, typename _>
+	ColumnTable<Fields...>::ColumnTable(const Collection& rows) {
+		reserve(rows.size());
+		for(auto& row : rows) {
+			pushBack(row);
+		}
+	}
+
+	template<typename... Fields>
+	template<typename Collection, typename Struct>
+	ColumnTable<Fields...>::ColumnTable(const Collection& records, Fields Struct::*... members) {
+		appendStructs(std::index_sequence_for<Fields...>(), records, members...);
+	}
+
+	template<typename... Fields>
+	template<size_t... Indexes, typename Collection, typename Struct>
+	void ColumnTable<Fields...>::appendStructs(std::index_sequence<Indexes...>, const Collection& records, Fields Struct::*... members) {
+		appendOrRollBack([&]() {
+			reserve(size() + records.size());
+			// fill one column at a time so that each pass writes to a single array
+			([&](auto& column, auto member) {
+				for(auto& record : records) {
+					column.push_back(record.*member);
+				}
+			}(std::get<Indexes>(_columns), members), ...);
+		});
+	}
+
+	template<typename... Fields>
+	template<typename Append>
+	void ColumnTable<Fields...>::appendOrRollBack(Append append) {
+		size_type rowCount = size();
+		try {
+			append();
+		} catch(...) {
+			forEachColumn([&](auto& column) {
+				while(column.size() > rowCount) {
+					column.pop_back();
+				}
+			});
+			throw;
+		}
+	}
+
+
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::size() const noexcept {
+		return std::get<0>(_columns).size();
+	}
+
+	template<typename... Fields>
+	bool ColumnTable<Fields...>::empty() const noexcept {
+		return std::get<0>(_columns).empty();
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::capacity() const noexcept {
+		return std::get<0>(_columns).capacity();
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::reserve(size_type capacity) {
+		forEachColumn([&](auto& column) {
+			column.reserve(capacity);
+		});
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::resize(size_type size) {
+		forEachColumn([&](auto& column) {
+			column.resize(size);
+		});
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::shrinkToFit() {
+		forEachColumn([&](auto& column) {
+			column.shrink_to_fit();
+		});
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::clear() noexcept {
+		forEachColumn([&](auto& column) {
+			column.clear();
+		});
+	}
+
+
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::iterator ColumnTable<Fields...>::begin() {
+		return iterator(this, 0);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::const_iterator ColumnTable<Fields...>::begin() const {
+		return const_iterator(this, 0);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::const_iterator ColumnTable<Fields...>::cbegin() const {
+		return const_iterator(this, 0);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::iterator ColumnTable<Fields...>::end() {
+		return iterator(this, size());
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::const_iterator ColumnTable<Fields...>::end() const {
+		return const_iterator(this, size());
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::const_iterator ColumnTable<Fields...>::cend() const {
+		return const_iterator(this, size());
+	}
+
+
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::Row ColumnTable<Fields...>::operator[](size_type index) noexcept {
+		return Row(this, index);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::ConstRow ColumnTable<Fields...>::operator[](size_type index) const noexcept {
+		return ConstRow(this, index);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::Row ColumnTable<Fields...>::at(size_type index) {
+		if(index >= size()) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in ColumnTable with a size of " + std::to_string(size()));
+		}
+		return Row(this, index);
+	}
+
+	template<typename... Fields>
+	typename ColumnTable<Fields...>::ConstRow ColumnTable<Fields...>::at(size_type index) const {
+		if(index >= size()) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in ColumnTable with a size of " + std::to_string(size()));
+		}
+		return ConstRow(this, index);
+	}
+
+	template<typename... Fields>
+	template<size_t Index>
+	std::span<typename ColumnTable<Fields...>::template FieldType<Index>> ColumnTable<Fields...>::column() noexcept {
+		auto& column = std::get<Index>(_columns);
+		return std::span<FieldType<Index>>(column.data(), column.size());
+	}
+
+	template<typename... Fields>
+	template<size_t Index>
+	std::span<const typename ColumnTable<Fields...>::template FieldType<Index>> ColumnTable<Fields...>::column() const noexcept {
+		auto& column = std::get<Index>(_columns);
+		return std::span<const FieldType<Index>>(column.data(), column.size());
+	}
+
+
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::pushBack(const TupleType& row) {
+		appendOrRollBack([&]() {
+			[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+				(std::get<Indexes>(_columns).push_back(std::get<Indexes>(row)), ...);
+			}(std::index_sequence_for<Fields...>());
+		});
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::pushBack(TupleType&& row) {
+		appendOrRollBack([&]() {
+			[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+				(std::get<Indexes>(_columns).push_back(std::move(std::get<Indexes>(row))), ...);
+			}(std::index_sequence_for<Fields...>());
+		});
+	}
+
+	template<typename... Fields>
+	template<typename... Args>
+	void ColumnTable<Fields...>::emplaceBack(Args&&... values) {
+		static_assert(sizeof...(Args) == sizeof...(Fields), "emplaceBack takes one value per field");
+		appendOrRollBack([&]() {
+			[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+				(std::get<Indexes>(_columns).emplace_back(std::forward<Args>(values)), ...);
+			}(std::index_sequence_for<Fields...>());
+		});
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::popBack() {
+		forEachColumn([&](auto& column) {
+			column.pop_back();
+		});
+	}
+
+
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::removeAt(size_type index) {
+		if(index >= size()) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in ColumnTable with a size of " + std::to_string(size()));
+		}
+		forEachColumn([&](auto& column) {
+			column.erase(column.begin() + index);
+		});
+	}
+
+	template<typename... Fields>
+	template<typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::removeWhere(Predicate predicate) {
+		std::vector<size_type> keptIndexes;
+		size_type rowCount = size();
+		keptIndexes.reserve(rowCount);
+		for(size_type i=0; i<rowCount; i++) {
+			if(!predicate(ConstRow(this, i))) {
+				keptIndexes.push_back(i);
+			}
+		}
+		size_type removedCount = rowCount - keptIndexes.size();
+		if(removedCount > 0) {
+			keepRows(keptIndexes);
+		}
+		return removedCount;
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::removeWhere(Predicate predicate) {
+		auto& column = std::get<Index>(_columns);
+		const FieldType<Index>* values = column.data();
+		size_type rowCount = column.size();
+		std::vector<size_type> keptIndexes;
+		keptIndexes.reserve(rowCount);
+		for(size_type i=0; i<rowCount; i++) {
+			if(!predicate(values[i])) {
+				keptIndexes.push_back(i);
+			}
+		}
+		size_type removedCount = rowCount - keptIndexes.size();
+		if(removedCount > 0) {
+			keepRows(keptIndexes);
+		}
+		return removedCount;
+	}
+
+
+
+	template<typename... Fields>
+	template<typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::countWhere(Predicate predicate) const {
+		size_type count = 0;
+		size_type rowCount = size();
+		for(size_type i=0; i<rowCount; i++) {
+			if(predicate(ConstRow(this, i))) {
+				count++;
+			}
+		}
+		return count;
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::countWhere(Predicate predicate) const {
+		auto& column = std::get<Index>(_columns);
+		const FieldType<Index>* values = column.data();
+		size_type rowCount = column.size();
+		// accumulate without branching so that the loop can be vectorized
+		size_type count = 0;
+		for(size_type i=0; i<rowCount; i++) {
+			count += (size_type)(bool)predicate(values[i]);
+		}
+		return count;
+	}
+
+	template<typename... Fields>
+	template<typename Predicate>
+	bool ColumnTable<Fields...>::containsWhere(Predicate predicate) const {
+		return indexWhere(predicate) != npos;
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename Predicate>
+	bool ColumnTable<Fields...>::containsWhere(Predicate predicate) const {
+		return indexWhere<Index>(predicate) != npos;
+	}
+
+	template<typename... Fields>
+	template<typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::indexWhere(Predicate predicate) const {
+		size_type rowCount = size();
+		for(size_type i=0; i<rowCount; i++) {
+			if(predicate(ConstRow(this, i))) {
+				return i;
+			}
+		}
+		return npos;
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename Predicate>
+	typename ColumnTable<Fields...>::size_type ColumnTable<Fields...>::indexWhere(Predicate predicate) const {
+		auto& column = std::get<Index>(_columns);
+		const FieldType<Index>* values = column.data();
+		size_type rowCount = column.size();
+		for(size_type i=0; i<rowCount; i++) {
+			if(predicate(values[i])) {
+				return i;
+			}
+		}
+		return npos;
+	}
+
+
+
+	template<typename... Fields>
+	template<typename Predicate>
+	ColumnTable<Fields...> ColumnTable<Fields...>::where(Predicate predicate) const {
+		std::vector<size_type> indexes;
+		size_type rowCount = size();
+		for(size_type i=0; i<rowCount; i++) {
+			if(predicate(ConstRow(this, i))) {
+				indexes.push_back(i);
+			}
+		}
+		return selectRows(indexes);
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename Predicate>
+	ColumnTable<Fields...> ColumnTable<Fields...>::where(Predicate predicate) const {
+		auto& column = std::get<Index>(_columns);
+		const FieldType<Index>* values = column.data();
+		size_type rowCount = column.size();
+		std::vector<size_type> indexes;
+		for(size_type i=0; i<rowCount; i++) {
+			if(predicate(values[i])) {
+				indexes.push_back(i);
+			}
+		}
+		return selectRows(indexes);
+	}
+
+
+
+	template<typename... Fields>
+	template<typename T, typename Transform>
+	T ColumnTable<Fields...>::reduce(T value, Transform transform) const {
+		size_type rowCount = size();
+		for(size_type i=0; i<rowCount; i++) {
+			value = transform(value, ConstRow(this, i));
+		}
+		return value;
+	}
+
+	template<typename... Fields>
+	template<size_t Index, typename T, typename Transform>
+	T ColumnTable<Fields...>::reduce(T value, Transform transform) const {
+		auto& column = std::get<Index>(_columns);
+		const FieldType<Index>* values = column.data();
+		size_type rowCount = column.size();
+		for(size_type i=0; i<rowCount; i++) {
+			value = transform(value, values[i]);
+		}
+		return value;
+	}
+
+
+
+	template<typename... Fields>
+	template<typename Struct>
+	ArrayList<Struct> ColumnTable<Fields...>::toArrayList() const {
+		ArrayList<Struct> list;
+		size_type rowCount = size();
+		list.reserve(rowCount);
+		for(size_type i=0; i<rowCount; i++) {
+			list.pushBack(rowToStruct<Struct>(std::index_sequence_for<Fields...>(), i));
+		}
+		return list;
+	}
+
+	template<typename... Fields>
+	template<typename Struct>
+	ArrayList<Struct> ColumnTable<Fields...>::toArrayList(Fields Struct::*... members) const {
+		ArrayList<Struct> list;
+		size_type rowCount = size();
+		list.reserve(rowCount);
+		for(size_type i=0; i<rowCount; i++) {
+			list.pushBack(rowToStruct<Struct>(std::index_sequence_for<Fields...>(), i, members...));
+		}
+		return list;
+	}
+
+	template<typename... Fields>
+	template<typename Struct, size_t... Indexes>
+	Struct ColumnTable<Fields...>::rowToStruct(std::index_sequence<Indexes...>, size_type index) const {
+		return Struct{ std::get<Indexes>(_columns)[index]... };
+	}
+
+	template<typename... Fields>
+	template<typename Struct, size_t... Indexes>
+	Struct ColumnTable<Fields...>::rowToStruct(std::index_sequence<Indexes...>, size_type index, Fields Struct::*... members) const {
+		Struct record;
+		((record.*members = std::get<Indexes>(_columns)[index]), ...);
+		return record;
+	}
+
+
+
+	template<typename... Fields>
+	bool ColumnTable<Fields...>::operator==(const ColumnTable& table) const {
+		return _columns == table._columns;
+	}
+
+	template<typename... Fields>
+	bool ColumnTable<Fields...>::operator!=(const ColumnTable& table) const {
+		return _columns != table._columns;
+	}
+
+
+
+	template<typename... Fields>
+	String ColumnTable<Fields...>::toString() const {
+		String str;
+		StringifyWriter writer(str);
+		toString(writer);
+		return str;
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::toString(StringifyWriter& writer) const {
+		writer.write("ColumnTable<");
+		size_t fieldIndex = 0;
+		((writer.write(fieldIndex++ == 0 ? "" : ", "), writer.write(stringify_type<Fields>())), ...);
+		if(size() == 0) {
+			writer.write(">[]");
+			return;
+		}
+		writer.writeItems(begin(), end(), ">[\n\t", ",\n\t", "\n]", [&](ConstRow row) {
+			writer.write("(");
+			[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+				((writer.write(Indexes == 0 ? "" : ", "), stringifyTo<Fields>(writer, row.template get<Indexes>())), ...);
+			}(std::index_sequence_for<Fields...>());
+			writer.write(")");
+		});
+	}
+
+
+
+	template<typename... Fields>
+	template<typename Function>
+	void ColumnTable<Fields...>::forEachColumn(Function function) {
+		std::apply([&](auto&... columns) {
+			(function(columns), ...);
+		}, _columns);
+	}
+
+	template<typename... Fields>
+	template<typename Function>
+	void ColumnTable<Fields...>::forEachColumn(Function function) const {
+		std::apply([&](auto&... columns) {
+			(function(columns), ...);
+		}, _columns);
+	}
+
+	template<typename... Fields>
+	void ColumnTable<Fields...>::keepRows(const std::vector<size_type>& indexes) {
+		// compact each column in place, one column at a time
+		forEachColumn([&](auto& column) {
+			size_type writeIndex = 0;
+			for(size_type readIndex : indexes) {
+				if(writeIndex != readIndex) {
+					column[writeIndex] = std::move(column[readIndex]);
+				}
+				writeIndex++;
+			}
+			column.erase(column.begin() + writeIndex, column.end());
+		});
+	}
+
+	template<typename... Fields>
+	ColumnTable<Fields...> ColumnTable<Fields...>::selectRows(const std::vector<size_type>& indexes) const {
+		ColumnTable<Fields...> table;
+		[&]<size_t... Indexes>(std::index_sequence<Indexes...>) {
+			([&](auto& destColumn, auto& srcColumn) {
+				destColumn.reserve(indexes.size());
+				for(size_type index : indexes) {
+					destColumn.push_back(srcColumn[index]);
+				}
+			}(std::get<Indexes>(table._columns), std::get<Indexes>(_columns)), ...);
+		}(std::index_sequence_for<Fields...>());
+		return table;
+	}
+}
+
+
+
+namespace std {
+	template<typename Table, bool Const>
+	struct tuple_size<fgl::ColumnTableRow<Table,Const>>: std::tuple_size<typename Table::TupleType> {};
+
+	template<size_t Index, typename Table, bool Const>
+	struct tuple_element<Index,fgl::ColumnTableRow<Table,Const>> {
+		using type = typename fgl::ColumnTableRow<Table,Const>::template ReferenceType<Index>;
+	};
+}
@@ -0,0 +1,483 @@
+//
+//  CompactVariant.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/Optional.hpp>
+#include <fgl/data/TypeId.hpp>
+#include <fgl/data/Variant.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fgl {
+	template<typename T>
+	struct _CompactVariantArray {
+		T values[1];
+	};
+
+	template<size_t Index, typename T>
+	struct _CompactVariantAlternative {
+		/// Only viable when `T x[] = { std::forward<U>(u) }` is well formed, so that narrowing conversions
+		/// (including pointer to bool) never pick an alternative, the same as std::variant
+		template<typename U>
+		requires requires { _CompactVariantArray<T>{{ std::declval<U>() }}; }
+		static std::integral_constant<size_t,Index> select(T);
+	};
+
+	template<typename IndexSequence, typename... Types>
+	struct _CompactVariantAlternatives;
+
+	template<size_t... Indexes, typename... Types>
+	struct _CompactVariantAlternatives<std::index_sequence<Indexes...>,Types...>: _CompactVariantAlternative<Indexes,Types>... {
+		using _CompactVariantAlternative<Indexes,Types>::select...;
+	};
+
+	/// A tagged union with the same interface as Variant, laid out to take as little space as possible.
+	/// The active index is stored in the smallest unsigned integer that can hold it, directly after the
+	/// storage for the largest alternative, so a variant of small alternatives is only a few bytes larger
+	/// than its largest member. This matters most for large arrays of variants.
+	/// If constructing a new alternative throws, the variant is left valueless.
+	template<typename... Types>
+	class CompactVariant {
+		static_assert(sizeof...(Types) > 0, "CompactVariant must have at least one alternative");
+		template<typename VariantType>
+		friend struct _VariantAccess;
+	public:
+		using IndexType = std::conditional_t<(sizeof...(Types) < std::numeric_limits<uint8_t>::max()), uint8_t,
+			std::conditional_t<(sizeof...(Types) < std::numeric_limits<uint16_t>::max()), uint16_t, uint32_t>>;
+		static constexpr size_t npos = (size_t)-1;
+
+		CompactVariant() noexcept(std::is_nothrow_default_constructible_v<std::tuple_element_t<0,std::tuple<Types...>>>);
+		CompactVariant(const CompactVariant&);
+		CompactVariant(CompactVariant&&) noexcept((std::is_nothrow_move_constructible_v<Types> && ...));
+		template<typename T,
+			typename = std::enable_if_t<!std::is_same_v<std::remove_cvref_t<T>,CompactVariant>>,
+			size_t Index = decltype(_CompactVariantAlternatives<std::index_sequence_for<Types...>,Types...>::template select<T>(std::declval<T>()))::value>
+		CompactVariant(T&& value);
+		template<size_t Index, typename... Args>
+		explicit CompactVariant(std::in_place_index_t<Index>, Args&&... args);
+		template<typename T, typename... Args>
+		explicit CompactVariant(std::in_place_type_t<T>, Args&&... args);
+		~CompactVariant();
+
+		CompactVariant& operator=(const CompactVariant&);
+		CompactVariant& operator=(CompactVariant&&) noexcept(((std::is_nothrow_move_constructible_v<Types> && std::is_nothrow_move_assignable_v<Types>) && ...));
+		template<typename T,
+			typename = std::enable_if_t<!std::is_same_v<std::remove_cvref_t<T>,CompactVariant>>,
+			size_t Index = decltype(_CompactVariantAlternatives<std::index_sequence_for<Types...>,Types...>::template select<T>(std::declval<T>()))::value>
+		CompactVariant& operator=(T&& value);
+
+		template<size_t Index, typename... Args>
+		auto& emplace(Args&&... args);
+		template<typename T, typename... Args>
+		T& emplace(Args&&... args);
+
+		inline size_t index() const noexcept;
+		inline bool valuelessByException() const noexcept;
+
+		template<typename Visitor>
+		inline decltype(auto) visit(Visitor&& visitor) &;
+		template<typename Visitor>
+		inline decltype(auto) visit(Visitor&& visitor) &&;
+		template<typename Visitor>
+		inline decltype(auto) visit(Visitor&& visitor) const&;
+
+		template<typename T>
+		inline bool is() const;
+
+		template<typename T>
+		inline T& get() &;
+		template<typename T>
+		inline T&& get() &&;
+		template<typename T>
+		inline const T& get() const&;
+
+		template<typename T>
+		inline T* getIf();
+		template<typename T>
+		inline const T* getIf() const;
+
+		template<typename T>
+		inline T& getOr(T&);
+		template<typename T>
+		inline const T& getOr(const T&) const;
+
+		template<typename T>
+		inline Optional<T> maybeGet() const;
+
+		template<typename T>
+		inline OptionalRef<T> maybeGetRef();
+		template<typename T>
+		inline OptionalRef<const T> maybeGetRef() const;
+
+		TypeId typeId() const;
+		String typeName() const;
+
+		bool operator==(const CompactVariant&) const;
+		bool operator!=(const CompactVariant&) const;
+
+	private:
+		static constexpr bool trivial = (std::is_trivially_copyable_v<Types> && ...);
+		static constexpr IndexType valueless = std::numeric_limits<IndexType>::max();
+
+		template<size_t Index>
+		using Alternative = std::tuple_element_t<Index,std::tuple<Types...>>;
+
+		template<size_t Index>
+		inline Alternative<Index>& unchecked() noexcept;
+		template<size_t Index>
+		inline const Alternative<Index>& unchecked() const noexcept;
+
+		void destroy() noexcept;
+		template<typename Other>
+		void constructFrom(Other&& variant);
+
+		alignas(Types...) unsigned char _storage[std::max({ sizeof(Types)... })];
+		IndexType _index;
+	};
+
+	template<typename... Types>
+	struct is_variant<CompactVariant<Types...>>: std::true_type {};
+
+	template<typename... Types>
+	struct _VariantAccess<CompactVariant<Types...>> {
+		static constexpr size_t size = sizeof...(Types);
+
+		template<size_t Index, typename VariantType>
+		static constexpr decltype(auto) get(VariantType&& variant) noexcept {
+			if constexpr(std::is_lvalue_reference_v<VariantType>) {
+				return variant.template unchecked<Index>();
+			} else {
+				return std::move(variant.template unchecked<Index>());
+			}
+		}
+	};
+
+
+
+	#pragma mark CompactVariant implementation
+
+	template<typename... Types>
+	CompactVariant<Types...>::CompactVariant() noexcept(std::is_nothrow_default_constructible_v<std::tuple_element_t<0,std::tuple<Types...>>>)
+	: _index(valueless) {
+		new(_storage) Alternative<0>();
+		_index = 0;
+	}
+
+	template<typename... Types>
+	CompactVariant<Types...>::CompactVariant(const CompactVariant& variant): _index(valueless) {
+		constructFrom(variant);
+	}
+
+	template<typename... Types>
+	CompactVariant<Types...>::CompactVariant(CompactVariant&& variant) noexcept((std::is_nothrow_move_constructible_v<Types> && ...))
+	: _index(valueless) {
+		constructFrom(std::move(variant));
+	}
+
+	template<typename... Types>
+	template<typename T, typename _, size_t Index>
+	CompactVariant<Types...>::CompactVariant(T&& value): _index(valueless) {
+		new(_storage) Alternative<Index>(std::forward<T>(value));
+		_index = (IndexType)Index;
+	}
+
+	template<typename... Types>
+	template<size_t Index, typename... Args>
+	CompactVariant<Types...>::CompactVariant(std::in_place_index_t<Index>, Args&&... args): _index(valueless) {
+		static_assert(Index < sizeof...(Types), "Index is out of range for the variant's types");
+		new(_storage) Alternative<Index>(std::forward<Args>(args)...);
+		_index = (IndexType)Index;
+	}
+
+	template<typename... Types>
+	template<typename T, typename... Args>
+	CompactVariant<Types...>::CompactVariant(std::in_place_type_t<T>, Args&&... args)
+	: CompactVariant(std::in_place_index<_variantIndexOf<T,Types...>()>, std::forward<Args>(args)...) {
+		//
+	}
+
+	template<typename... Types>
+	CompactVariant<Types...>::~CompactVariant() {
+		destroy();
+	}
+
+	template<typename... Types>
+	CompactVariant<Types...>& CompactVariant<Types...>::operator=(const CompactVariant& variant) {
+		if(this == &variant) {
+			return *this;
+		}
+		if(_index == variant._index && _index != valueless) {
+			visitVariants([&](auto& value) {
+				using T = std::remove_cvref_t<decltype(value)>;
+				*reinterpret_cast<T*>(_storage) = value;
+			}, variant);
+			return *this;
+		}
+		destroy();
+		constructFrom(variant);
+		return *this;
+	}
+
+	template<typename... Types>
+	CompactVariant<Types...>& CompactVariant<Types...>::operator=(CompactVariant&& variant) noexcept(((std::is_nothrow_move_constructible_v<Types> && std::is_nothrow_move_assignable_v<Types>) && ...)) {
+		if(this == &variant) {
+			return *this;
+		}
+		if(_index == variant._index && _index != valueless) {
+			visitVariants([&](auto&& value) {
+				using T = std::remove_cvref_t<decltype(value)>;
+				*reinterpret_cast<T*>(_storage) = std::move(value);
+			}, std::move(variant));
+			return *this;
+		}
+		destroy();
+		constructFrom(std::move(variant));
+		return *this;
+	}
+
+	template<typename... Types>
+	template<typename T, typename _, size_t Index>
+	CompactVariant<Types...>& CompactVariant<Types...>::operator=(T&& value) {
+		if(_index == Index) {
+			unchecked<Index>() = std::forward<T>(value);
+		} else {
+			emplace<Index>(std::forward<T>(value));
+		}
+		return *this;
+	}
+
+	template<typename... Types>
+	template<size_t Index, typename... Args>
+	auto& CompactVariant<Types...>::emplace(Args&&... args) {
+		static_assert(Index < sizeof...(Types), "Index is out of range for the variant's types");
+		destroy();
+		new(_storage) Alternative<Index>(std::forward<Args>(args)...);
+		_index = (IndexType)Index;
+		return unchecked<Index>();
+	}
+
+	template<typename... Types>
+	template<typename T, typename... Args>
+	T& CompactVariant<Types...>::emplace(Args&&... args) {
+		constexpr size_t index = _variantIndexOf<T,Types...>();
+		static_assert(index < sizeof...(Types), "T must occur exactly once in the variant's types");
+		return emplace<index>(std::forward<Args>(args)...);
+	}
+
+	template<typename... Types>
+	size_t CompactVariant<Types...>::index() const noexcept {
+		if(_index == valueless) {
+			return npos;
+		}
+		return _index;
+	}
+
+	template<typename... Types>
+	bool CompactVariant<Types...>::valuelessByException() const noexcept {
+		return _index == valueless;
+	}
+
+	template<typename... Types>
+	template<typename Visitor>
+	decltype(auto) CompactVariant<Types...>::visit(Visitor&& visitor) & {
+		return visitVariants(std::forward<Visitor>(visitor), *this);
+	}
+
+	template<typename... Types>
+	template<typename Visitor>
+	decltype(auto) CompactVariant<Types...>::visit(Visitor&& visitor) && {
+		return visitVariants(std::forward<Visitor>(visitor), std::move(*this));
+	}
+
+	template<typename... Types>
+	template<typename Visitor>
+	decltype(auto) CompactVariant<Types...>::visit(Visitor&& visitor) const& {
+		return visitVariants(std::forward<Visitor>(visitor), *this);
+	}
+
+	template<typename... Types>
+	template<typename T>
+	bool CompactVariant<Types...>::is() const {
+		constexpr size_t index = _variantIndexOf<T,Types...>();
+		static_assert(index < sizeof...(Types), "T must occur exactly once in the variant's types");
+		return _index == index;
+	}
+
+	template<typename... Types>
+	template<typename T>
+	T& CompactVariant<Types...>::get() & {
+		if(!is<T>()) {
+			throw std::bad_variant_access();
+		}
+		return unchecked<_variantIndexOf<T,Types...>()>();
+	}
+
+	template<typename... Types>
+	template<typename T>
+	T&& CompactVariant<Types...>::get() && {
+		if(!is<T>()) {
+			throw std::bad_variant_access();
+		}
+		return std::move(unchecked<_variantIndexOf<T,Types...>()>());
+	}
+
+	template<typename... Types>
+	template<typename T>
+	const T& CompactVariant<Types...>::get() const& {
+		if(!is<T>()) {
+			throw std::bad_variant_access();
+		}
+		return unchecked<_variantIndexOf<T,Types...>()>();
+	}
+
+	template<typename... Types>
+	template<typename T>
+	T* CompactVariant<Types...>::getIf() {
+		if(!is<T>()) {
+			return nullptr;
+		}
+		return &unchecked<_variantIndexOf<T,Types...>()>();
+	}
+
+	template<typename... Types>
+	template<typename T>
+	const T* CompactVariant<Types...>::getIf() const {
+		if(!is<T>()) {
+			return nullptr;
+		}
+		return &unchecked<_variantIndexOf<T,Types...>()>();
+	}
+
+	template<typename... Types>
+	template<typename T>
+	T& CompactVariant<Types...>::getOr(T& defaultVal) {
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
+		}
+		return defaultVal;
+	}
+
+	template<typename... Types>
+	template<typename T>
+	const T& CompactVariant<Types...>::getOr(const T& defaultVal) const {
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
+		}
+		return defaultVal;
+	}
+
+	template<typename... Types>
+	template<typename T>
+	Optional<T> CompactVariant<Types...>::maybeGet() const {
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
+		}
+		return std::nullopt;
+	}
+
+	template<typename... Types>
+	template<typename T>
+	OptionalRef<T> CompactVariant<Types...>::maybeGetRef() {
+		if(auto ptr = getIf<T>()) {
+			return std::ref(*ptr);
+		}
+		return std::nullopt;
+	}
+
+	template<typename... Types>
+	template<typename T>
+	OptionalRef<const T> CompactVariant<Types...>::maybeGetRef() const {
+		if(auto ptr = getIf<T>()) {
+			return std::ref(*ptr);
+		}
+		return std::nullopt;
+	}
+
+	template<typename... Types>
+	TypeId CompactVariant<Types...>::typeId() const {
+		static constexpr TypeId typeIds[] = { TypeId::of<Types>()... };
+		if(_index == valueless) {
+			return TypeId();
+		}
+		return typeIds[_index];
+	}
+
+	template<typename... Types>
+	String CompactVariant<Types...>::typeName() const {
+		return typeId().name();
+	}
+
+	template<typename... Types>
+	bool CompactVariant<Types...>::operator==(const CompactVariant& variant) const {
+		if(_index != variant._index) {
+			return false;
+		}
+		if(_index == valueless) {
+			return true;
+		}
+		return visitVariants([&](auto& value) -> bool {
+			using T = std::remove_cvref_t<decltype(value)>;
+			return value == *reinterpret_cast<const T*>(variant._storage);
+		}, *this);
+	}
+
+	template<typename... Types>
+	bool CompactVariant<Types...>::operator!=(const CompactVariant& variant) const {
+		return !operator==(variant);
+	}
+
+	template<typename... Types>
+	template<size_t Index>
+	typename CompactVariant<Types...>::template Alternative<Index>& CompactVariant<Types...>::unchecked() noexcept {
+		return *std::launder(reinterpret_cast<Alternative<Index>*>(_storage));
+	}
+
+	template<typename... Types>
+	template<size_t Index>
+	const typename CompactVariant<Types...>::template Alternative<Index>& CompactVariant<Types...>::unchecked() const noexcept {
+		return *std::launder(reinterpret_cast<const Alternative<Index>*>(_storage));
+	}
+
+	template<typename... Types>
+	void CompactVariant<Types...>::destroy() noexcept {
+		if constexpr(!(std::is_trivially_destructible_v<Types> && ...)) {
+			if(_index != valueless) {
+				visitVariants([](auto& value) {
+					using T = std::remove_cvref_t<decltype(value)>;
+					value.~T();
+				}, *this);
+			}
+		}
+		_index = valueless;
+	}
+
+	template<typename... Types>
+	template<typename Other>
+	void CompactVariant<Types...>::constructFrom(Other&& variant) {
+		if constexpr(trivial) {
+			std::memcpy(_storage, variant._storage, sizeof(_storage));
+			_index = variant._index;
+		} else {
+			if(variant._index == valueless) {
+				return;
+			}
+			visitVariants([&](auto&& value) {
+				using T = std::remove_cvref_t<decltype(value)>;
+				new(_storage) T(std::forward<decltype(value)>(value));
+			}, std::forward<Other>(variant));
+			_index = variant._index;
+		}
+	}
+}
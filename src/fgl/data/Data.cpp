@@ -10,11 +10,5 @@
 #include <fgl/data/String.hpp>
 
 namespace fgl {
-	Data::Data(const String& str): vector(str.begin(), str.end()) {
-		//
-	}
-
-	String Data::toString() const {
-		return String(begin(), end());
-	}
+	template class BasicData<>;
 }
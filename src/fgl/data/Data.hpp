@@ -17,24 +17,85 @@
 #endif
 
 namespace fgl {
-	class Data: public std::vector<uint8_t> {
+	class MappedData;
+
+	/// How a file's contents will be accessed, so the system can read ahead or avoid it
+	enum class FileAccess {
+		Normal,
+		Sequential,
+		Random
+	};
+
+	template<typename Allocator = std::allocator<uint8_t>>
+	class BasicData: public std::vector<uint8_t,Allocator> {
 	public:
 		using byte = uint8_t;
+		using BaseType = std::vector<uint8_t,Allocator>;
 		
-		using vector::vector;
-		using vector::begin;
-		using vector::end;
+		using BaseType::BaseType;
+		using BaseType::begin;
+		using BaseType::end;
 		
 		// TODO pass explicit string encoding
-		explicit Data(const String&);
-		#ifdef __OBJC__
-		Data(NSData* data);
-		#endif
+		template<typename StringAllocator>
+		explicit BasicData(const BasicString<char,StringAllocator>&, const Allocator& allocator = Allocator());
 		
 		// TODO specify explicit string encoding
 		String toString() const;
+	};
+
+	extern template class BasicData<>;
+
+
+	class Data: public BasicData<> {
+	public:
+		using BasicData::BasicData;
+		
+		/// Maps a file into memory as read-only. Pages are loaded when they're first accessed.
+		/// Files that can't be mapped, such as pipes, are read into memory instead.
+		static MappedData mapFile(const String& path, FileAccess access = FileAccess::Normal);
+		/// Reads a whole file with a single allocation, sized from the file's metadata when possible
+		static Data readFile(const String& path);
+		
+		/// Encodes the bytes as padded base64
+		String toBase64() const;
+		/// Encodes the bytes as unpadded base64 with the URL and filename safe alphabet
+		String toBase64URL() const;
+		/// Encodes the bytes as lowercase hex
+		String toHex() const;
+		/// Decodes padded base64. Throws std::invalid_argument if the string isn't valid base64.
+		static Data fromBase64(std::string_view str);
+		/// Decodes base64 with the URL and filename safe alphabet, with or without padding
+		static Data fromBase64URL(std::string_view str);
+		/// Decodes uppercase or lowercase hex. Throws std::invalid_argument if the string isn't valid hex.
+		static Data fromHex(std::string_view str);
+		
 		#ifdef __OBJC__
+		Data(NSData* data);
+		
 		NSData* toNSData() const;
 		#endif
 	};
+
+
+
+	namespace pmr {
+		using Data = BasicData<PolymorphicAllocator<uint8_t>>;
+	}
+
+
+
+	#pragma mark BasicData implementation
+
+	template<typename Allocator>
+	template<typename StringAllocator>
+	BasicData<Allocator>::BasicData(const BasicString<char,StringAllocator>& str, const Allocator& allocator)
+	: BaseType(str.begin(), str.end(), allocator) {
+		//
+	}
+
+	template<typename Allocator>
+	String BasicData<Allocator>::toString() const {
+		return String(begin(), end());
+	}
 }
@@ -10,7 +10,7 @@
 
 #ifdef __OBJC__
 namespace fgl {
-	Data::Data(NSData* data): vector((uint8_t*)data.bytes, ((uint8_t*)data.bytes) + data.length) {
+	Data::Data(NSData* data): BasicData((uint8_t*)data.bytes, ((uint8_t*)data.bytes) + data.length) {
 		//
 	}
 	
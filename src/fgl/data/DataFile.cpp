@@ -0,0 +1,355 @@
+//
+//  DataFile.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/DataFile.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <limits>
+#include <system_error>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+	#include <io.h>
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+namespace fgl {
+	namespace {
+		// read into a stack buffer first, so that a file that didn't grow isn't copied into a larger buffer
+		constexpr size_t FILE_READ_CHUNK_SIZE = 16 * 1024;
+
+		[[noreturn]] void _throwFileError(const char* action, const String& path) {
+			throw std::system_error(errno, std::generic_category(), std::string(action) + " " + path);
+		}
+
+		int _openFile(const String& path) {
+			#ifdef _WIN32
+			int fd = ::_open(path.c_str(), _O_RDONLY | _O_BINARY);
+			#else
+			int fd;
+			do {
+				fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			} while(fd == -1 && errno == EINTR);
+			#endif
+			if(fd == -1) {
+				_throwFileError("Failed to open", path);
+			}
+			return fd;
+		}
+
+		void _closeFile(int fd) noexcept {
+			#ifdef _WIN32
+			::_close(fd);
+			#else
+			::close(fd);
+			#endif
+		}
+
+		/// The size of a regular file, or 0 for pipes, devices, and anything else with no known size
+		uint64_t _getFileSize(int fd, const String& path) {
+			#ifdef _WIN32
+			struct _stat64 info;
+			if(::_fstat64(fd, &info) != 0) {
+				_throwFileError("Failed to stat", path);
+			}
+			return ((info.st_mode & _S_IFMT) == _S_IFREG) ? (uint64_t)info.st_size : 0;
+			#else
+			struct stat info;
+			if(::fstat(fd, &info) != 0) {
+				_throwFileError("Failed to stat", path);
+			}
+			return S_ISREG(info.st_mode) ? (uint64_t)info.st_size : 0;
+			#endif
+		}
+
+		/// Reads until size bytes have been read or the end of the file is reached
+		size_t _readFully(int fd, uint8_t* buffer, size_t size, const String& path) {
+			size_t total = 0;
+			while(total < size) {
+				size_t count = size - total;
+				#ifdef _WIN32
+				auto result = ::_read(fd, buffer + total, (unsigned int)std::min(count, (size_t)std::numeric_limits<int>::max()));
+				#else
+				// some systems reject reads larger than INT_MAX
+				auto result = ::read(fd, buffer + total, std::min(count, (size_t)std::numeric_limits<int>::max()));
+				if(result == -1 && errno == EINTR) {
+					continue;
+				}
+				#endif
+				if(result < 0) {
+					_throwFileError("Failed to read", path);
+				} else if(result == 0) {
+					break;
+				}
+				total += (size_t)result;
+			}
+			return total;
+		}
+
+		struct _FileCloser {
+			int fd;
+			~_FileCloser() {
+				_closeFile(fd);
+			}
+		};
+
+		Data _readWholeFile(int fd, const String& path) {
+			uint64_t fileSize = _getFileSize(fd, path);
+			if(fileSize > (uint64_t)std::numeric_limits<size_t>::max()) {
+				throw std::length_error("File " + path + " is too large to read into memory");
+			}
+			Data data;
+			if(fileSize > 0) {
+				// size the buffer from the file's metadata and read it in one pass
+				data.resize((size_t)fileSize);
+				size_t size = _readFully(fd, data.data(), data.size(), path);
+				if(size < data.size()) {
+					// the file was truncated while reading
+					data.resize(size);
+					return data;
+				}
+			}
+			// keep reading in case the file has grown or has no known size
+			bool grew = false;
+			uint8_t chunk[FILE_READ_CHUNK_SIZE];
+			while(true) {
+				size_t count = _readFully(fd, chunk, sizeof(chunk), path);
+				if(count == 0) {
+					break;
+				}
+				data.insert(data.end(), chunk, chunk + count);
+				grew = true;
+				if(count < sizeof(chunk)) {
+					break;
+				}
+			}
+			if(grew) {
+				data.shrink_to_fit();
+			}
+			return data;
+		}
+
+		#ifndef _WIN32
+		int _adviceFor(FileAccess access) {
+			switch(access) {
+				case FileAccess::Normal:
+					return MADV_NORMAL;
+				case FileAccess::Sequential:
+					return MADV_SEQUENTIAL;
+				case FileAccess::Random:
+					return MADV_RANDOM;
+			}
+			return MADV_NORMAL;
+		}
+		#endif
+	}
+
+
+
+	#pragma mark Data implementation
+
+	MappedData Data::mapFile(const String& path, FileAccess access) {
+		int fd = _openFile(path);
+		_FileCloser closer{ fd };
+		MappedData mapped;
+		#ifndef _WIN32
+		uint64_t fileSize = _getFileSize(fd, path);
+		if(fileSize > (uint64_t)std::numeric_limits<size_t>::max()) {
+			throw std::length_error("File " + path + " is too large to map into memory");
+		}
+		if(fileSize > 0) {
+			void* address = ::mmap(nullptr, (size_t)fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(address != MAP_FAILED) {
+				// the mapping stays valid after the file is closed
+				mapped._address = address;
+				mapped._mappedSize = (size_t)fileSize;
+				mapped._data = (const uint8_t*)address;
+				mapped._size = (size_t)fileSize;
+				if(access != FileAccess::Normal) {
+					mapped.advise(access);
+				}
+				return mapped;
+			}
+		}
+		#endif
+		// empty files and files that can't be mapped are read into memory instead
+		mapped._buffer = _readWholeFile(fd, path);
+		mapped._data = mapped._buffer.data();
+		mapped._size = mapped._buffer.size();
+		return mapped;
+	}
+
+	Data Data::readFile(const String& path) {
+		int fd = _openFile(path);
+		_FileCloser closer{ fd };
+		return _readWholeFile(fd, path);
+	}
+
+
+
+	#pragma mark MappedData implementation
+
+	MappedData::MappedData() noexcept
+	: _address(nullptr), _mappedSize(0), _data(nullptr), _size(0) {
+		//
+	}
+
+	MappedData::MappedData(MappedData&& mapped) noexcept
+	: _address(mapped._address), _mappedSize(mapped._mappedSize), _data(mapped._data), _size(mapped._size), _buffer(std::move(mapped._buffer)) {
+		mapped._address = nullptr;
+		mapped._mappedSize = 0;
+		mapped._data = nullptr;
+		mapped._size = 0;
+	}
+
+	MappedData::~MappedData() {
+		unmap();
+	}
+
+	MappedData& MappedData::operator=(MappedData&& mapped) noexcept {
+		if(this == &mapped) {
+			return *this;
+		}
+		unmap();
+		_address = mapped._address;
+		_mappedSize = mapped._mappedSize;
+		_data = mapped._data;
+		_size = mapped._size;
+		_buffer = std::move(mapped._buffer);
+		mapped._address = nullptr;
+		mapped._mappedSize = 0;
+		mapped._data = nullptr;
+		mapped._size = 0;
+		return *this;
+	}
+
+	void MappedData::advise(FileAccess access, size_type startIndex, size_type count) const {
+		#ifndef _WIN32
+		if(_address == nullptr || startIndex >= _mappedSize) {
+			return;
+		}
+		count = std::min(count, _mappedSize - startIndex);
+		// madvise needs a page aligned address
+		size_t pageSize = (size_t)::sysconf(_SC_PAGESIZE);
+		size_t alignedStart = startIndex - (startIndex % pageSize);
+		::madvise((uint8_t*)_address + alignedStart, count + (startIndex - alignedStart), _adviceFor(access));
+		#endif
+	}
+
+	void MappedData::unmap() noexcept {
+		#ifndef _WIN32
+		if(_address != nullptr) {
+			::munmap(_address, _mappedSize);
+		}
+		#endif
+		_address = nullptr;
+		_mappedSize = 0;
+		_buffer.clear();
+		_buffer.shrink_to_fit();
+	}
+
+
+
+	#pragma mark DataReader implementation
+
+	DataReader::DataReader(const String& path, size_t chunkSize)
+	: _path(path), _fd(-1), _chunkSize(chunkSize), _offset(0), _fileSize(0), _atEnd(false) {
+		if(chunkSize == 0) {
+			throw std::invalid_argument("DataReader chunkSize cannot be 0");
+		}
+		_fd = _openFile(path);
+		try {
+			_fileSize = _getFileSize(_fd, path);
+		} catch(...) {
+			close();
+			throw;
+		}
+		#if defined(__APPLE__)
+		::fcntl(_fd, F_RDAHEAD, 1);
+		#elif defined(POSIX_FADV_SEQUENTIAL)
+		::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+		#endif
+	}
+
+	DataReader::DataReader(DataReader&& reader) noexcept
+	: _path(std::move(reader._path)), _fd(reader._fd), _chunkSize(reader._chunkSize), _buffer(std::move(reader._buffer)), _offset(reader._offset), _fileSize(reader._fileSize), _atEnd(reader._atEnd) {
+		reader._fd = -1;
+		reader._atEnd = true;
+	}
+
+	DataReader::~DataReader() {
+		close();
+	}
+
+	DataReader& DataReader::operator=(DataReader&& reader) noexcept {
+		if(this == &reader) {
+			return *this;
+		}
+		close();
+		_path = std::move(reader._path);
+		_fd = reader._fd;
+		_chunkSize = reader._chunkSize;
+		_buffer = std::move(reader._buffer);
+		_offset = reader._offset;
+		_fileSize = reader._fileSize;
+		_atEnd = reader._atEnd;
+		reader._fd = -1;
+		reader._atEnd = true;
+		return *this;
+	}
+
+	DataView DataReader::readChunk() {
+		if(_buffer.empty()) {
+			// don't allocate a full chunk for a file smaller than one
+			size_t bufferSize = _chunkSize;
+			if(_fileSize > 0 && _fileSize < bufferSize) {
+				bufferSize = (size_t)_fileSize;
+			}
+			_buffer.resize(bufferSize);
+		}
+		size_t count = read(_buffer.data(), _buffer.size());
+		return DataView(_buffer.data(), count);
+	}
+
+	size_t DataReader::read(void* buffer, size_t size) {
+		if(_fd == -1 || _atEnd || size == 0) {
+			return 0;
+		}
+		size_t count = _readFully(_fd, (uint8_t*)buffer, size, _path);
+		_offset += count;
+		if(count < size) {
+			_atEnd = true;
+		}
+		return count;
+	}
+
+	void DataReader::seek(uint64_t offset) {
+		if(_fd == -1) {
+			throw std::logic_error("Cannot seek a closed DataReader");
+		}
+		#ifdef _WIN32
+		auto result = ::_lseeki64(_fd, (__int64)offset, SEEK_SET);
+		#else
+		auto result = ::lseek(_fd, (off_t)offset, SEEK_SET);
+		#endif
+		if(result == -1) {
+			throw std::system_error(errno, std::generic_category(), "Failed to seek " + _path);
+		}
+		_offset = offset;
+		_atEnd = false;
+	}
+
+	void DataReader::close() noexcept {
+		if(_fd != -1) {
+			_closeFile(_fd);
+			_fd = -1;
+		}
+	}
+}
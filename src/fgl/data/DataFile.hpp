@@ -0,0 +1,160 @@
+//
+//  DataFile.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/Data.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/String.hpp>
+#include <span>
+
+namespace fgl {
+	/// A read-only file mapped into memory by Data::mapFile. The file is unmapped when this is destroyed.
+	class MappedData {
+		friend class Data;
+	public:
+		using value_type = uint8_t;
+		using size_type = size_t;
+		using const_iterator = const uint8_t*;
+		using iterator = const_iterator;
+
+		MappedData() noexcept;
+		MappedData(MappedData&&) noexcept;
+		MappedData(const MappedData&) = delete;
+		~MappedData();
+
+		MappedData& operator=(MappedData&&) noexcept;
+		MappedData& operator=(const MappedData&) = delete;
+
+		inline const uint8_t* data() const noexcept;
+		inline size_type size() const noexcept;
+		inline bool empty() const noexcept;
+		inline const_iterator begin() const noexcept;
+		inline const_iterator end() const noexcept;
+		inline const uint8_t& operator[](size_type index) const noexcept;
+
+		inline DataView view() const noexcept;
+		inline operator DataView() const noexcept;
+		inline operator std::span<const uint8_t>() const noexcept;
+
+		/// Whether the contents are mapped from the file, rather than read into memory
+		inline bool isMapped() const noexcept;
+		/// Tells the system how a range of the file will be accessed
+		void advise(FileAccess access, size_type startIndex = 0, size_type count = DataView::npos) const;
+
+	private:
+		void unmap() noexcept;
+
+		void* _address;
+		size_type _mappedSize;
+		const uint8_t* _data;
+		size_type _size;
+		/// Holds the contents of files that couldn't be mapped
+		Data _buffer;
+	};
+
+
+	/// Reads a file in fixed size chunks, for files that are too large to load at once
+	class DataReader {
+	public:
+		static constexpr size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+		explicit DataReader(const String& path, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+		DataReader(DataReader&&) noexcept;
+		DataReader(const DataReader&) = delete;
+		~DataReader();
+
+		DataReader& operator=(DataReader&&) noexcept;
+		DataReader& operator=(const DataReader&) = delete;
+
+		/// Reads the next chunk of the file, or returns an empty view at the end of the file.
+		/// The view is only valid until the next read or seek.
+		DataView readChunk();
+		/// Reads up to size bytes into the given buffer, and returns the number of bytes read, which is 0 at the end of the file
+		size_t read(void* buffer, size_t size);
+		void seek(uint64_t offset);
+
+		/// The offset in the file where the next read starts
+		inline uint64_t offset() const noexcept;
+		/// The size of the file when it was opened, or 0 if it isn't a regular file
+		inline uint64_t fileSize() const noexcept;
+		inline bool atEnd() const noexcept;
+
+	private:
+		void close() noexcept;
+
+		String _path;
+		int _fd;
+		size_t _chunkSize;
+		Data _buffer;
+		uint64_t _offset;
+		uint64_t _fileSize;
+		bool _atEnd;
+	};
+
+
+
+#pragma mark MappedData implementation
+
+	const uint8_t* MappedData::data() const noexcept {
+		return _data;
+	}
+
+	MappedData::size_type MappedData::size() const noexcept {
+		return _size;
+	}
+
+	bool MappedData::empty() const noexcept {
+		return _size == 0;
+	}
+
+	MappedData::const_iterator MappedData::begin() const noexcept {
+		return _data;
+	}
+
+	MappedData::const_iterator MappedData::end() const noexcept {
+		return _data + _size;
+	}
+
+	const uint8_t& MappedData::operator[](size_type index) const noexcept {
+		return _data[index];
+	}
+
+	DataView MappedData::view() const noexcept {
+		return DataView(_data, _size);
+	}
+
+	MappedData::operator DataView() const noexcept {
+		return DataView(_data, _size);
+	}
+
+	MappedData::operator std::span<const uint8_t>() const noexcept {
+		return std::span<const uint8_t>(_data, _size);
+	}
+
+	bool MappedData::isMapped() const noexcept {
+		return _address != nullptr;
+	}
+
+
+
+#pragma mark DataReader implementation
+
+	uint64_t DataReader::offset() const noexcept {
+		return _offset;
+	}
+
+	uint64_t DataReader::fileSize() const noexcept {
+		return _fileSize;
+	}
+
+	bool DataReader::atEnd() const noexcept {
+		return _atEnd;
+	}
+}
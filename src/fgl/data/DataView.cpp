@@ -0,0 +1,46 @@
+//
+//  DataView.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/DataView.hpp>
+
+namespace fgl {
+	#pragma mark DataView implementation
+
+	ArrayList<DataView> DataView::split(uint8_t delimiter) const {
+		ArrayList<DataView> parts;
+		size_type startIndex = 0;
+		while(true) {
+			size_type index = indexOf(delimiter, startIndex);
+			if(index == npos) {
+				parts.pushBack(DataView(_data + startIndex, _size - startIndex));
+				break;
+			}
+			parts.pushBack(DataView(_data + startIndex, index - startIndex));
+			startIndex = index + 1;
+		}
+		return parts;
+	}
+
+	ArrayList<DataView> DataView::split(DataView delimiter) const {
+		if(delimiter.empty()) {
+			throw std::invalid_argument("Cannot split DataView with an empty delimiter");
+		}
+		ArrayList<DataView> parts;
+		size_type startIndex = 0;
+		while(true) {
+			size_type index = indexOf(delimiter, startIndex);
+			if(index == npos) {
+				parts.pushBack(DataView(_data + startIndex, _size - startIndex));
+				break;
+			}
+			parts.pushBack(DataView(_data + startIndex, index - startIndex));
+			startIndex = index + delimiter.size();
+		}
+		return parts;
+	}
+}
@@ -0,0 +1,217 @@
+//
+//  DataView.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/Data.hpp>
+#include <fgl/data/String.hpp>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace fgl {
+	/// A non-owning view of a range of bytes, such as part of a Data buffer.
+	/// Slicing and splitting return more views of the same bytes, so the underlying buffer must outlive them.
+	class DataView {
+	public:
+		using value_type = uint8_t;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using const_pointer = const uint8_t*;
+		using const_reference = const uint8_t&;
+		using const_iterator = const uint8_t*;
+		using iterator = const_iterator;
+
+		static constexpr size_type npos = (size_type)-1;
+
+		constexpr DataView() noexcept;
+		constexpr DataView(const uint8_t* data, size_type size) noexcept;
+		inline DataView(const void* data, size_type size) noexcept;
+		constexpr DataView(std::span<const uint8_t> bytes) noexcept;
+		template<typename Allocator>
+		inline DataView(const BasicData<Allocator>& data) noexcept;
+		/// Views the bytes of a string
+		inline explicit DataView(std::string_view str) noexcept;
+
+		constexpr const uint8_t* data() const noexcept;
+		constexpr size_type size() const noexcept;
+		constexpr bool empty() const noexcept;
+		constexpr const_iterator begin() const noexcept;
+		constexpr const_iterator end() const noexcept;
+		constexpr const uint8_t& operator[](size_type index) const noexcept;
+		inline const uint8_t& at(size_type index) const;
+
+		/// A view of count bytes starting at startIndex, or of every byte after startIndex if count extends past the end
+		inline DataView slice(size_type startIndex, size_type count = npos) const;
+
+		inline size_type indexOf(uint8_t byte, size_type startIndex = 0) const noexcept;
+		inline size_type indexOf(DataView bytes, size_type startIndex = 0) const noexcept;
+		inline size_type lastIndexOf(uint8_t byte, size_type startIndex = npos) const noexcept;
+		inline size_type lastIndexOf(DataView bytes, size_type startIndex = npos) const noexcept;
+		inline bool contains(uint8_t byte) const noexcept;
+		inline bool contains(DataView bytes) const noexcept;
+		inline bool startsWith(DataView bytes) const noexcept;
+		inline bool endsWith(DataView bytes) const noexcept;
+
+		/// Splits the bytes around each occurrence of the delimiter. The results are views of the same bytes.
+		ArrayList<DataView> split(uint8_t delimiter) const;
+		ArrayList<DataView> split(DataView delimiter) const;
+
+		inline bool equals(DataView bytes) const noexcept;
+
+		/// The bytes as characters, without copying
+		inline std::string_view stringView() const noexcept;
+		inline String toString() const;
+		inline Data toData() const;
+
+		constexpr operator std::span<const uint8_t>() const noexcept;
+
+	private:
+		const uint8_t* _data;
+		size_type _size;
+	};
+
+	inline bool operator==(const DataView&, const DataView&) noexcept;
+	inline bool operator!=(const DataView&, const DataView&) noexcept;
+
+
+
+#pragma mark DataView implementation
+
+	constexpr DataView::DataView() noexcept
+	: _data(nullptr), _size(0) {
+		//
+	}
+
+	constexpr DataView::DataView(const uint8_t* data, size_type size) noexcept
+	: _data(data), _size(size) {
+		//
+	}
+
+	DataView::DataView(const void* data, size_type size) noexcept
+	: _data((const uint8_t*)data), _size(size) {
+		//
+	}
+
+	constexpr DataView::DataView(std::span<const uint8_t> bytes) noexcept
+	: _data(bytes.data()), _size(bytes.size()) {
+		//
+	}
+
+	template<typename Allocator>
+	DataView::DataView(const BasicData<Allocator>& data) noexcept
+	: _data(data.data()), _size(data.size()) {
+		//
+	}
+
+	DataView::DataView(std::string_view str) noexcept
+	: _data((const uint8_t*)str.data()), _size(str.size()) {
+		//
+	}
+
+	constexpr const uint8_t* DataView::data() const noexcept {
+		return _data;
+	}
+
+	constexpr DataView::size_type DataView::size() const noexcept {
+		return _size;
+	}
+
+	constexpr bool DataView::empty() const noexcept {
+		return _size == 0;
+	}
+
+	constexpr DataView::const_iterator DataView::begin() const noexcept {
+		return _data;
+	}
+
+	constexpr DataView::const_iterator DataView::end() const noexcept {
+		return _data + _size;
+	}
+
+	constexpr const uint8_t& DataView::operator[](size_type index) const noexcept {
+		return _data[index];
+	}
+
+	const uint8_t& DataView::at(size_type index) const {
+		if(index >= _size) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in DataView with size " + std::to_string(_size));
+		}
+		return _data[index];
+	}
+
+	DataView DataView::slice(size_type startIndex, size_type count) const {
+		if(startIndex > _size) {
+			throw std::out_of_range("startIndex " + std::to_string(startIndex) + " is out of bounds in DataView with size " + std::to_string(_size));
+		}
+		return DataView(_data + startIndex, std::min(count, _size - startIndex));
+	}
+
+	DataView::size_type DataView::indexOf(uint8_t byte, size_type startIndex) const noexcept {
+		return stringView().find((char)byte, startIndex);
+	}
+
+	DataView::size_type DataView::indexOf(DataView bytes, size_type startIndex) const noexcept {
+		return stringView().find(bytes.stringView(), startIndex);
+	}
+
+	DataView::size_type DataView::lastIndexOf(uint8_t byte, size_type startIndex) const noexcept {
+		return stringView().rfind((char)byte, startIndex);
+	}
+
+	DataView::size_type DataView::lastIndexOf(DataView bytes, size_type startIndex) const noexcept {
+		return stringView().rfind(bytes.stringView(), startIndex);
+	}
+
+	bool DataView::contains(uint8_t byte) const noexcept {
+		return indexOf(byte) != npos;
+	}
+
+	bool DataView::contains(DataView bytes) const noexcept {
+		return indexOf(bytes) != npos;
+	}
+
+	bool DataView::startsWith(DataView bytes) const noexcept {
+		return bytes._size <= _size && (bytes._size == 0 || std::memcmp(_data, bytes._data, bytes._size) == 0);
+	}
+
+	bool DataView::endsWith(DataView bytes) const noexcept {
+		return bytes._size <= _size && (bytes._size == 0 || std::memcmp(_data + (_size - bytes._size), bytes._data, bytes._size) == 0);
+	}
+
+	bool DataView::equals(DataView bytes) const noexcept {
+		return _size == bytes._size && (_size == 0 || _data == bytes._data || std::memcmp(_data, bytes._data, _size) == 0);
+	}
+
+	std::string_view DataView::stringView() const noexcept {
+		return std::string_view((const char*)_data, _size);
+	}
+
+	String DataView::toString() const {
+		return String((const char*)_data, _size);
+	}
+
+	Data DataView::toData() const {
+		return Data(_data, _data + _size);
+	}
+
+	constexpr DataView::operator std::span<const uint8_t>() const noexcept {
+		return std::span<const uint8_t>(_data, _size);
+	}
+
+	bool operator==(const DataView& left, const DataView& right) noexcept {
+		return left.equals(right);
+	}
+
+	bool operator!=(const DataView& left, const DataView& right) noexcept {
+		return !left.equals(right);
+	}
+}
@@ -0,0 +1,1542 @@
+//
+//  JSON.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/JSON.hpp>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if !defined(FGL_JSON_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	#define FGL_JSON_SIMD_SSE2
+#elif !defined(FGL_JSON_DISABLE_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+	#include <arm_neon.h>
+	#define FGL_JSON_SIMD_NEON
+#endif
+
+#if defined(__APPLE__)
+	#include <xlocale.h>
+#endif
+
+namespace fgl {
+	/// The structural index of a document.
+	/// positions holds the offset of every bracket, colon, comma, string start, and other value start, in document order.
+	/// ends holds the index of the matching closing bracket for each opening bracket.
+	struct _JSONTape {
+		String json;
+		std::vector<uint32_t> positions;
+		std::vector<uint32_t> ends;
+
+		inline char charAt(uint32_t index) const {
+			return json[positions[index]];
+		}
+
+		/// The index of the token after the value at the given index
+		inline uint32_t after(uint32_t index) const {
+			char c = charAt(index);
+			if(c == '{' || c == '[') {
+				return ends[index] + 1;
+			}
+			return index + 1;
+		}
+	};
+
+
+
+	namespace {
+		constexpr size_t JSON_MAX_DEPTH = 1024;
+		constexpr uint64_t SWAR_ONES = 0x0101010101010101ULL;
+		constexpr uint64_t SWAR_HIGH_BITS = 0x8080808080808080ULL;
+
+		[[noreturn]] void throwParseError(const std::string& message, size_t offset) {
+			throw JSONParseError(message + " at offset " + std::to_string(offset), offset);
+		}
+
+		inline bool isJSONWhitespace(char c) {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+		}
+
+		inline bool isJSONDelimiter(char c) {
+			return isJSONWhitespace(c) || c == ',' || c == ']' || c == '}' || c == ':';
+		}
+
+		inline bool isDigit(char c) {
+			return c >= '0' && c <= '9';
+		}
+
+
+
+		#pragma mark Escape scanning
+
+		/// Finds the first quote, backslash, or control character, 8 bytes at a time.
+		/// This is shared by the string parser and the string writer.
+		const char* findSpecialCharacter(const char* p, const char* end) {
+			while((end - p) >= 8) {
+				uint64_t word;
+				std::memcpy(&word, p, 8);
+				uint64_t quotes = word ^ (SWAR_ONES * '"');
+				uint64_t backslashes = word ^ (SWAR_ONES * '\\');
+				uint64_t found = ((quotes - SWAR_ONES) & ~quotes)
+					| ((backslashes - SWAR_ONES) & ~backslashes)
+					| ((word - (SWAR_ONES * 0x20)) & ~word);
+				if((found & SWAR_HIGH_BITS) != 0) {
+					break;
+				}
+				p += 8;
+			}
+			for(; p != end; p++) {
+				unsigned char c = (unsigned char)*p;
+				if(c == '"' || c == '\\' || c < 0x20) {
+					return p;
+				}
+			}
+			return end;
+		}
+
+
+
+		#pragma mark Structural scanning
+
+		struct BlockMasks {
+			uint64_t quote;
+			uint64_t backslash;
+			uint64_t whitespace;
+			uint64_t op;
+		};
+
+		#if defined(FGL_JSON_SIMD_SSE2)
+
+		inline BlockMasks classifyBlock(const uint8_t* block) {
+			const __m128i quote = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			const __m128i space = _mm_set1_epi8(' ');
+			const __m128i tab = _mm_set1_epi8('\t');
+			const __m128i newline = _mm_set1_epi8('\n');
+			const __m128i carriageReturn = _mm_set1_epi8('\r');
+			const __m128i colon = _mm_set1_epi8(':');
+			const __m128i comma = _mm_set1_epi8(',');
+			// { and [ differ only by 0x20, as do } and ]
+			const __m128i caseBit = _mm_set1_epi8(0x20);
+			const __m128i openBracket = _mm_set1_epi8('{');
+			const __m128i closeBracket = _mm_set1_epi8('}');
+			BlockMasks masks = { 0, 0, 0, 0 };
+			for(size_t i=0; i<4; i++) {
+				__m128i chunk = _mm_loadu_si128((const __m128i*)(block + (i * 16)));
+				__m128i brackets = _mm_or_si128(chunk, caseBit);
+				__m128i whitespace = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriageReturn)));
+				__m128i op = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(brackets, openBracket), _mm_cmpeq_epi8(brackets, closeBracket)),
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, colon), _mm_cmpeq_epi8(chunk, comma)));
+				size_t shift = i * 16;
+				masks.quote |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)) << shift;
+				masks.backslash |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash)) << shift;
+				masks.whitespace |= (uint64_t)(uint32_t)_mm_movemask_epi8(whitespace) << shift;
+				masks.op |= (uint64_t)(uint32_t)_mm_movemask_epi8(op) << shift;
+			}
+			return masks;
+		}
+
+		#elif defined(FGL_JSON_SIMD_NEON)
+
+		/// Packs the high bit of each byte of 4 comparison results into a 64-bit mask
+		inline uint64_t neonBitmask(uint8x16_t v0, uint8x16_t v1, uint8x16_t v2, uint8x16_t v3) {
+			const uint8x16_t bitMask = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+			uint8x16_t sum0 = vpaddq_u8(vandq_u8(v0, bitMask), vandq_u8(v1, bitMask));
+			uint8x16_t sum1 = vpaddq_u8(vandq_u8(v2, bitMask), vandq_u8(v3, bitMask));
+			sum0 = vpaddq_u8(sum0, sum1);
+			sum0 = vpaddq_u8(sum0, sum0);
+			return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+		}
+
+		inline BlockMasks classifyBlock(const uint8_t* block) {
+			uint8x16_t chunks[4] = { vld1q_u8(block), vld1q_u8(block + 16), vld1q_u8(block + 32), vld1q_u8(block + 48) };
+			uint8x16_t quote[4];
+			uint8x16_t backslash[4];
+			uint8x16_t whitespace[4];
+			uint8x16_t op[4];
+			for(size_t i=0; i<4; i++) {
+				uint8x16_t chunk = chunks[i];
+				// { and [ differ only by 0x20, as do } and ]
+				uint8x16_t brackets = vorrq_u8(chunk, vdupq_n_u8(0x20));
+				quote[i] = vceqq_u8(chunk, vdupq_n_u8('"'));
+				backslash[i] = vceqq_u8(chunk, vdupq_n_u8('\\'));
+				whitespace[i] = vorrq_u8(
+					vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t'))),
+					vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\n')), vceqq_u8(chunk, vdupq_n_u8('\r'))));
+				op[i] = vorrq_u8(
+					vorrq_u8(vceqq_u8(brackets, vdupq_n_u8('{')), vceqq_u8(brackets, vdupq_n_u8('}'))),
+					vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(':')), vceqq_u8(chunk, vdupq_n_u8(','))));
+			}
+			BlockMasks masks;
+			masks.quote = neonBitmask(quote[0], quote[1], quote[2], quote[3]);
+			masks.backslash = neonBitmask(backslash[0], backslash[1], backslash[2], backslash[3]);
+			masks.whitespace = neonBitmask(whitespace[0], whitespace[1], whitespace[2], whitespace[3]);
+			masks.op = neonBitmask(op[0], op[1], op[2], op[3]);
+			return masks;
+		}
+
+		#else
+
+		enum: uint8_t {
+			CHAR_QUOTE = 1,
+			CHAR_BACKSLASH = 2,
+			CHAR_WHITESPACE = 4,
+			CHAR_OP = 8
+		};
+
+		struct CharClassTable {
+			uint8_t classes[256];
+
+			constexpr CharClassTable(): classes() {
+				classes[(uint8_t)'"'] = CHAR_QUOTE;
+				classes[(uint8_t)'\\'] = CHAR_BACKSLASH;
+				classes[(uint8_t)' '] = CHAR_WHITESPACE;
+				classes[(uint8_t)'\t'] = CHAR_WHITESPACE;
+				classes[(uint8_t)'\n'] = CHAR_WHITESPACE;
+				classes[(uint8_t)'\r'] = CHAR_WHITESPACE;
+				classes[(uint8_t)'{'] = CHAR_OP;
+				classes[(uint8_t)'}'] = CHAR_OP;
+				classes[(uint8_t)'['] = CHAR_OP;
+				classes[(uint8_t)']'] = CHAR_OP;
+				classes[(uint8_t)':'] = CHAR_OP;
+				classes[(uint8_t)','] = CHAR_OP;
+			}
+		};
+
+		constexpr CharClassTable charClassTable;
+
+		inline BlockMasks classifyBlock(const uint8_t* block) {
+			BlockMasks masks = { 0, 0, 0, 0 };
+			for(size_t i=0; i<64; i++) {
+				uint8_t charClass = charClassTable.classes[block[i]];
+				uint64_t bit = (uint64_t)1 << i;
+				masks.quote |= (charClass & CHAR_QUOTE) ? bit : 0;
+				masks.backslash |= (charClass & CHAR_BACKSLASH) ? bit : 0;
+				masks.whitespace |= (charClass & CHAR_WHITESPACE) ? bit : 0;
+				masks.op |= (charClass & CHAR_OP) ? bit : 0;
+			}
+			return masks;
+		}
+
+		#endif
+
+		/// Finds the characters that are escaped by an odd-length run of backslashes
+		inline uint64_t findEscapedCharacters(uint64_t backslashes, uint64_t& prevEndsOddBackslash) {
+			constexpr uint64_t evenBits = 0x5555555555555555ULL;
+			constexpr uint64_t oddBits = ~evenBits;
+			uint64_t startEdges = backslashes & ~(backslashes << 1);
+			uint64_t evenStartMask = evenBits ^ prevEndsOddBackslash;
+			uint64_t evenStarts = startEdges & evenStartMask;
+			uint64_t oddStarts = startEdges & ~evenStartMask;
+			uint64_t evenCarries = backslashes + evenStarts;
+			uint64_t oddCarries = backslashes + oddStarts;
+			bool endsOddBackslash = oddCarries < backslashes;
+			oddCarries |= prevEndsOddBackslash;
+			prevEndsOddBackslash = endsOddBackslash ? 1 : 0;
+			uint64_t evenCarryEnds = evenCarries & ~backslashes;
+			uint64_t oddCarryEnds = oddCarries & ~backslashes;
+			uint64_t evenStartOddEnd = evenCarryEnds & oddBits;
+			uint64_t oddStartEvenEnd = oddCarryEnds & evenBits;
+			return evenStartOddEnd | oddStartEvenEnd;
+		}
+
+		/// Sets each bit to the parity of the bits at or below it, turning quote positions into a mask of string contents
+		inline uint64_t prefixXor(uint64_t bits) {
+			bits ^= bits << 1;
+			bits ^= bits << 2;
+			bits ^= bits << 4;
+			bits ^= bits << 8;
+			bits ^= bits << 16;
+			bits ^= bits << 32;
+			return bits;
+		}
+
+		/// Records the offset of every structural character and the start of every value outside of strings
+		void indexStructure(std::string_view json, std::vector<uint32_t>& positions) {
+			const uint8_t* data = (const uint8_t*)json.data();
+			size_t length = json.size();
+			if(length > std::numeric_limits<uint32_t>::max()) {
+				throwParseError("JSON documents larger than 4 GiB are not supported", 0);
+			}
+			// typical documents have a structural character every 4 to 6 bytes, so this rarely needs to grow
+			positions.resize(std::max<size_t>(length / 4, 64));
+			size_t count = 0;
+			uint64_t prevEndsOddBackslash = 0;
+			uint64_t prevInString = 0;
+			// the start of the document can be followed by a value, just like whitespace
+			uint64_t prevEndsPseudoPred = 1;
+			alignas(16) uint8_t tail[64];
+			for(size_t offset=0; offset<length; offset+=64) {
+				const uint8_t* block = data + offset;
+				if((length - offset) < 64) {
+					std::memset(tail, ' ', sizeof(tail));
+					std::memcpy(tail, block, length - offset);
+					block = tail;
+				}
+				BlockMasks masks = classifyBlock(block);
+				uint64_t escaped = findEscapedCharacters(masks.backslash, prevEndsOddBackslash);
+				uint64_t quotes = masks.quote & ~escaped;
+				// includes each opening quote but not its closing quote
+				uint64_t inString = prefixXor(quotes) ^ prevInString;
+				prevInString = (uint64_t)((int64_t)inString >> 63);
+				uint64_t structurals = (masks.op & ~inString) | quotes;
+				// a value starts at any non-whitespace character that follows whitespace or a structural character
+				uint64_t pseudoPred = structurals | masks.whitespace;
+				uint64_t shiftedPseudoPred = (pseudoPred << 1) | prevEndsPseudoPred;
+				prevEndsPseudoPred = pseudoPred >> 63;
+				structurals |= shiftedPseudoPred & ~masks.whitespace & ~inString;
+				// closing quotes are only needed to find value starts
+				structurals &= ~(quotes & ~inString);
+				if((count + 64) > positions.size()) {
+					positions.resize(std::max(positions.size() * 2, count + 64));
+				}
+				uint32_t* output = positions.data() + count;
+				while(structurals != 0) {
+					*output = (uint32_t)(offset + (size_t)std::countr_zero(structurals));
+					output++;
+					structurals &= structurals - 1;
+				}
+				count = (size_t)(output - positions.data());
+			}
+			if(prevInString != 0) {
+				throwParseError("Unterminated string", length);
+			}
+			positions.resize(count);
+		}
+
+		/// Checks that the document is well formed UTF-8, as RFC 8259 requires.
+		/// Only ASCII is valid outside of strings, so this validates every string without decoding it.
+		void validateUTF8(std::string_view document) {
+			const uint8_t* data = (const uint8_t*)document.data();
+			size_t length = document.size();
+			size_t i = 0;
+			while(i < length) {
+				// skip ASCII a word at a time
+				if((length - i) >= 8) {
+					uint64_t word;
+					std::memcpy(&word, data + i, sizeof(word));
+					if((word & SWAR_HIGH_BITS) == 0) {
+						i += 8;
+						continue;
+					}
+				}
+				uint8_t lead = data[i];
+				if(lead < 0x80) {
+					i++;
+					continue;
+				}
+				// the range of the second byte excludes overlong forms, surrogates and code points past U+10FFFF
+				size_t sequenceLength;
+				uint8_t secondMin = 0x80;
+				uint8_t secondMax = 0xBF;
+				if(lead >= 0xC2 && lead <= 0xDF) {
+					sequenceLength = 2;
+				} else if(lead >= 0xE0 && lead <= 0xEF) {
+					sequenceLength = 3;
+					if(lead == 0xE0) {
+						secondMin = 0xA0;
+					} else if(lead == 0xED) {
+						secondMax = 0x9F;
+					}
+				} else if(lead >= 0xF0 && lead <= 0xF4) {
+					sequenceLength = 4;
+					if(lead == 0xF0) {
+						secondMin = 0x90;
+					} else if(lead == 0xF4) {
+						secondMax = 0x8F;
+					}
+				} else {
+					throwParseError("Invalid UTF-8", i);
+				}
+				if((length - i) < sequenceLength || data[i + 1] < secondMin || data[i + 1] > secondMax) {
+					throwParseError("Invalid UTF-8", i);
+				}
+				for(size_t j=2; j<sequenceLength; j++) {
+					if((data[i + j] & 0xC0) != 0x80) {
+						throwParseError("Invalid UTF-8", i);
+					}
+				}
+				i += sequenceLength;
+			}
+		}
+
+		/// Checks that the structural characters form valid JSON and matches each opening bracket to its closing bracket
+		void matchStructure(std::string_view document, const std::vector<uint32_t>& positions, std::vector<uint32_t>& ends) {
+			enum class State {
+				Value,
+				ValueOrClose,
+				Key,
+				KeyOrClose,
+				Colon,
+				AfterValue
+			};
+			const char* json = document.data();
+			uint32_t count = (uint32_t)positions.size();
+			if(count == 0) {
+				throwParseError("Expected a JSON value", document.size());
+			}
+			ends.assign(count, 0);
+			std::vector<uint32_t> stack;
+			State state = State::Value;
+			for(uint32_t i=0; i<count; i++) {
+				uint32_t offset = positions[i];
+				char c = json[offset];
+				bool closes = false;
+				switch(state) {
+					case State::Value:
+					case State::ValueOrClose:
+						if(c == '{' || c == '[') {
+							if(stack.size() >= JSON_MAX_DEPTH) {
+								throwParseError("JSON nesting is too deep", offset);
+							}
+							stack.push_back(i);
+							state = (c == '{') ? State::KeyOrClose : State::ValueOrClose;
+						} else if(c == ']' && state == State::ValueOrClose) {
+							closes = true;
+						} else if(c == '"' || c == '-' || isDigit(c) || c == 't' || c == 'f' || c == 'n') {
+							state = State::AfterValue;
+						} else {
+							throwParseError("Expected a JSON value", offset);
+						}
+						break;
+
+					case State::Key:
+					case State::KeyOrClose:
+						if(c == '"') {
+							state = State::Colon;
+						} else if(c == '}' && state == State::KeyOrClose) {
+							closes = true;
+						} else {
+							throwParseError("Expected a string key", offset);
+						}
+						break;
+
+					case State::Colon:
+						if(c != ':') {
+							throwParseError("Expected ':'", offset);
+						}
+						state = State::Value;
+						break;
+
+					case State::AfterValue: {
+						if(stack.empty()) {
+							throwParseError("Unexpected data after the root value", offset);
+						}
+						char container = json[positions[stack.back()]];
+						if(c == ',') {
+							state = (container == '{') ? State::Key : State::Value;
+						} else if((c == '}' && container == '{') || (c == ']' && container == '[')) {
+							closes = true;
+						} else {
+							throwParseError((container == '{') ? "Expected ',' or '}'" : "Expected ',' or ']'", offset);
+						}
+						break;
+					}
+				}
+				if(closes) {
+					ends[stack.back()] = i;
+					stack.pop_back();
+					state = State::AfterValue;
+				}
+			}
+			if(!stack.empty() || state != State::AfterValue) {
+				throwParseError("Unexpected end of JSON", document.size());
+			}
+		}
+
+
+
+		#pragma mark Value parsing
+
+		inline int hexValue(char c) {
+			if(c >= '0' && c <= '9') {
+				return c - '0';
+			} else if(c >= 'a' && c <= 'f') {
+				return c - 'a' + 10;
+			} else if(c >= 'A' && c <= 'F') {
+				return c - 'A' + 10;
+			}
+			return -1;
+		}
+
+		uint32_t readHex4(const char* json, const char* p, const char* end) {
+			if((end - p) < 4) {
+				throwParseError("Incomplete unicode escape", (size_t)(p - json));
+			}
+			uint32_t value = 0;
+			for(size_t i=0; i<4; i++) {
+				int digit = hexValue(p[i]);
+				if(digit < 0) {
+					throwParseError("Invalid unicode escape", (size_t)(p - json));
+				}
+				value = (value << 4) | (uint32_t)digit;
+			}
+			return value;
+		}
+
+		void appendUTF8(std::string& str, uint32_t codePoint) {
+			if(codePoint < 0x80) {
+				str.push_back((char)codePoint);
+			} else if(codePoint < 0x800) {
+				str.push_back((char)(0xC0 | (codePoint >> 6)));
+				str.push_back((char)(0x80 | (codePoint & 0x3F)));
+			} else if(codePoint < 0x10000) {
+				str.push_back((char)(0xE0 | (codePoint >> 12)));
+				str.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+				str.push_back((char)(0x80 | (codePoint & 0x3F)));
+			} else {
+				str.push_back((char)(0xF0 | (codePoint >> 18)));
+				str.push_back((char)(0x80 | ((codePoint >> 12) & 0x3F)));
+				str.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+				str.push_back((char)(0x80 | (codePoint & 0x3F)));
+			}
+		}
+
+		/// Reads the string starting with the quote at the given offset.
+		/// Returns a view of the document when the string has no escapes, or of the buffer otherwise.
+		std::string_view readString(std::string_view document, size_t offset, std::string& buffer, size_t* endOffset = nullptr) {
+			const char* json = document.data();
+			const char* end = json + document.size();
+			const char* begin = json + offset + 1;
+			const char* p = findSpecialCharacter(begin, end);
+			if(p != end && *p == '"') {
+				if(endOffset != nullptr) {
+					*endOffset = (size_t)(p + 1 - json);
+				}
+				return std::string_view(begin, (size_t)(p - begin));
+			}
+			buffer.assign(begin, p);
+			while(true) {
+				if(p == end) {
+					throwParseError("Unterminated string", (size_t)(p - json));
+				}
+				char c = *p;
+				if(c == '"') {
+					break;
+				} else if((unsigned char)c < 0x20) {
+					throwParseError("Unescaped control character in string", (size_t)(p - json));
+				}
+				// c is a backslash
+				p++;
+				if(p == end) {
+					throwParseError("Unterminated string", (size_t)(p - json));
+				}
+				switch(*p) {
+					case '"':
+						buffer.push_back('"');
+						break;
+					case '\\':
+						buffer.push_back('\\');
+						break;
+					case '/':
+						buffer.push_back('/');
+						break;
+					case 'b':
+						buffer.push_back('\b');
+						break;
+					case 'f':
+						buffer.push_back('\f');
+						break;
+					case 'n':
+						buffer.push_back('\n');
+						break;
+					case 'r':
+						buffer.push_back('\r');
+						break;
+					case 't':
+						buffer.push_back('\t');
+						break;
+					case 'u': {
+						uint32_t codePoint = readHex4(json, p + 1, end);
+						p += 4;
+						if(codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+							// high surrogate, which must be followed by an escaped low surrogate
+							if((end - p) < 7 || p[1] != '\\' || p[2] != 'u') {
+								throwParseError("Unpaired surrogate in unicode escape", (size_t)(p - json));
+							}
+							uint32_t lowSurrogate = readHex4(json, p + 3, end);
+							if(lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF) {
+								throwParseError("Unpaired surrogate in unicode escape", (size_t)(p - json));
+							}
+							codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+							p += 6;
+						} else if(codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+							throwParseError("Unpaired surrogate in unicode escape", (size_t)(p - json));
+						}
+						appendUTF8(buffer, codePoint);
+						break;
+					}
+					default:
+						throwParseError("Invalid escape sequence", (size_t)(p - json));
+				}
+				p++;
+				const char* next = findSpecialCharacter(p, end);
+				buffer.append(p, next);
+				p = next;
+			}
+			if(endOffset != nullptr) {
+				*endOffset = (size_t)(p + 1 - json);
+			}
+			return std::string_view(buffer);
+		}
+
+		constexpr double exactPowersOf10[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		double parseDoubleSlow(const char* json, const char* begin, const char* end) {
+			#if defined(__cpp_lib_to_chars) && !defined(__APPLE__)
+				double value = 0;
+				auto result = std::from_chars(begin, end, value);
+				if(result.ec == std::errc::result_out_of_range) {
+					// from_chars leaves the value unset when it overflows or underflows
+					bool negative = (*begin == '-');
+					const char* exponent = std::find_if(begin, end, [](char c) { return c == 'e' || c == 'E'; });
+					if(exponent != end && exponent[1] == '-') {
+						return negative ? -0.0 : 0.0;
+					}
+					return negative ? -HUGE_VAL : HUGE_VAL;
+				} else if(result.ec != std::errc() || result.ptr != end) {
+					throwParseError("Invalid number", (size_t)(begin - json));
+				}
+				return value;
+			#else
+				// strtod needs a terminated string
+				std::string numberString(begin, end);
+				#if defined(__APPLE__)
+					return strtod_l(numberString.c_str(), nullptr, LC_C_LOCALE);
+				#else
+					return std::strtod(numberString.c_str(), nullptr);
+				#endif
+			#endif
+		}
+
+		struct JSONNumber {
+			enum class Kind {
+				Int64,
+				UInt64,
+				Double
+			};
+			Kind kind;
+			union {
+				int64_t int64Value;
+				uint64_t uint64Value;
+				double doubleValue;
+			};
+
+			double toDouble() const {
+				switch(kind) {
+					case Kind::Int64:
+						return (double)int64Value;
+					case Kind::UInt64:
+						return (double)uint64Value;
+					case Kind::Double:
+						return doubleValue;
+				}
+				return doubleValue;
+			}
+		};
+
+		/// Parses the number at the given offset, following the JSON grammar strictly
+		JSONNumber readNumber(std::string_view document, size_t offset, size_t* endOffset = nullptr) {
+			const char* json = document.data();
+			const char* end = json + document.size();
+			const char* begin = json + offset;
+			const char* p = begin;
+			bool negative = false;
+			if(*p == '-') {
+				negative = true;
+				p++;
+			}
+			if(p == end || !isDigit(*p)) {
+				throwParseError("Invalid number", offset);
+			}
+			// collect up to 19 significant digits for the fast path
+			uint64_t mantissa = 0;
+			int digitCount = 0;
+			int fractionDigitCount = 0;
+			bool isInteger = true;
+			if(*p == '0') {
+				p++;
+			} else {
+				for(; p != end && isDigit(*p); p++) {
+					mantissa = (mantissa * 10) + (uint64_t)(*p - '0');
+					digitCount++;
+				}
+			}
+			if(p != end && *p == '.') {
+				isInteger = false;
+				p++;
+				if(p == end || !isDigit(*p)) {
+					throwParseError("Invalid number", offset);
+				}
+				for(; p != end && isDigit(*p); p++) {
+					if(mantissa != 0 || *p != '0') {
+						digitCount++;
+					}
+					mantissa = (mantissa * 10) + (uint64_t)(*p - '0');
+					fractionDigitCount++;
+				}
+			}
+			int exponent = 0;
+			if(p != end && (*p == 'e' || *p == 'E')) {
+				isInteger = false;
+				p++;
+				bool negativeExponent = false;
+				if(p != end && (*p == '+' || *p == '-')) {
+					negativeExponent = (*p == '-');
+					p++;
+				}
+				if(p == end || !isDigit(*p)) {
+					throwParseError("Invalid number", offset);
+				}
+				for(; p != end && isDigit(*p); p++) {
+					if(exponent < 100000) {
+						exponent = (exponent * 10) + (*p - '0');
+					}
+				}
+				if(negativeExponent) {
+					exponent = -exponent;
+				}
+			}
+			if(p != end && !isJSONDelimiter(*p)) {
+				throwParseError("Invalid number", offset);
+			}
+			if(endOffset != nullptr) {
+				*endOffset = (size_t)(p - json);
+			}
+			JSONNumber number;
+			if(isInteger) {
+				const char* digits = negative ? (begin + 1) : begin;
+				uint64_t magnitude = 0;
+				auto result = std::from_chars(digits, p, magnitude);
+				if(result.ec == std::errc()) {
+					if(!negative) {
+						if(magnitude <= (uint64_t)std::numeric_limits<int64_t>::max()) {
+							number.kind = JSONNumber::Kind::Int64;
+							number.int64Value = (int64_t)magnitude;
+						} else {
+							number.kind = JSONNumber::Kind::UInt64;
+							number.uint64Value = magnitude;
+						}
+						return number;
+					} else if(magnitude <= ((uint64_t)std::numeric_limits<int64_t>::max() + 1)) {
+						number.kind = JSONNumber::Kind::Int64;
+						number.int64Value = (int64_t)(0 - magnitude);
+						return number;
+					}
+				}
+			}
+			number.kind = JSONNumber::Kind::Double;
+			// when the digits and the power of 10 are both exactly representable, one multiplication or division rounds correctly
+			int powerOf10 = exponent - fractionDigitCount;
+			if(digitCount <= 19 && mantissa <= ((uint64_t)1 << 53) && powerOf10 >= -22 && powerOf10 <= 22) {
+				double value = (double)mantissa;
+				if(powerOf10 < 0) {
+					value /= exactPowersOf10[-powerOf10];
+				} else {
+					value *= exactPowersOf10[powerOf10];
+				}
+				number.doubleValue = negative ? -value : value;
+				return number;
+			}
+			number.doubleValue = parseDoubleSlow(json, begin, p);
+			return number;
+		}
+
+		/// Reads true, false, or null at the given offset
+		JSONType readLiteral(std::string_view document, size_t offset, bool* boolValue = nullptr, size_t* endOffset = nullptr) {
+			const char* json = document.data();
+			size_t remaining = document.size() - offset;
+			const char* p = json + offset;
+			JSONType type;
+			size_t length;
+			if(remaining >= 4 && std::memcmp(p, "true", 4) == 0) {
+				type = JSONType::Boolean;
+				length = 4;
+				if(boolValue != nullptr) {
+					*boolValue = true;
+				}
+			} else if(remaining >= 5 && std::memcmp(p, "false", 5) == 0) {
+				type = JSONType::Boolean;
+				length = 5;
+				if(boolValue != nullptr) {
+					*boolValue = false;
+				}
+			} else if(remaining >= 4 && std::memcmp(p, "null", 4) == 0) {
+				type = JSONType::Null;
+				length = 4;
+			} else {
+				throwParseError("Invalid literal", offset);
+			}
+			if(length < remaining && !isJSONDelimiter(p[length])) {
+				throwParseError("Invalid literal", offset);
+			}
+			if(endOffset != nullptr) {
+				*endOffset = offset + length;
+			}
+			return type;
+		}
+
+		const char* typeName(JSONType type) {
+			switch(type) {
+				case JSONType::Null:
+					return "null";
+				case JSONType::Boolean:
+					return "boolean";
+				case JSONType::Number:
+					return "number";
+				case JSONType::String:
+					return "string";
+				case JSONType::Array:
+					return "array";
+				case JSONType::Object:
+					return "object";
+			}
+			return "value";
+		}
+
+		[[noreturn]] void throwTypeError(JSONType expected, JSONType actual, size_t offset) {
+			throw std::logic_error(std::string("Expected JSON ") + typeName(expected) + " but found " + typeName(actual) + " at offset " + std::to_string(offset));
+		}
+
+		/// The unescaped text of a key, if it has no escapes
+		inline Optional<std::string_view> rawKey(const _JSONTape& tape, uint32_t keyIndex) {
+			// the key ends at the last quote before the colon that follows it
+			const char* json = tape.json.data();
+			const char* begin = json + tape.positions[keyIndex] + 1;
+			const char* end = json + tape.positions[keyIndex + 1];
+			while(*end != '"') {
+				end--;
+			}
+			std::string_view key(begin, (size_t)(end - begin));
+			if(key.find('\\') != std::string_view::npos) {
+				return std::nullopt;
+			}
+			return key;
+		}
+	}
+
+
+
+	#pragma mark JSONParseError implementation
+
+	JSONParseError::JSONParseError(const std::string& message, size_t offset)
+	: std::invalid_argument(message), _offset(offset) {
+		//
+	}
+
+	size_t JSONParseError::offset() const noexcept {
+		return _offset;
+	}
+
+
+
+	#pragma mark JSONValue implementation
+
+	JSONType JSONValue::type() const {
+		switch(_tape->charAt(_index)) {
+			case '{':
+				return JSONType::Object;
+			case '[':
+				return JSONType::Array;
+			case '"':
+				return JSONType::String;
+			case 't':
+			case 'f':
+				return JSONType::Boolean;
+			case 'n':
+				return JSONType::Null;
+			default:
+				return JSONType::Number;
+		}
+	}
+
+	bool JSONValue::isInteger() const {
+		if(type() != JSONType::Number) {
+			return false;
+		}
+		return readNumber(_tape->json, offset()).kind != JSONNumber::Kind::Double;
+	}
+
+	bool JSONValue::asBool() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Boolean) {
+			throwTypeError(JSONType::Boolean, valueType, offset());
+		}
+		bool value = false;
+		readLiteral(_tape->json, offset(), &value);
+		return value;
+	}
+
+	int64_t JSONValue::asInt64() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Number) {
+			throwTypeError(JSONType::Number, valueType, offset());
+		}
+		JSONNumber number = readNumber(_tape->json, offset());
+		switch(number.kind) {
+			case JSONNumber::Kind::Int64:
+				return number.int64Value;
+			case JSONNumber::Kind::UInt64:
+				return integral_cast<int64_t>(number.uint64Value);
+			case JSONNumber::Kind::Double:
+				return integral_cast<int64_t>(number.doubleValue);
+		}
+		return 0;
+	}
+
+	uint64_t JSONValue::asUInt64() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Number) {
+			throwTypeError(JSONType::Number, valueType, offset());
+		}
+		JSONNumber number = readNumber(_tape->json, offset());
+		switch(number.kind) {
+			case JSONNumber::Kind::Int64:
+				return integral_cast<uint64_t>(number.int64Value);
+			case JSONNumber::Kind::UInt64:
+				return number.uint64Value;
+			case JSONNumber::Kind::Double:
+				return integral_cast<uint64_t>(number.doubleValue);
+		}
+		return 0;
+	}
+
+	double JSONValue::asDouble() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Number) {
+			throwTypeError(JSONType::Number, valueType, offset());
+		}
+		return readNumber(_tape->json, offset()).toDouble();
+	}
+
+	String JSONValue::asString() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::String) {
+			throwTypeError(JSONType::String, valueType, offset());
+		}
+		std::string buffer;
+		std::string_view str = readString(_tape->json, offset(), buffer);
+		if(str.data() == buffer.data()) {
+			return String(std::move(buffer));
+		}
+		return String(str.data(), str.size());
+	}
+
+	Any JSONValue::toAny() const {
+		switch(type()) {
+			case JSONType::Null:
+				readLiteral(_tape->json, offset());
+				return Any();
+			case JSONType::Boolean:
+				return Any(asBool());
+			case JSONType::Number: {
+				JSONNumber number = readNumber(_tape->json, offset());
+				if(number.kind == JSONNumber::Kind::Int64) {
+					return Any(number.int64Value);
+				} else if(number.kind == JSONNumber::Kind::UInt64) {
+					return Any(number.uint64Value);
+				}
+				return Any(number.doubleValue);
+			}
+			case JSONType::String:
+				return Any(asString());
+			case JSONType::Array: {
+				ArrayList<Any> list;
+				for(auto item : *this) {
+					list.pushBack(item.toAny());
+				}
+				return Any(std::move(list));
+			}
+			case JSONType::Object: {
+				Map<String,Any> map;
+				for(auto member : members()) {
+					map.insert_or_assign(member.key(), member.value().toAny());
+				}
+				return Any(std::move(map));
+			}
+		}
+		return Any();
+	}
+
+
+
+	size_t JSONValue::size() const {
+		JSONType valueType = type();
+		if(valueType == JSONType::Array) {
+			size_t count = 0;
+			for(auto it=begin(), endIt=end(); it!=endIt; ++it) {
+				count++;
+			}
+			return count;
+		} else if(valueType == JSONType::Object) {
+			size_t count = 0;
+			auto range = members();
+			for(auto it=range.begin(), endIt=range.end(); it!=endIt; ++it) {
+				count++;
+			}
+			return count;
+		}
+		throwTypeError(JSONType::Array, valueType, offset());
+	}
+
+	JSONValue JSONValue::at(size_t index) const {
+		auto value = maybeAt(index);
+		if(!value) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in JSON array at offset " + std::to_string(offset()));
+		}
+		return value.value();
+	}
+
+	JSONValue JSONValue::at(std::string_view key) const {
+		auto value = maybeAt(key);
+		if(!value) {
+			throw std::out_of_range("key \"" + std::string(key) + "\" does not exist in JSON object at offset " + std::to_string(offset()));
+		}
+		return value.value();
+	}
+
+	Optional<JSONValue> JSONValue::maybeAt(size_t index) const {
+		size_t i = 0;
+		for(auto it=begin(), endIt=end(); it!=endIt; ++it) {
+			if(i == index) {
+				return *it;
+			}
+			i++;
+		}
+		return std::nullopt;
+	}
+
+	Optional<JSONValue> JSONValue::maybeAt(std::string_view key) const {
+		auto range = members();
+		for(auto member : range) {
+			if(member.keyEquals(key)) {
+				return member.value();
+			}
+		}
+		return std::nullopt;
+	}
+
+
+
+	JSONValue::Iterator JSONValue::begin() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Array) {
+			throwTypeError(JSONType::Array, valueType, offset());
+		}
+		return Iterator(_tape, _index + 1);
+	}
+
+	JSONValue::Iterator JSONValue::end() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Array) {
+			throwTypeError(JSONType::Array, valueType, offset());
+		}
+		return Iterator(_tape, _tape->ends[_index]);
+	}
+
+	JSONValue::MemberRange JSONValue::members() const {
+		JSONType valueType = type();
+		if(valueType != JSONType::Object) {
+			throwTypeError(JSONType::Object, valueType, offset());
+		}
+		return MemberRange(MemberIterator(_tape, _index + 1), MemberIterator(_tape, _tape->ends[_index]));
+	}
+
+
+
+	std::string_view JSONValue::rawJSON() const {
+		const String& json = _tape->json;
+		size_t start = offset();
+		size_t endOffset = start;
+		switch(type()) {
+			case JSONType::Object:
+			case JSONType::Array:
+				endOffset = _tape->positions[_tape->ends[_index]] + 1;
+				break;
+			case JSONType::String: {
+				std::string buffer;
+				readString(json, start, buffer, &endOffset);
+				break;
+			}
+			case JSONType::Number:
+				readNumber(json, start, &endOffset);
+				break;
+			case JSONType::Null:
+			case JSONType::Boolean:
+				readLiteral(json, start, nullptr, &endOffset);
+				break;
+		}
+		return std::string_view(json.data() + start, endOffset - start);
+	}
+
+	size_t JSONValue::offset() const {
+		return _tape->positions[_index];
+	}
+
+	String JSONValue::toString() const {
+		auto json = rawJSON();
+		return String(json.data(), json.size());
+	}
+
+
+
+	JSONValue::Iterator& JSONValue::Iterator::operator++() {
+		uint32_t next = _tape->after(_index);
+		if(_tape->charAt(next) == ',') {
+			next++;
+		}
+		_index = next;
+		return *this;
+	}
+
+	String JSONValue::Member::key() const {
+		return keyValue().asString();
+	}
+
+	bool JSONValue::Member::keyEquals(std::string_view key) const {
+		auto raw = rawKey(*_tape, _keyIndex);
+		if(raw) {
+			return raw.value() == key;
+		}
+		return key == std::string_view(this->key());
+	}
+
+	JSONValue::MemberIterator& JSONValue::MemberIterator::operator++() {
+		uint32_t next = _tape->after(_keyIndex + 2);
+		if(_tape->charAt(next) == ',') {
+			next++;
+		}
+		_keyIndex = next;
+		return *this;
+	}
+
+
+
+	#pragma mark JSONDocument implementation
+
+	JSONDocument::JSONDocument(String json)
+	: _tape(std::make_unique<_JSONTape>()) {
+		_tape->json = std::move(json);
+		validateUTF8(_tape->json);
+		indexStructure(_tape->json, _tape->positions);
+		matchStructure(_tape->json, _tape->positions, _tape->ends);
+	}
+
+	JSONDocument::JSONDocument(JSONDocument&&) noexcept = default;
+
+	JSONDocument::~JSONDocument() {
+		//
+	}
+
+	JSONDocument& JSONDocument::operator=(JSONDocument&&) noexcept = default;
+
+	JSONValue JSONDocument::root() const {
+		return JSONValue(_tape.get(), 0);
+	}
+
+	const String& JSONDocument::json() const {
+		return _tape->json;
+	}
+
+
+
+	#pragma mark JSONHandler implementation
+
+	JSONHandler::~JSONHandler() {
+		//
+	}
+
+	void JSONHandler::onNull() {
+		//
+	}
+
+	void JSONHandler::onBool(bool) {
+		//
+	}
+
+	void JSONHandler::onInteger(int64_t) {
+		//
+	}
+
+	void JSONHandler::onDouble(double) {
+		//
+	}
+
+	void JSONHandler::onString(std::string_view) {
+		//
+	}
+
+	void JSONHandler::onKey(std::string_view) {
+		//
+	}
+
+	void JSONHandler::onObjectStart() {
+		//
+	}
+
+	void JSONHandler::onObjectEnd() {
+		//
+	}
+
+	void JSONHandler::onArrayStart() {
+		//
+	}
+
+	void JSONHandler::onArrayEnd() {
+		//
+	}
+
+
+
+	#pragma mark JSONWriter implementation
+
+	void JSONWriter::beforeValue() {
+		if(_afterKey) {
+			_afterKey = false;
+			return;
+		}
+		if(!_levelIsEmpty.empty()) {
+			if(_levelIsEmpty.back()) {
+				_levelIsEmpty.back() = false;
+			} else {
+				_writer.write(',');
+			}
+			writeNewline();
+		}
+	}
+
+	void JSONWriter::writeNewline() {
+		if(_options.indent == 0) {
+			return;
+		}
+		static constexpr char spaces[] = "                                ";
+		_writer.write('\n');
+		size_t indent = _options.indent * _levelIsEmpty.size();
+		while(indent > 0) {
+			size_t count = std::min(indent, sizeof(spaces) - 1);
+			_writer.write(spaces, count);
+			indent -= count;
+		}
+	}
+
+	void JSONWriter::writeString(std::string_view str) {
+		static constexpr char hexDigits[] = "0123456789abcdef";
+		_writer.write('"');
+		const char* p = str.data();
+		const char* end = p + str.size();
+		while(p != end) {
+			const char* special = findSpecialCharacter(p, end);
+			_writer.write(p, (size_t)(special - p));
+			if(special == end) {
+				break;
+			}
+			char c = *special;
+			switch(c) {
+				case '"':
+					_writer.write("\\\"", 2);
+					break;
+				case '\\':
+					_writer.write("\\\\", 2);
+					break;
+				case '\b':
+					_writer.write("\\b", 2);
+					break;
+				case '\f':
+					_writer.write("\\f", 2);
+					break;
+				case '\n':
+					_writer.write("\\n", 2);
+					break;
+				case '\r':
+					_writer.write("\\r", 2);
+					break;
+				case '\t':
+					_writer.write("\\t", 2);
+					break;
+				default: {
+					char escape[6] = { '\\', 'u', '0', '0', hexDigits[((unsigned char)c) >> 4], hexDigits[((unsigned char)c) & 0xF] };
+					_writer.write(escape, sizeof(escape));
+					break;
+				}
+			}
+			p = special + 1;
+		}
+		_writer.write('"');
+	}
+
+	void JSONWriter::beginObject() {
+		beforeValue();
+		_writer.write('{');
+		_levelIsEmpty.push_back(true);
+	}
+
+	void JSONWriter::endObject() {
+		bool empty = _levelIsEmpty.back();
+		_levelIsEmpty.pop_back();
+		if(!empty) {
+			writeNewline();
+		}
+		_writer.write('}');
+	}
+
+	void JSONWriter::beginArray() {
+		beforeValue();
+		_writer.write('[');
+		_levelIsEmpty.push_back(true);
+	}
+
+	void JSONWriter::endArray() {
+		bool empty = _levelIsEmpty.back();
+		_levelIsEmpty.pop_back();
+		if(!empty) {
+			writeNewline();
+		}
+		_writer.write(']');
+	}
+
+	void JSONWriter::key(std::string_view key) {
+		beforeValue();
+		writeString(key);
+		if(_options.indent == 0) {
+			_writer.write(':');
+		} else {
+			_writer.write(": ", 2);
+		}
+		_afterKey = true;
+	}
+
+	void JSONWriter::null() {
+		beforeValue();
+		_writer.write("null", 4);
+	}
+
+	void JSONWriter::value(bool value) {
+		beforeValue();
+		if(value) {
+			_writer.write("true", 4);
+		} else {
+			_writer.write("false", 5);
+		}
+	}
+
+	void JSONWriter::value(double value) {
+		beforeValue();
+		if(!std::isfinite(value)) {
+			_writer.write("null", 4);
+			return;
+		}
+		#if defined(__cpp_lib_to_chars) && !defined(__APPLE__)
+			char buffer[32];
+			auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+			_writer.write(buffer, (size_t)(result.ptr - buffer));
+		#else
+			// 17 significant digits always parse back to the same value
+			char buffer[32];
+			int length = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+			_writer.write(buffer, (size_t)length);
+		#endif
+	}
+
+	void JSONWriter::value(std::string_view value) {
+		beforeValue();
+		writeString(value);
+	}
+
+	void JSONWriter::rawValue(std::string_view json) {
+		beforeValue();
+		_writer.write(json);
+	}
+
+
+
+	#pragma mark JSON implementation
+
+	JSONDocument JSON::parse(String json) {
+		return JSONDocument(std::move(json));
+	}
+
+	void JSON::parse(std::string_view json, JSONHandler& handler) {
+		// the document is walked in order, so every value is reported and validated
+		// the caller's text is indexed in place, since the tape only stores offsets into it
+		std::vector<uint32_t> positions;
+		std::vector<uint32_t> ends;
+		validateUTF8(json);
+		indexStructure(json, positions);
+		matchStructure(json, positions, ends);
+		std::vector<bool> inObject;
+		bool expectingKey = false;
+		std::string buffer;
+		uint32_t count = (uint32_t)positions.size();
+		for(uint32_t i=0; i<count; i++) {
+			size_t offset = positions[i];
+			char c = json[offset];
+			switch(c) {
+				case '{':
+					handler.onObjectStart();
+					inObject.push_back(true);
+					expectingKey = true;
+					break;
+				case '}':
+					inObject.pop_back();
+					expectingKey = false;
+					handler.onObjectEnd();
+					break;
+				case '[':
+					handler.onArrayStart();
+					inObject.push_back(false);
+					expectingKey = false;
+					break;
+				case ']':
+					inObject.pop_back();
+					handler.onArrayEnd();
+					break;
+				case ',':
+					expectingKey = inObject.back();
+					break;
+				case ':':
+					break;
+				case '"': {
+					std::string_view str = readString(json, offset, buffer);
+					if(expectingKey) {
+						expectingKey = false;
+						handler.onKey(str);
+					} else {
+						handler.onString(str);
+					}
+					break;
+				}
+				case 't':
+				case 'f':
+				case 'n': {
+					bool value = false;
+					if(readLiteral(json, offset, &value) == JSONType::Null) {
+						handler.onNull();
+					} else {
+						handler.onBool(value);
+					}
+					break;
+				}
+				default: {
+					JSONNumber number = readNumber(json, offset);
+					if(number.kind == JSONNumber::Kind::Int64) {
+						handler.onInteger(number.int64Value);
+					} else {
+						handler.onDouble(number.toDouble());
+					}
+					break;
+				}
+			}
+		}
+	}
+
+
+
+	#pragma mark json_traits implementation
+
+	std::nullptr_t json_traits<std::nullptr_t>::decode(const JSONValue& json) {
+		if(!json.isNull()) {
+			throwTypeError(JSONType::Null, json.type(), json.offset());
+		}
+		return nullptr;
+	}
+
+	void json_traits<std::nullptr_t>::encode(JSONWriter& writer, std::nullptr_t) {
+		writer.null();
+	}
+
+	bool json_traits<bool>::decode(const JSONValue& json) {
+		return json.asBool();
+	}
+
+	void json_traits<bool>::encode(JSONWriter& writer, bool value) {
+		writer.value(value);
+	}
+
+	String json_traits<String>::decode(const JSONValue& json) {
+		return json.asString();
+	}
+
+	void json_traits<String>::encode(JSONWriter& writer, const String& value) {
+		writer.value(std::string_view(value));
+	}
+
+	std::string json_traits<std::string>::decode(const JSONValue& json) {
+		return json.asString();
+	}
+
+	void json_traits<std::string>::encode(JSONWriter& writer, const std::string& value) {
+		writer.value(std::string_view(value));
+	}
+
+	Date json_traits<Date>::decode(const JSONValue& json) {
+		return Date::fromISOString(json.asString());
+	}
+
+	void json_traits<Date>::encode(JSONWriter& writer, const Date& value) {
+		writer.value(std::string_view(value.toISOString()));
+	}
+
+	Any json_traits<Any>::decode(const JSONValue& json) {
+		return json.toAny();
+	}
+
+	void json_traits<Any>::encode(JSONWriter& writer, const Any& value) {
+		if(value.empty() || value.is<std::nullptr_t>()) {
+			writer.null();
+		} else if(value.is<bool>()) {
+			writer.value(value.as<bool>());
+		} else if(value.is<int>()) {
+			writer.value(value.as<int>());
+		} else if(value.is<long>()) {
+			writer.value(value.as<long>());
+		} else if(value.is<long long>()) {
+			writer.value(value.as<long long>());
+		} else if(value.is<unsigned int>()) {
+			writer.value(value.as<unsigned int>());
+		} else if(value.is<unsigned long>()) {
+			writer.value(value.as<unsigned long>());
+		} else if(value.is<unsigned long long>()) {
+			writer.value(value.as<unsigned long long>());
+		} else if(value.is<double>()) {
+			writer.value(value.as<double>());
+		} else if(value.is<float>()) {
+			writer.value((double)value.as<float>());
+		} else if(value.is<String>()) {
+			writer.value(std::string_view(value.as<String>()));
+		} else if(value.is<std::string>()) {
+			writer.value(std::string_view(value.as<std::string>()));
+		} else if(value.is<const char*>()) {
+			writer.value(value.as<const char*>());
+		} else if(value.is<ArrayList<Any>>()) {
+			writer.write(value.as<ArrayList<Any>>());
+		} else if(value.is<LinkedList<Any>>()) {
+			writer.write(value.as<LinkedList<Any>>());
+		} else if(value.is<Map<String,Any>>()) {
+			writer.write(value.as<Map<String,Any>>());
+		} else if(value.is<Date>()) {
+			writer.write(value.as<Date>());
+		} else if(value.is<JSONValue>()) {
+			writer.write(value.as<JSONValue>());
+		} else {
+			throw std::invalid_argument("Cannot encode Any holding " + value.typeName() + " as JSON");
+		}
+	}
+
+	void json_traits<JSONValue>::encode(JSONWriter& writer, const JSONValue& value) {
+		writer.rawValue(value.rawJSON());
+	}
+}
@@ -0,0 +1,648 @@
+//
+//  JSON.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/Any.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/LinkedList.hpp>
+#include <fgl/data/Map.hpp>
+#include <fgl/data/Number.hpp>
+#include <fgl/data/Optional.hpp>
+#include <fgl/data/String.hpp>
+#include <fgl/data/Stringify.hpp>
+#include <fgl/time/Date.hpp>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace fgl {
+	class JSONValue;
+	class JSONWriter;
+	struct _JSONTape;
+
+	enum class JSONType: uint8_t {
+		Null,
+		Boolean,
+		Number,
+		String,
+		Array,
+		Object
+	};
+
+	/// Thrown when JSON text is malformed
+	class JSONParseError: public std::invalid_argument {
+	public:
+		JSONParseError(const std::string& message, size_t offset);
+
+		/// The byte offset in the JSON text where the problem was found
+		size_t offset() const noexcept;
+
+	private:
+		size_t _offset;
+	};
+
+
+	/// Converts a type to and from JSON.
+	/// Specialize this with static T decode(const JSONValue&) and static void encode(JSONWriter&, const T&) to support your own types.
+	template<typename T>
+	struct json_traits;
+
+
+	/// A value within a JSONDocument, decoded when it's accessed.
+	/// A value refers to its document and must not outlive it.
+	class JSONValue {
+		friend class JSONDocument;
+	public:
+		class Iterator;
+		class Member;
+		class MemberIterator;
+		class MemberRange;
+
+		JSONType type() const;
+		inline bool isNull() const;
+		inline bool isBool() const;
+		inline bool isNumber() const;
+		inline bool isString() const;
+		inline bool isArray() const;
+		inline bool isObject() const;
+		/// Whether the value is a number without a fraction or exponent that fits in 64 bits
+		bool isInteger() const;
+
+		bool asBool() const;
+		int64_t asInt64() const;
+		uint64_t asUInt64() const;
+		double asDouble() const;
+		String asString() const;
+		template<typename T>
+		inline T as() const;
+		/// Decodes the value and everything inside it.
+		/// Objects become Map<String,Any>, arrays become ArrayList<Any>, and numbers become int64_t, uint64_t if too large for int64_t, or double. null becomes an empty Any.
+		Any toAny() const;
+
+		/// The number of items in an array or members in an object
+		size_t size() const;
+		JSONValue at(size_t index) const;
+		JSONValue at(std::string_view key) const;
+		inline JSONValue operator[](size_t index) const;
+		inline JSONValue operator[](std::string_view key) const;
+		Optional<JSONValue> maybeAt(size_t index) const;
+		Optional<JSONValue> maybeAt(std::string_view key) const;
+		inline bool contains(std::string_view key) const;
+
+		/// Iterates the items of an array
+		Iterator begin() const;
+		Iterator end() const;
+		/// Iterates the members of an object
+		MemberRange members() const;
+
+		/// The unparsed text of the value
+		std::string_view rawJSON() const;
+		/// The byte offset of the value in the document
+		size_t offset() const;
+		String toString() const;
+
+	private:
+		inline JSONValue(const _JSONTape* tape, uint32_t index) noexcept;
+
+		const _JSONTape* _tape;
+		uint32_t _index;
+	};
+
+
+	class JSONValue::Iterator {
+		friend class JSONValue;
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = JSONValue;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = JSONValue;
+
+		inline Iterator() noexcept;
+
+		inline JSONValue operator*() const;
+		Iterator& operator++();
+		inline Iterator operator++(int);
+		inline bool operator==(const Iterator& it) const noexcept;
+		inline bool operator!=(const Iterator& it) const noexcept;
+
+	private:
+		inline Iterator(const _JSONTape* tape, uint32_t index) noexcept;
+
+		const _JSONTape* _tape;
+		uint32_t _index;
+	};
+
+
+	class JSONValue::Member {
+		friend class JSONValue;
+	public:
+		String key() const;
+		/// Whether the key equals the given unescaped string, without decoding the key when it has no escapes
+		bool keyEquals(std::string_view key) const;
+		inline JSONValue keyValue() const;
+		inline JSONValue value() const;
+
+	private:
+		inline Member(const _JSONTape* tape, uint32_t keyIndex) noexcept;
+
+		const _JSONTape* _tape;
+		uint32_t _keyIndex;
+	};
+
+
+	class JSONValue::MemberIterator {
+		friend class JSONValue;
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Member;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Member;
+
+		inline MemberIterator() noexcept;
+
+		inline Member operator*() const;
+		MemberIterator& operator++();
+		inline MemberIterator operator++(int);
+		inline bool operator==(const MemberIterator& it) const noexcept;
+		inline bool operator!=(const MemberIterator& it) const noexcept;
+
+	private:
+		inline MemberIterator(const _JSONTape* tape, uint32_t keyIndex) noexcept;
+
+		const _JSONTape* _tape;
+		uint32_t _keyIndex;
+	};
+
+
+	class JSONValue::MemberRange {
+		friend class JSONValue;
+	public:
+		inline MemberIterator begin() const noexcept;
+		inline MemberIterator end() const noexcept;
+
+	private:
+		inline MemberRange(MemberIterator begin, MemberIterator end) noexcept;
+
+		MemberIterator _begin;
+		MemberIterator _end;
+	};
+
+
+	/// A JSON document that is indexed up front and decoded on demand.
+	/// Parsing checks that the text is valid UTF-8, locates every structural character, and checks that the brackets, keys and separators are well formed.
+	/// Strings and numbers are only decoded and validated when they're accessed, so untouched subtrees cost nothing beyond the index.
+	class JSONDocument {
+	public:
+		explicit JSONDocument(String json);
+		JSONDocument(JSONDocument&&) noexcept;
+		JSONDocument(const JSONDocument&) = delete;
+		~JSONDocument();
+
+		JSONDocument& operator=(JSONDocument&&) noexcept;
+		JSONDocument& operator=(const JSONDocument&) = delete;
+
+		JSONValue root() const;
+		const String& json() const;
+
+	private:
+		std::unique_ptr<_JSONTape> _tape;
+	};
+
+
+	/// Receives the values of a document in order from JSON::parse.
+	/// String views passed to a callback are only valid during that callback.
+	class JSONHandler {
+	public:
+		virtual ~JSONHandler();
+
+		virtual void onNull();
+		virtual void onBool(bool value);
+		/// Called for numbers without a fraction or exponent that fit in an int64_t
+		virtual void onInteger(int64_t value);
+		/// Called for all other numbers
+		virtual void onDouble(double value);
+		virtual void onString(std::string_view value);
+		virtual void onKey(std::string_view key);
+		virtual void onObjectStart();
+		virtual void onObjectEnd();
+		virtual void onArrayStart();
+		virtual void onArrayEnd();
+	};
+
+
+	/// Writes JSON to a sink, such as a String, std::string, or std::ostream
+	class JSONWriter {
+	public:
+		struct Options {
+			/// The number of spaces to indent each nesting level with. 0 writes compact JSON.
+			size_t indent = 0;
+		};
+
+		template<typename Sink>
+		JSONWriter(Sink& sink, const Options& options = Options());
+
+		void beginObject();
+		void endObject();
+		void beginArray();
+		void endArray();
+		void key(std::string_view key);
+
+		void null();
+		inline void value(std::nullptr_t);
+		void value(bool value);
+		template<typename Integer>
+		requires (std::is_integral_v<Integer> && !std::is_same_v<Integer,bool>)
+		void value(Integer value);
+		/// Writes the shortest representation that parses back to the same value. Infinity and NaN are written as null.
+		void value(double value);
+		void value(std::string_view value);
+		inline void value(const char* value);
+		/// Writes text that is already valid JSON
+		void rawValue(std::string_view json);
+
+		/// Writes a value with json_traits
+		template<typename T>
+		inline void write(const T& value);
+
+	private:
+		void beforeValue();
+		void writeNewline();
+		void writeString(std::string_view str);
+
+		StringifyWriter _writer;
+		Options _options;
+		std::vector<bool> _levelIsEmpty;
+		bool _afterKey;
+	};
+
+
+	class JSON {
+	public:
+		/// Indexes the given JSON for on-demand access
+		static JSONDocument parse(String json);
+		/// Parses and validates the whole document, reporting each value to the handler.
+		/// The text is read in place without being copied.
+		static void parse(std::string_view json, JSONHandler& handler);
+
+		/// Parses the given JSON and decodes the root value with json_traits
+		template<typename T>
+		static T decode(String json);
+		/// Encodes a value with json_traits
+		template<typename T>
+		static String encode(const T& value, const JSONWriter::Options& options = JSONWriter::Options());
+		template<typename Sink, typename T>
+		static void encodeTo(Sink& sink, const T& value, const JSONWriter::Options& options = JSONWriter::Options());
+	};
+
+
+
+#pragma mark json_traits
+
+	template<>
+	struct json_traits<std::nullptr_t> {
+		static std::nullptr_t decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, std::nullptr_t);
+	};
+
+	template<>
+	struct json_traits<bool> {
+		static bool decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, bool value);
+	};
+
+	template<typename T>
+	requires (std::is_integral_v<T> && !std::is_same_v<T,bool>)
+	struct json_traits<T> {
+		static T decode(const JSONValue& json) {
+			if constexpr(std::is_unsigned_v<T>) {
+				return integral_cast<T>(json.asUInt64());
+			} else {
+				return integral_cast<T>(json.asInt64());
+			}
+		}
+
+		static void encode(JSONWriter& writer, T value) {
+			writer.value(value);
+		}
+	};
+
+	template<typename T>
+	requires std::is_floating_point_v<T>
+	struct json_traits<T> {
+		static T decode(const JSONValue& json) {
+			return (T)json.asDouble();
+		}
+
+		static void encode(JSONWriter& writer, T value) {
+			writer.value((double)value);
+		}
+	};
+
+	template<>
+	struct json_traits<String> {
+		static String decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, const String& value);
+	};
+
+	template<>
+	struct json_traits<std::string> {
+		static std::string decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, const std::string& value);
+	};
+
+	template<>
+	struct json_traits<Date> {
+		/// Dates are ISO 8601 strings
+		static Date decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, const Date& value);
+	};
+
+	template<>
+	struct json_traits<Any> {
+		static Any decode(const JSONValue& json);
+		static void encode(JSONWriter& writer, const Any& value);
+	};
+
+	/// JSONValue can only be encoded. A decoded JSONValue would refer into the document that JSON::decode destroys before returning,
+	/// so keep the JSONDocument from JSON::parse to hold onto values.
+	template<>
+	struct json_traits<JSONValue> {
+		static void encode(JSONWriter& writer, const JSONValue& value);
+	};
+
+	template<typename T>
+	struct json_traits<Optional<T>> {
+		static Optional<T> decode(const JSONValue& json) {
+			if(json.isNull()) {
+				return std::nullopt;
+			}
+			return json_traits<T>::decode(json);
+		}
+
+		static void encode(JSONWriter& writer, const Optional<T>& value) {
+			if(!value) {
+				writer.null();
+				return;
+			}
+			json_traits<T>::encode(writer, value.value());
+		}
+	};
+
+	template<typename ListType>
+	struct _json_list_traits {
+		static ListType decode(const JSONValue& json) {
+			using T = typename ListType::value_type;
+			ListType list;
+			for(auto item : json) {
+				list.push_back(json_traits<T>::decode(item));
+			}
+			return list;
+		}
+
+		static void encode(JSONWriter& writer, const ListType& list) {
+			writer.beginArray();
+			for(auto& item : list) {
+				writer.write(item);
+			}
+			writer.endArray();
+		}
+	};
+
+	template<typename T, typename Allocator>
+	struct json_traits<ArrayList<T,Allocator>>: _json_list_traits<ArrayList<T,Allocator>> {};
+	template<typename T, typename Allocator>
+	struct json_traits<LinkedList<T,Allocator>>: _json_list_traits<LinkedList<T,Allocator>> {};
+	template<typename T, typename Allocator>
+	struct json_traits<std::vector<T,Allocator>>: _json_list_traits<std::vector<T,Allocator>> {};
+
+	template<typename MapType>
+	struct _json_map_traits {
+		static MapType decode(const JSONValue& json) {
+			using T = typename MapType::mapped_type;
+			MapType map;
+			for(auto member : json.members()) {
+				map.insert_or_assign(member.key(), json_traits<T>::decode(member.value()));
+			}
+			return map;
+		}
+
+		static void encode(JSONWriter& writer, const MapType& map) {
+			writer.beginObject();
+			for(auto& pair : map) {
+				writer.key(pair.first);
+				writer.write(pair.second);
+			}
+			writer.endObject();
+		}
+	};
+
+	template<typename T, typename Compare, typename Allocator>
+	struct json_traits<Map<String,T,Compare,Allocator>>: _json_map_traits<Map<String,T,Compare,Allocator>> {};
+	template<typename T, typename Compare, typename Allocator>
+	struct json_traits<std::map<String,T,Compare,Allocator>>: _json_map_traits<std::map<String,T,Compare,Allocator>> {};
+
+
+
+#pragma mark JSONValue implementation
+
+	JSONValue::JSONValue(const _JSONTape* tape, uint32_t index) noexcept
+	: _tape(tape), _index(index) {
+		//
+	}
+
+	bool JSONValue::isNull() const {
+		return type() == JSONType::Null;
+	}
+
+	bool JSONValue::isBool() const {
+		return type() == JSONType::Boolean;
+	}
+
+	bool JSONValue::isNumber() const {
+		return type() == JSONType::Number;
+	}
+
+	bool JSONValue::isString() const {
+		return type() == JSONType::String;
+	}
+
+	bool JSONValue::isArray() const {
+		return type() == JSONType::Array;
+	}
+
+	bool JSONValue::isObject() const {
+		return type() == JSONType::Object;
+	}
+
+	template<typename T>
+	T JSONValue::as() const {
+		return json_traits<T>::decode(*this);
+	}
+
+	JSONValue JSONValue::operator[](size_t index) const {
+		return at(index);
+	}
+
+	JSONValue JSONValue::operator[](std::string_view key) const {
+		return at(key);
+	}
+
+	bool JSONValue::contains(std::string_view key) const {
+		return maybeAt(key).has_value();
+	}
+
+
+
+	JSONValue::Iterator::Iterator() noexcept
+	: _tape(nullptr), _index(0) {
+		//
+	}
+
+	JSONValue::Iterator::Iterator(const _JSONTape* tape, uint32_t index) noexcept
+	: _tape(tape), _index(index) {
+		//
+	}
+
+	JSONValue JSONValue::Iterator::operator*() const {
+		return JSONValue(_tape, _index);
+	}
+
+	JSONValue::Iterator JSONValue::Iterator::operator++(int) {
+		auto copy = *this;
+		++(*this);
+		return copy;
+	}
+
+	bool JSONValue::Iterator::operator==(const Iterator& it) const noexcept {
+		return _index == it._index;
+	}
+
+	bool JSONValue::Iterator::operator!=(const Iterator& it) const noexcept {
+		return _index != it._index;
+	}
+
+
+
+	JSONValue::Member::Member(const _JSONTape* tape, uint32_t keyIndex) noexcept
+	: _tape(tape), _keyIndex(keyIndex) {
+		//
+	}
+
+	JSONValue JSONValue::Member::keyValue() const {
+		return JSONValue(_tape, _keyIndex);
+	}
+
+	JSONValue JSONValue::Member::value() const {
+		// the key is followed by a colon and then the value
+		return JSONValue(_tape, _keyIndex + 2);
+	}
+
+
+
+	JSONValue::MemberIterator::MemberIterator() noexcept
+	: _tape(nullptr), _keyIndex(0) {
+		//
+	}
+
+	JSONValue::MemberIterator::MemberIterator(const _JSONTape* tape, uint32_t keyIndex) noexcept
+	: _tape(tape), _keyIndex(keyIndex) {
+		//
+	}
+
+	JSONValue::Member JSONValue::MemberIterator::operator*() const {
+		return Member(_tape, _keyIndex);
+	}
+
+	JSONValue::MemberIterator JSONValue::MemberIterator::operator++(int) {
+		auto copy = *this;
+		++(*this);
+		return copy;
+	}
+
+	bool JSONValue::MemberIterator::operator==(const MemberIterator& it) const noexcept {
+		return _keyIndex == it._keyIndex;
+	}
+
+	bool JSONValue::MemberIterator::operator!=(const MemberIterator& it) const noexcept {
+		return _keyIndex != it._keyIndex;
+	}
+
+
+
+	JSONValue::MemberRange::MemberRange(MemberIterator begin, MemberIterator end) noexcept
+	: _begin(begin), _end(end) {
+		//
+	}
+
+	JSONValue::MemberIterator JSONValue::MemberRange::begin() const noexcept {
+		return _begin;
+	}
+
+	JSONValue::MemberIterator JSONValue::MemberRange::end() const noexcept {
+		return _end;
+	}
+
+
+
+#pragma mark JSONWriter implementation
+
+	template<typename Sink>
+	JSONWriter::JSONWriter(Sink& sink, const Options& options)
+	: _writer(sink), _options(options), _afterKey(false) {
+		//
+	}
+
+	void JSONWriter::value(std::nullptr_t) {
+		null();
+	}
+
+	template<typename Integer>
+	requires (std::is_integral_v<Integer> && !std::is_same_v<Integer,bool>)
+	void JSONWriter::value(Integer value) {
+		beforeValue();
+		_writer.writeInteger(value);
+	}
+
+	void JSONWriter::value(const char* value) {
+		this->value(std::string_view(value));
+	}
+
+	template<typename T>
+	void JSONWriter::write(const T& value) {
+		json_traits<std::remove_cvref_t<T>>::encode(*this, value);
+	}
+
+
+
+#pragma mark JSON implementation
+
+	template<typename T>
+	T JSON::decode(String json) {
+		JSONDocument document(std::move(json));
+		return json_traits<T>::decode(document.root());
+	}
+
+	template<typename T>
+	String JSON::encode(const T& value, const JSONWriter::Options& options) {
+		String json;
+		encodeTo(json, value, options);
+		return json;
+	}
+
+	template<typename Sink, typename T>
+	void JSON::encodeTo(Sink& sink, const T& value, const JSONWriter::Options& options) {
+		JSONWriter writer(sink, options);
+		writer.write(value);
+	}
+}
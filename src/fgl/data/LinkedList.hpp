@@ -11,16 +11,18 @@
 #include <fgl/data/Common.hpp>
 #include <fgl/data/BasicList.hpp>
 #include <fgl/data/BasicString.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/NodePool.hpp>
 #include <fgl/data/Stringify.hpp>
 #include <fgl/data/Traits.hpp>
 #include <initializer_list>
 #include <list>
 
 namespace fgl {
-	template<typename T>
-	class LinkedList: public BasicList<std::list<T>> {
+	template<typename T, typename Allocator>
+	class LinkedList: public BasicList<std::list<T,Allocator>> {
 	public:
-		using BaseType = std::list<T>;
+		using BaseType = std::list<T,Allocator>;
 		using typename BasicList<BaseType>::ValueType;
 		
 		using typename BasicList<BaseType>::value_type;
@@ -68,6 +70,7 @@ namespace fgl {
 		using BaseType::clear;
 		using BaseType::splice;
 		using BaseType::sort;
+		using BaseType::get_allocator;
 		
 		static constexpr size_type npos = (size_type)-1;
 		
@@ -89,32 +92,32 @@ namespace fgl {
 		LinkedList& operator=(const BaseType&);
 		LinkedList& operator=(BaseType&&);
 		
-		LinkedList<T> slice(size_type offset, size_type count = npos) const;
+		LinkedList slice(size_type offset, size_type count = npos) const;
 		
-		inline iterator insert(const_iterator pos, const std::list<T>& list);
-		inline iterator insert(const_iterator pos, std::list<T>&& list);
+		inline iterator insert(const_iterator pos, const BaseType& list);
+		inline iterator insert(const_iterator pos, BaseType&& list);
 		
 		inline void pushFront(const T& value);
 		inline void pushFront(T&& value);
-		inline void pushFrontList(const std::list<T>& list);
-		inline void pushFrontList(std::list<T>&& list);
+		inline void pushFrontList(const BaseType& list);
+		inline void pushFrontList(BaseType&& list);
 		template<typename Collection, typename = IsCollectionOf<T,std::remove_reference_t<Collection>>>
 		inline void pushFrontList(Collection&& collection);
 		inline void popFront();
 		inline T extractFront();
-		inline LinkedList<T> extractListFront(size_t count = 1);
-		inline LinkedList<T> extractListFront(const_iterator end);
+		inline LinkedList extractListFront(size_t count = 1);
+		inline LinkedList extractListFront(const_iterator end);
 		
 		inline void pushBack(const T& value);
 		inline void pushBack(T&& value);
-		inline void pushBackList(const std::list<T>& list);
-		inline void pushBackList(std::list<T>&& list);
+		inline void pushBackList(const BaseType& list);
+		inline void pushBackList(BaseType&& list);
 		template<typename Collection, typename = IsCollectionOf<T,std::remove_reference_t<Collection>>>
 		inline void pushBackList(Collection&& list);
 		inline void popBack();
 		inline T extractBack();
-		inline LinkedList<T> extractListBack(size_t count = 1);
-		inline LinkedList<T> extractListBack(const_iterator start);
+		inline LinkedList extractListBack(size_t count = 1);
+		inline LinkedList extractListBack(const_iterator start);
 		
 		size_type removeEqual(const T& value);
 		inline bool removeFirstEqual(const T& value);
@@ -127,7 +130,7 @@ namespace fgl {
 		inline bool removeLastWhere(Predicate predicate);
 
 		template<typename Predicate>
-		inline LinkedList<T> where(Predicate predicate) const;
+		inline LinkedList where(Predicate predicate) const;
 		
 		template<typename Transform>
 		inline auto map(Transform transform);
@@ -135,36 +138,37 @@ namespace fgl {
 		inline auto map(Transform transform) const;
 		
 		String toString() const;
+		void toString(StringifyWriter& writer) const;
 	};
 
-	template<typename T, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
-	LinkedList<T> operator+(const LinkedList<T>& left, Collection&& right);
-	template<typename T, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
-	LinkedList<T> operator+(LinkedList<T>&& left, Collection&& right);
-	template<typename T>
-	LinkedList<T> operator+(LinkedList<T>&& left, std::list<T>&& right);
-	template<typename T>
-	LinkedList<T> operator+(const LinkedList<T>& left, std::list<T>&& right);
-	template<typename T>
-	LinkedList<T> operator+(LinkedList<T>&& left, const std::list<T>& right);
+	template<typename T, typename A, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	LinkedList<T,A> operator+(const LinkedList<T,A>& left, Collection&& right);
+	template<typename T, typename A, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, Collection&& right);
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, std::list<T,A>&& right);
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(const LinkedList<T,A>& left, std::list<T,A>&& right);
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, const std::list<T,A>& right);
 	
 	
 	
 #pragma mark LinkedList implementation
 
-	template<typename T>
-	LinkedList<T>::LinkedList(const BaseType& list): BasicList<BaseType>(list) {
+	template<typename T, typename A>
+	LinkedList<T,A>::LinkedList(const BaseType& list): BasicList<BaseType>(list) {
 		//
 	}
 
-	template<typename T>
-	LinkedList<T>::LinkedList(BaseType&& list): BasicList<BaseType>(list) {
+	template<typename T, typename A>
+	LinkedList<T,A>::LinkedList(BaseType&& list): BasicList<BaseType>(list) {
 		//
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename Transform, typename _>
-	LinkedList<T>::LinkedList(Collection&& collection, Transform transform) {
+	LinkedList<T,A>::LinkedList(Collection&& collection, Transform transform) {
 		if constexpr(std::is_reference_v<decltype(*collection.begin())>) {
 			for(auto& item : collection) {
 				pushBack(transform(item));
@@ -178,9 +182,9 @@ namespace fgl {
 
 	#ifdef __OBJC__
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	LinkedList<T>::LinkedList(NSArray* objcArray, Transform transform) {
+	LinkedList<T,A>::LinkedList(NSArray* objcArray, Transform transform) {
 		for(NSObject* obj in objcArray) {
 			pushBack(transform(obj));
 		}
@@ -190,9 +194,9 @@ namespace fgl {
 
 	#ifdef JNIEXPORT
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	LinkedList<T>::LinkedList(JNIEnv* env, jobjectArray javaArray, Transform transform) {
+	LinkedList<T,A>::LinkedList(JNIEnv* env, jobjectArray javaArray, Transform transform) {
 		jsize javaArraySize = env->GetArrayLength(javaArray);
 		for(jsize i=0; i<javaArraySize; i++) {
 			pushBack(transform(env, env->GetObjectArrayElement(javaArray, i)));
@@ -203,24 +207,24 @@ namespace fgl {
 
 
 
-	template<typename T>
-	LinkedList<T>& LinkedList<T>::operator=(const BaseType& list) {
+	template<typename T, typename A>
+	LinkedList<T,A>& LinkedList<T,A>::operator=(const BaseType& list) {
 		BaseType::operator=(list);
 		return *this;
 	}
 
-	template<typename T>
-	LinkedList<T>& LinkedList<T>::operator=(BaseType&& list) {
+	template<typename T, typename A>
+	LinkedList<T,A>& LinkedList<T,A>::operator=(BaseType&& list) {
 		BaseType::operator=(list);
 		return *this;
 	}
 
 
 
-	template<typename T>
-	LinkedList<T> LinkedList<T>::slice(size_type offset, size_type count) const {
+	template<typename T, typename A>
+	LinkedList<T,A> LinkedList<T,A>::slice(size_type offset, size_type count) const {
 		if(offset >= size()) {
-			return LinkedList<T>();
+			return LinkedList<T,A>(get_allocator());
 		}
 		const_iterator it;
 		size_t offsetFromEnd = (size() - offset);
@@ -230,7 +234,7 @@ namespace fgl {
 			it = std::prev(end(), offsetFromEnd);
 		}
 		auto endIt = end();
-		LinkedList<T> sublist;
+		LinkedList<T,A> sublist(get_allocator());
 		while(it != endIt && sublist.size() < count) {
 			sublist.pushBack(*it);
 			it++;
@@ -240,13 +244,13 @@ namespace fgl {
 
 
 
-	template<typename T>
-	typename LinkedList<T>::iterator LinkedList<T>::insert(const_iterator pos, const std::list<T>& list) {
+	template<typename T, typename A>
+	typename LinkedList<T,A>::iterator LinkedList<T,A>::insert(const_iterator pos, const BaseType& list) {
 		return insert(pos, list.begin(), list.end());
 	}
 	
-	template<typename T>
-	typename LinkedList<T>::iterator LinkedList<T>::insert(const_iterator pos, std::list<T>&& list) {
+	template<typename T, typename A>
+	typename LinkedList<T,A>::iterator LinkedList<T,A>::insert(const_iterator pos, BaseType&& list) {
 		auto it = list.begin();
 		splice(pos, list);
 		return it;
@@ -254,49 +258,49 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
-	void LinkedList<T>::pushFront(const T& value) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushFront(const T& value) {
 		push_front(value);
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushFront(T&& value) {
-		push_front(value);
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushFront(T&& value) {
+		push_front(std::move(value));
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushFrontList(const std::list<T>& list) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushFrontList(const BaseType& list) {
 		insert(begin(), list.begin(), list.end());
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushFrontList(std::list<T>&& list) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushFrontList(BaseType&& list) {
 		splice(begin(), list);
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename _>
-	void LinkedList<T>::pushFrontList(Collection&& list) {
+	void LinkedList<T,A>::pushFrontList(Collection&& list) {
 		insert(end(), list.begin(), list.end());
 	}
 	
-	template<typename T>
-	void LinkedList<T>::popFront() {
+	template<typename T, typename A>
+	void LinkedList<T,A>::popFront() {
 		FGL_ASSERT(size() > 0, "cannot call popFront on empty array");
 		pop_front();
 	}
 
-	template<typename T>
-	T LinkedList<T>::extractFront() {
+	template<typename T, typename A>
+	T LinkedList<T,A>::extractFront() {
 		FGL_ASSERT(size() > 0, "cannot call extractFront on empty array");
 		auto value = std::move(front());
 		pop_front();
 		return value;
 	}
 
-	template<typename T>
-	LinkedList<T> LinkedList<T>::extractListFront(size_t count) {
-		LinkedList<T> extracted;
+	template<typename T, typename A>
+	LinkedList<T,A> LinkedList<T,A>::extractListFront(size_t count) {
+		LinkedList<T,A> extracted(get_allocator());
 		while(extracted.size() < count && size() > 0) {
 			auto value = std::move(front());
 			pop_front();
@@ -305,9 +309,9 @@ namespace fgl {
 		return extracted;
 	}
 
-	template<typename T>
-	LinkedList<T> LinkedList<T>::extractListFront(const_iterator end) {
-		LinkedList<T> extracted;
+	template<typename T, typename A>
+	LinkedList<T,A> LinkedList<T,A>::extractListFront(const_iterator end) {
+		LinkedList<T,A> extracted(get_allocator());
 		while(begin() != end && size() > 0) {
 			auto value = std::move(front());
 			pop_front();
@@ -318,49 +322,49 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
-	void LinkedList<T>::pushBack(const T& value) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushBack(const T& value) {
 		push_back(value);
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushBack(T&& value) {
-		push_back(value);
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushBack(T&& value) {
+		push_back(std::move(value));
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushBackList(const std::list<T>& list) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushBackList(const BaseType& list) {
 		insert(end(), list.begin(), list.end());
 	}
 	
-	template<typename T>
-	void LinkedList<T>::pushBackList(std::list<T>&& list) {
+	template<typename T, typename A>
+	void LinkedList<T,A>::pushBackList(BaseType&& list) {
 		splice(end(), list);
 	}
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Collection, typename _>
-	void LinkedList<T>::pushBackList(Collection&& list) {
+	void LinkedList<T,A>::pushBackList(Collection&& list) {
 		insert(end(), list.begin(), list.end());
 	}
 	
-	template<typename T>
-	void LinkedList<T>::popBack() {
+	template<typename T, typename A>
+	void LinkedList<T,A>::popBack() {
 		FGL_ASSERT(size() > 0, "cannot call popBack on empty array");
 		pop_back();
 	}
 	
-	template<typename T>
-	T LinkedList<T>::extractBack() {
+	template<typename T, typename A>
+	T LinkedList<T,A>::extractBack() {
 		FGL_ASSERT(size() > 0, "cannot call extractBack on empty array");
 		auto value = std::move(back());
 		pop_back();
 		return value;
 	}
 
-	template<typename T>
-	LinkedList<T> LinkedList<T>::extractListBack(size_t count) {
-		LinkedList<T> extracted;
+	template<typename T, typename A>
+	LinkedList<T,A> LinkedList<T,A>::extractListBack(size_t count) {
+		LinkedList<T,A> extracted(get_allocator());
 		while(extracted.size() < count && size() > 0) {
 			auto value = std::move(back());
 			pop_back();
@@ -369,9 +373,9 @@ namespace fgl {
 		return extracted;
 	}
 
-	template<typename T>
-	LinkedList<T> LinkedList<T>::extractListBack(const_iterator start) {
-		LinkedList<T> extracted;
+	template<typename T, typename A>
+	LinkedList<T,A> LinkedList<T,A>::extractListBack(const_iterator start) {
+		LinkedList<T,A> extracted(get_allocator());
 		while(size() > 0) {
 			bool lastItem = (std::prev(end(), 1) == start);
 			auto value = std::move(back());
@@ -386,8 +390,8 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
-	typename LinkedList<T>::size_type LinkedList<T>::removeEqual(const T& value) {
+	template<typename T, typename A>
+	typename LinkedList<T,A>::size_type LinkedList<T,A>::removeEqual(const T& value) {
 		size_type count = 0;
 		auto last = end();
 		auto firstDelete = last;
@@ -408,8 +412,8 @@ namespace fgl {
 		return count;
 	}
 	
-	template<typename T>
-	bool LinkedList<T>::removeFirstEqual(const T& value) {
+	template<typename T, typename A>
+	bool LinkedList<T,A>::removeFirstEqual(const T& value) {
 		auto it = findEqual(value);
 		if(it == end()) {
 			return false;
@@ -418,8 +422,8 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename T>
-	bool LinkedList<T>::removeLastEqual(const T& value) {
+	template<typename T, typename A>
+	bool LinkedList<T,A>::removeLastEqual(const T& value) {
 		auto it = findLastEqual(value);
 		if(it == end()) {
 			return false;
@@ -428,9 +432,9 @@ namespace fgl {
 		return true;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	typename LinkedList<T>::size_type LinkedList<T>::removeWhere(Predicate predicate) {
+	typename LinkedList<T,A>::size_type LinkedList<T,A>::removeWhere(Predicate predicate) {
 		size_type count = 0;
 		auto last = end();
 		auto firstDelete = last;
@@ -443,6 +447,7 @@ namespace fgl {
 			}
 			else if(firstDelete != last) {
 				erase(firstDelete, it);
+				firstDelete = last;
 			}
 		}
 		if(firstDelete != last) {
@@ -451,9 +456,9 @@ namespace fgl {
 		return count;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	bool LinkedList<T>::removeFirstWhere(Predicate predicate) {
+	bool LinkedList<T,A>::removeFirstWhere(Predicate predicate) {
 		auto last = end();
 		for(auto it=begin(); it!=last; it++) {
 			if(predicate(*it)) {
@@ -464,9 +469,9 @@ namespace fgl {
 		return false;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	bool LinkedList<T>::removeLastWhere(Predicate predicate) {
+	bool LinkedList<T,A>::removeLastWhere(Predicate predicate) {
 		auto last = rend();
 		for(auto it=rbegin(); it!=last; it++) {
 			if(predicate(*it)) {
@@ -479,10 +484,10 @@ namespace fgl {
 
 
 
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Predicate>
-	LinkedList<T> LinkedList<T>::where(Predicate predicate) const {
-		LinkedList<T> newList;
+	LinkedList<T,A> LinkedList<T,A>::where(Predicate predicate) const {
+		LinkedList<T,A> newList(get_allocator());
 		for(const_reference item : *this) {
 			if(predicate(item)) {
 				newList.pushBack(item);
@@ -493,22 +498,26 @@ namespace fgl {
 	
 	
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	auto LinkedList<T>::map(Transform transform) {
+	auto LinkedList<T,A>::map(Transform transform) {
 		using ReturnType = decltype(transform(front()));
-		LinkedList<ReturnType> newList;
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		LinkedList<ReturnType,ReturnAllocator> newList(allocator);
 		for(reference item : *this) {
 			newList.pushBack(transform(item));
 		}
 		return newList;
 	}
 	
-	template<typename T>
+	template<typename T, typename A>
 	template<typename Transform>
-	auto LinkedList<T>::map(Transform transform) const {
+	auto LinkedList<T,A>::map(Transform transform) const {
 		using ReturnType = decltype(transform(front()));
-		LinkedList<ReturnType> newList;
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		LinkedList<ReturnType,ReturnAllocator> newList(allocator);
 		for(const_reference item : *this) {
 			newList.pushBack(transform(item));
 		}
@@ -517,54 +526,70 @@ namespace fgl {
 
 
 
-	template<typename T>
-	String LinkedList<T>::toString() const {
+	template<typename T, typename A>
+	String LinkedList<T,A>::toString() const {
+		String str;
+		StringifyWriter writer(str);
+		toString(writer);
+		return str;
+	}
+
+	template<typename T, typename A>
+	void LinkedList<T,A>::toString(StringifyWriter& writer) const {
+		writer.write("LinkedList<");
+		writer.write(stringify_type<T>());
 		if(size() == 0) {
-			return String::join({"LinkedList<", stringify_type<T>(), ">[]"});
+			writer.write(">[]");
+			return;
 		}
-		return String::join({
-			"LinkedList<", stringify_type<T>(), ">[\n\t",
-			String::join(map([](const_reference item) -> String {
-				return stringify<T>(item);
-			}), ",\n\t"), "\n]" });
+		writer.writeItems(begin(), end(), ">[\n\t", ",\n\t", "\n]", [&](const_reference item) {
+			stringifyTo<T>(writer, item);
+		});
 	}
 
 
 
-	template<typename T, typename Collection, typename _>
-	LinkedList<T> operator+(const LinkedList<T>& left, Collection&& right) {
-		LinkedList<T> newList;
+	template<typename T, typename A, typename Collection, typename _>
+	LinkedList<T,A> operator+(const LinkedList<T,A>& left, Collection&& right) {
+		LinkedList<T,A> newList(left.get_allocator());
 		newList.pushBackList(left);
 		newList.pushBackList(std::forward<Collection>(right));
 		return newList;
 	}
 
-	template<typename T, typename Collection, typename _>
-	LinkedList<T> operator+(LinkedList<T>&& left, Collection&& right) {
+	template<typename T, typename A, typename Collection, typename _>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, Collection&& right) {
 		auto newList = std::move(left);
 		newList.pushBackList(std::forward<Collection>(right));
 		return newList;
 	}
 
-	template<typename T>
-	LinkedList<T> operator+(LinkedList<T>&& left, std::list<T>&& right) {
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, std::list<T,A>&& right) {
 		auto newList = std::move(left);
 		newList.splice(newList.end(), right);
 		return newList;
 	}
 
-	template<typename T>
-	LinkedList<T> operator+(const LinkedList<T>& left, std::list<T>&& right) {
-		LinkedList<T> newList;
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(const LinkedList<T,A>& left, std::list<T,A>&& right) {
+		LinkedList<T,A> newList(left.get_allocator());
 		newList.pushBackList(left);
 		newList.splice(newList.end(), right);
 		return newList;
 	}
 
-	template<typename T>
-	LinkedList<T> operator+(LinkedList<T>&& left, const std::list<T>& right) {
+	template<typename T, typename A>
+	LinkedList<T,A> operator+(LinkedList<T,A>&& left, const std::list<T,A>& right) {
 		auto newList = std::move(left);
 		newList.pushBackList(right);
 		return newList;
 	}
+
+
+
+	namespace pmr {
+		template<typename T>
+		using LinkedList = fgl::LinkedList<T,PolymorphicAllocator<T>>;
+	}
 }
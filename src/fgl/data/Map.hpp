@@ -10,11 +10,13 @@
 
 #include <fgl/data/Common.hpp>
 #include <fgl/data/BasicList.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/NodePool.hpp>
 #include <fgl/data/Optional.hpp>
 #include <map>
 
 namespace fgl {
-	template<typename Key, typename T, typename Compare = typename std::map<Key,T>::key_compare, typename Allocator = typename std::map<Key,T,Compare>::allocator_type>
+	template<typename Key, typename T, typename Compare = typename std::map<Key,T>::key_compare, typename Allocator = DefaultNodeAllocator<std::pair<const Key,T>>>
 	class Map: public std::map<Key,T,Compare,Allocator> {
 	public:
 		using BaseType = std::map<Key,T,Compare,Allocator>;
@@ -250,7 +252,7 @@ namespace fgl {
 	template<typename K,typename T,typename C,typename A>
 	template<typename M>
 	typename Map<K,T,C,A>::iterator Map<K,T,C,A>::put(K&& k, M&& obj) {
-		return BaseType::template insert_or_assign<M>(k,std::forward<M>(obj)).first;
+		return BaseType::template insert_or_assign<M>(std::move(k),std::forward<M>(obj)).first;
 	}
 
 
@@ -259,8 +261,9 @@ namespace fgl {
 	template<typename Mapper>
 	auto Map<K,T,C,A>::mapValues(Mapper mapper) const {
 		using MappedType = decltype(mapper(begin()->first, begin()->second));
-		using NewMap = Map<K,MappedType>;
-		NewMap newMap;
+		using NewMap = Map<K,MappedType,C,rebind_node_allocator_t<A,std::pair<const K,MappedType>>>;
+		typename NewMap::allocator_type allocator(BaseType::get_allocator());
+		NewMap newMap(BaseType::key_comp(), allocator);
 		auto it = newMap.end();
 		for(auto& pair : *this) {
 			it = newMap.insert(it, std::pair<K,MappedType>(pair.first, mapper(pair.first, pair.second)));
@@ -273,8 +276,11 @@ namespace fgl {
 	template<typename Mapper>
 	auto Map<K,T,C,A>::map(Mapper mapper) const {
 		using PairType = decltype(mapper(*begin()));
-		using NewMap = Map<typename PairType::first_type, typename PairType::second_type>;
-		NewMap newMap;
+		using NewKey = typename PairType::first_type;
+		using NewValue = typename PairType::second_type;
+		using NewMap = Map<NewKey,NewValue,typename std::map<NewKey,NewValue>::key_compare,rebind_node_allocator_t<A,std::pair<const NewKey,NewValue>>>;
+		typename NewMap::allocator_type allocator(BaseType::get_allocator());
+		NewMap newMap(allocator);
 		auto it = newMap.end();
 		for(auto& pair : *this) {
 			it = newMap.insert(it, mapper(pair));
@@ -300,4 +306,11 @@ namespace fgl {
 		}
 		return map;
 	}
+
+
+
+	namespace pmr {
+		template<typename Key, typename T, typename Compare = typename std::map<Key,T>::key_compare>
+		using Map = fgl::Map<Key,T,Compare,PolymorphicAllocator<std::pair<const Key,T>>>;
+	}
 }
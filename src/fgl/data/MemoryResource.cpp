@@ -0,0 +1,52 @@
+//
+//  MemoryResource.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/MemoryResource.hpp>
+#include <new>
+
+namespace fgl {
+	namespace {
+		class NewDeleteResource: public MemoryResource {
+		protected:
+			virtual void* doAllocate(size_t size, size_t alignment) override {
+				if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+					return ::operator new(size, std::align_val_t(alignment));
+				}
+				return ::operator new(size);
+			}
+
+			virtual void doDeallocate(void* ptr, size_t, size_t alignment) noexcept override {
+				if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+					::operator delete(ptr, std::align_val_t(alignment));
+					return;
+				}
+				::operator delete(ptr);
+			}
+		};
+
+		MemoryResource* newDeleteResourceInstance() noexcept {
+			// leaked so that it can be used during static destruction
+			static NewDeleteResource* resource = new NewDeleteResource();
+			return resource;
+		}
+	}
+
+
+
+	MemoryResource::~MemoryResource() {
+		//
+	}
+
+	bool MemoryResource::doIsEqual(const MemoryResource& resource) const noexcept {
+		return this == &resource;
+	}
+
+	MemoryResource* MemoryResource::newDeleteResource() noexcept {
+		return newDeleteResourceInstance();
+	}
+}
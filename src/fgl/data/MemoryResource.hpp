@@ -0,0 +1,131 @@
+//
+//  MemoryResource.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <cstddef>
+#include <memory>
+
+namespace fgl {
+	/// An abstract source of memory that an allocator can be bound to at runtime.
+	/// This mirrors std::pmr::memory_resource, which isn't available on every platform this library targets.
+	class MemoryResource {
+	public:
+		virtual ~MemoryResource();
+
+		inline void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+		inline void deallocate(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept;
+		inline bool isEqual(const MemoryResource& resource) const noexcept;
+
+		/// A resource that allocates with the global operator new. Default-constructed allocators use this resource.
+		static MemoryResource* newDeleteResource() noexcept;
+
+	protected:
+		virtual void* doAllocate(size_t size, size_t alignment) = 0;
+		virtual void doDeallocate(void* ptr, size_t size, size_t alignment) noexcept = 0;
+		virtual bool doIsEqual(const MemoryResource& resource) const noexcept;
+	};
+
+
+	namespace pmr {
+		/// A standard allocator that allocates from a MemoryResource.
+		/// A default-constructed allocator uses MemoryResource::newDeleteResource, and a copied container stays on the resource of the original.
+		template<typename T>
+		class PolymorphicAllocator {
+			template<typename U>
+			friend class PolymorphicAllocator;
+		public:
+			using value_type = T;
+
+			inline PolymorphicAllocator() noexcept;
+			inline PolymorphicAllocator(MemoryResource* resource) noexcept;
+			template<typename U>
+			inline PolymorphicAllocator(const PolymorphicAllocator<U>& allocator) noexcept;
+
+			inline T* allocate(size_t count);
+			inline void deallocate(T* ptr, size_t count) noexcept;
+
+			inline MemoryResource* resource() const noexcept;
+
+			template<typename U>
+			inline bool operator==(const PolymorphicAllocator<U>& allocator) const noexcept;
+			template<typename U>
+			inline bool operator!=(const PolymorphicAllocator<U>& allocator) const noexcept;
+
+		private:
+			MemoryResource* _resource;
+		};
+	}
+
+
+
+	#pragma mark MemoryResource implementation
+
+	void* MemoryResource::allocate(size_t size, size_t alignment) {
+		return doAllocate(size, alignment);
+	}
+
+	void MemoryResource::deallocate(void* ptr, size_t size, size_t alignment) noexcept {
+		doDeallocate(ptr, size, alignment);
+	}
+
+	bool MemoryResource::isEqual(const MemoryResource& resource) const noexcept {
+		return this == &resource || doIsEqual(resource);
+	}
+
+
+
+	#pragma mark PolymorphicAllocator implementation
+
+	template<typename T>
+	pmr::PolymorphicAllocator<T>::PolymorphicAllocator() noexcept
+	: _resource(MemoryResource::newDeleteResource()) {
+		//
+	}
+
+	template<typename T>
+	pmr::PolymorphicAllocator<T>::PolymorphicAllocator(MemoryResource* resource) noexcept
+	: _resource(resource) {
+		//
+	}
+
+	template<typename T>
+	template<typename U>
+	pmr::PolymorphicAllocator<T>::PolymorphicAllocator(const PolymorphicAllocator<U>& allocator) noexcept
+	: _resource(allocator._resource) {
+		//
+	}
+
+	template<typename T>
+	T* pmr::PolymorphicAllocator<T>::allocate(size_t count) {
+		return static_cast<T*>(_resource->allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	template<typename T>
+	void pmr::PolymorphicAllocator<T>::deallocate(T* ptr, size_t count) noexcept {
+		_resource->deallocate(ptr, sizeof(T) * count, alignof(T));
+	}
+
+	template<typename T>
+	MemoryResource* pmr::PolymorphicAllocator<T>::resource() const noexcept {
+		return _resource;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool pmr::PolymorphicAllocator<T>::operator==(const PolymorphicAllocator<U>& allocator) const noexcept {
+		return _resource->isEqual(*allocator._resource);
+	}
+
+	template<typename T>
+	template<typename U>
+	bool pmr::PolymorphicAllocator<T>::operator!=(const PolymorphicAllocator<U>& allocator) const noexcept {
+		return !_resource->isEqual(*allocator._resource);
+	}
+}
@@ -0,0 +1,139 @@
+//
+//  NodePool.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/NodePool.hpp>
+#include <mutex>
+
+namespace fgl {
+	namespace {
+		constexpr size_t TRANSFER_BATCH_SIZE = 32;
+		constexpr size_t MAX_CACHED_NODES = TRANSFER_BATCH_SIZE * 4;
+		constexpr size_t SLAB_SIZE = 64 * 1024;
+		
+		struct FreeNode {
+			FreeNode* next;
+		};
+		
+		struct FreeList {
+			FreeNode* head = nullptr;
+			size_t count = 0;
+			
+			inline void push(FreeNode* node) {
+				node->next = head;
+				head = node;
+				count++;
+			}
+			
+			inline FreeNode* pop() {
+				FreeNode* node = head;
+				head = node->next;
+				count--;
+				return node;
+			}
+			
+			// moves up to `count` nodes from this list onto another list
+			inline void transfer(FreeList& list, size_t count) {
+				while(count > 0 && head != nullptr) {
+					list.push(pop());
+					count--;
+				}
+			}
+		};
+		
+		struct CentralFreeList {
+			std::mutex mutex;
+			FreeList list;
+		};
+		
+		// intentionally leaked, so that threads exiting during static destruction can still return their nodes
+		CentralFreeList* centralFreeLists() {
+			static CentralFreeList* lists = new CentralFreeList[NodePool::SIZE_CLASS_COUNT];
+			return lists;
+		}
+		
+		inline size_t sizeClassIndex(size_t size) {
+			return (size - 1) / NodePool::SIZE_CLASS_STEP;
+		}
+		
+		inline size_t sizeClassNodeSize(size_t index) {
+			return (index + 1) * NodePool::SIZE_CLASS_STEP;
+		}
+		
+		void refill(FreeList& list, size_t index) {
+			auto& central = centralFreeLists()[index];
+			{
+				std::lock_guard<std::mutex> lock(central.mutex);
+				central.list.transfer(list, TRANSFER_BATCH_SIZE);
+			}
+			if(list.head != nullptr) {
+				return;
+			}
+			size_t nodeSize = sizeClassNodeSize(index);
+			char* slab = static_cast<char*>(::operator new(SLAB_SIZE));
+			for(size_t offset = 0; (offset + nodeSize) <= SLAB_SIZE; offset += nodeSize) {
+				list.push(reinterpret_cast<FreeNode*>(slab + offset));
+			}
+		}
+		
+		void drain(FreeList& list, size_t index, size_t count) {
+			auto& central = centralFreeLists()[index];
+			std::lock_guard<std::mutex> lock(central.mutex);
+			list.transfer(central.list, count);
+		}
+		
+		struct ThreadCache {
+			FreeList lists[NodePool::SIZE_CLASS_COUNT];
+			
+			~ThreadCache();
+		};
+		
+		thread_local bool threadCacheDestroyed = false;
+		thread_local ThreadCache threadCache;
+		
+		ThreadCache::~ThreadCache() {
+			for(size_t i=0; i<NodePool::SIZE_CLASS_COUNT; i++) {
+				drain(lists[i], i, lists[i].count);
+			}
+			threadCacheDestroyed = true;
+		}
+	}
+
+	void* NodePool::allocate(size_t size) {
+		size_t index = sizeClassIndex(size);
+		if(threadCacheDestroyed) {
+			FreeList list;
+			refill(list, index);
+			FreeNode* node = list.pop();
+			drain(list, index, list.count);
+			return node;
+		}
+		auto& list = threadCache.lists[index];
+		if(list.head == nullptr) {
+			refill(list, index);
+		}
+		return list.pop();
+	}
+
+	void NodePool::deallocate(void* ptr, size_t size) noexcept {
+		if(ptr == nullptr) {
+			return;
+		}
+		size_t index = sizeClassIndex(size);
+		if(threadCacheDestroyed) {
+			FreeList list;
+			list.push(static_cast<FreeNode*>(ptr));
+			drain(list, index, 1);
+			return;
+		}
+		auto& list = threadCache.lists[index];
+		list.push(static_cast<FreeNode*>(ptr));
+		if(list.count > MAX_CACHED_NODES) {
+			drain(list, index, TRANSFER_BATCH_SIZE);
+		}
+	}
+}
@@ -0,0 +1,107 @@
+//
+//  NodePool.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace fgl {
+	/// A process-wide pool of small fixed-size memory blocks, grouped into size classes.
+	/// Each thread keeps its own free list per size class, so allocating and freeing nodes
+	/// usually doesn't take a lock. Threads only go to the shared lists to refill or drain their caches in batches.
+	/// Memory obtained by the pool is kept for reuse and isn't returned to the system.
+	class NodePool {
+	public:
+		static constexpr size_t SIZE_CLASS_STEP = 16;
+		static constexpr size_t SIZE_CLASS_COUNT = 16;
+		static constexpr size_t MAX_NODE_SIZE = SIZE_CLASS_STEP * SIZE_CLASS_COUNT;
+		static constexpr size_t MAX_ALIGNMENT = SIZE_CLASS_STEP;
+		
+		/// Allocates a block of at least `size` bytes. `size` must be between 1 and MAX_NODE_SIZE.
+		static void* allocate(size_t size);
+		/// Returns a block to the pool. `size` must be the same size that was passed to allocate.
+		static void deallocate(void* ptr, size_t size) noexcept;
+		
+		static constexpr inline bool canAllocate(size_t size, size_t alignment) noexcept {
+			return (size != 0 && size <= MAX_NODE_SIZE && alignment <= MAX_ALIGNMENT);
+		}
+	};
+
+
+	/// A standard allocator that allocates single nodes from the NodePool.
+	/// Requests that are too large for the pool, or for more than one object, fall back to the global allocator.
+	template<typename T>
+	class PoolAllocator {
+	public:
+		using value_type = T;
+		
+		PoolAllocator() noexcept = default;
+		template<typename U>
+		inline PoolAllocator(const PoolAllocator<U>&) noexcept {}
+		template<typename U>
+		inline PoolAllocator(const std::allocator<U>&) noexcept {}
+		
+		inline T* allocate(size_t count);
+		inline void deallocate(T* ptr, size_t count) noexcept;
+		
+		template<typename U>
+		inline bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+		template<typename U>
+		inline bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+	};
+
+
+	#ifdef FGL_NODE_POOL_DEFAULT
+	/// The allocator used by node-based containers (LinkedList and Map) when none is given
+	template<typename T>
+	using DefaultNodeAllocator = PoolAllocator<T>;
+	#else
+	/// The allocator used by node-based containers (LinkedList and Map) when none is given.
+	/// Define FGL_NODE_POOL_DEFAULT to make these containers use the NodePool by default.
+	/// String::splitPooled always returns a pool-backed list.
+	template<typename T>
+	using DefaultNodeAllocator = std::allocator<T>;
+	#endif
+
+	/// Rebinds an allocator for a node-based container of T.
+	/// std::allocator maps to DefaultNodeAllocator, so containers derived from default containers keep their default types.
+	template<typename Allocator, typename T>
+	struct rebind_node_allocator {
+		using type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+	};
+	template<typename U, typename T>
+	struct rebind_node_allocator<std::allocator<U>,T> {
+		using type = DefaultNodeAllocator<T>;
+	};
+	template<typename Allocator, typename T>
+	using rebind_node_allocator_t = typename rebind_node_allocator<Allocator,T>::type;
+
+
+
+	#pragma mark PoolAllocator implementation
+
+	template<typename T>
+	T* PoolAllocator<T>::allocate(size_t count) {
+		if(count == 1 && NodePool::canAllocate(sizeof(T), alignof(T))) {
+			return static_cast<T*>(NodePool::allocate(sizeof(T)));
+		}
+		return std::allocator<T>().allocate(count);
+	}
+
+	template<typename T>
+	void PoolAllocator<T>::deallocate(T* ptr, size_t count) noexcept {
+		if(count == 1 && NodePool::canAllocate(sizeof(T), alignof(T))) {
+			NodePool::deallocate(ptr, sizeof(T));
+			return;
+		}
+		std::allocator<T>().deallocate(ptr, count);
+	}
+}
@@ -10,8 +10,11 @@
 
 #include <fgl/data/Common.hpp>
 #include <fgl/util/PlatformChecks.hpp>
+#include <cstring>
 #include <optional>
 #include <functional>
+#include <memory>
+#include <new>
 #include <variant>
 #include <tuple>
 
@@ -20,6 +23,10 @@ namespace fgl {
 
 	template<typename T>
 	class Optional;
+	template<typename T>
+	class SharedPtr;
+	template<typename T>
+	class RefPtr;
 
 	template<typename T>
 	using OptionalRef = Optional<std::reference_wrapper<T>>;
@@ -67,21 +74,150 @@ namespace fgl {
 	using OptionalOrVoid = typename optional_or_void<T>::type;
 
 
+	/// Describes a bit pattern that a valid T never has. When a type opts in by specializing this, Optional<T>
+	/// marks an empty value with that pattern instead of a separate flag, so it is the same size as T.
+	/// Specializations define `reset(void*)`, which writes the pattern into uninitialized storage,
+	/// and `isEmpty(const void*)`, which tells whether the storage holds the pattern.
+	/// Only references and smart pointers have a niche by default, and every other type is stored in a std::optional<T> unless it opts in.
+	template<typename T>
+	struct optional_niche {
+		static constexpr bool enabled = false;
+	};
+
+	/// A niche where every byte of an empty value is Byte
+	template<typename T, unsigned char Byte>
+	struct optional_niche_fill {
+		static constexpr bool enabled = true;
+		
+		static inline void reset(void* storage) noexcept {
+			std::memset(storage, Byte, sizeof(T));
+		}
+		
+		static inline bool isEmpty(const void* storage) noexcept {
+			unsigned char pattern[sizeof(T)];
+			std::memset(pattern, Byte, sizeof(T));
+			return std::memcmp(storage, pattern, sizeof(T)) == 0;
+		}
+	};
+
+	/// A niche that reserves one value of an enum or integer type. Declare it for your own type with:
+	/// template<> struct fgl::optional_niche<Color>: fgl::optional_niche_value<Color,Color::None> {};
+	template<typename T, T Sentinel>
+	struct optional_niche_value {
+		static constexpr bool enabled = true;
+		
+		static inline void reset(void* storage) noexcept {
+			new(storage) T(Sentinel);
+		}
+		
+		static inline bool isEmpty(const void* storage) noexcept {
+			return *static_cast<const T*>(storage) == Sentinel;
+		}
+	};
+
+
+	// a reference_wrapper holds a pointer that is never null
+	template<typename T>
+	struct optional_niche<std::reference_wrapper<T>>: optional_niche_fill<std::reference_wrapper<T>,0x00> {
+		static_assert(sizeof(std::reference_wrapper<T>) == sizeof(T*), "unexpected reference_wrapper layout");
+	};
+	// a null shared pointer is a valid value, but every byte set gives a misaligned control block pointer
+	template<typename T>
+	struct optional_niche<std::shared_ptr<T>>: optional_niche_fill<std::shared_ptr<T>,0xFF> {};
+	template<typename T>
+	struct optional_niche<SharedPtr<T>>: optional_niche_fill<SharedPtr<T>,0xFF> {};
+	// a RefCounted object is aligned to its counter, so a pointer with every bit set never points at one
+	template<typename T>
+	struct optional_niche<RefPtr<T>>: optional_niche_fill<RefPtr<T>,0xFF> {};
+
+
+	/// The storage of Optional<T> for types that have an optional_niche
+	template<typename T>
+	class _NicheOptional {
+		template<typename U>
+		using EnableIfConvertible = std::enable_if_t<std::is_constructible_v<T,U&&>
+			&& !std::is_base_of_v<_NicheOptional,std::remove_cvref_t<U>>
+			&& !std::is_same_v<std::remove_cvref_t<U>,std::nullopt_t>
+			&& !std::is_same_v<std::remove_cvref_t<U>,std::in_place_t>>;
+	public:
+		using value_type = T;
+		
+		inline _NicheOptional() noexcept;
+		inline _NicheOptional(std::nullopt_t) noexcept;
+		_NicheOptional(const _NicheOptional&);
+		_NicheOptional(_NicheOptional&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+		_NicheOptional(const std::optional<T>&);
+		_NicheOptional(std::optional<T>&&);
+		template<typename... Args>
+		explicit _NicheOptional(std::in_place_t, Args&&... args);
+		template<typename U = T, typename = EnableIfConvertible<U>>
+		_NicheOptional(U&& value);
+		inline ~_NicheOptional();
+		
+		_NicheOptional& operator=(std::nullopt_t) noexcept;
+		_NicheOptional& operator=(const _NicheOptional&);
+		_NicheOptional& operator=(_NicheOptional&&) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+		template<typename U = T, typename = EnableIfConvertible<U>>
+		_NicheOptional& operator=(U&& value);
+		
+		inline T* operator->();
+		inline const T* operator->() const;
+		inline T& operator*() &;
+		inline const T& operator*() const&;
+		inline T&& operator*() &&;
+		inline explicit operator bool() const noexcept;
+		
+		inline bool has_value() const noexcept;
+		inline T& value() &;
+		inline const T& value() const&;
+		inline T&& value() &&;
+		template<typename U>
+		inline T value_or(U&& defaultValue) const&;
+		template<typename U>
+		inline T value_or(U&& defaultValue) &&;
+		
+		void swap(_NicheOptional&);
+		inline void reset() noexcept;
+		template<typename... Args>
+		T& emplace(Args&&... args);
+		
+		operator std::optional<T>() const&;
+		operator std::optional<T>() &&;
+		
+	private:
+		using Niche = optional_niche<T>;
+		
+		inline T* get() noexcept;
+		inline const T* get() const noexcept;
+		
+		alignas(T) unsigned char _storage[sizeof(T)];
+	};
+
+	template<typename T>
+	using _OptionalBase = std::conditional_t<optional_niche<T>::enabled, _NicheOptional<T>, std::optional<T>>;
+
 
+
+	/// An optional value. Types that opt in with an optional_niche are stored without a separate flag,
+	/// and every other type is stored in a std::optional.
 	template<typename T>
-	class Optional: public std::optional<T> {
+	class Optional: public _OptionalBase<T> {
 	public:
-		using std::optional<T>::optional;
-		using std::optional<T>::operator->;
-		using std::optional<T>::operator*;
-		using std::optional<T>::operator=;
-		using std::optional<T>::operator bool;
-		using std::optional<T>::has_value;
-		using std::optional<T>::value;
-		using std::optional<T>::value_or;
-		using std::optional<T>::swap;
-		using std::optional<T>::reset;
-		using std::optional<T>::emplace;
+		using BaseType = _OptionalBase<T>;
+		static constexpr bool usesNiche = optional_niche<T>::enabled;
+		
+		using typename BaseType::value_type;
+		using BaseType::BaseType;
+		using BaseType::operator->;
+		using BaseType::operator*;
+		using BaseType::operator=;
+		using BaseType::operator bool;
+		using BaseType::has_value;
+		using BaseType::value;
+		using BaseType::value_or;
+		using BaseType::swap;
+		using BaseType::reset;
+		using BaseType::emplace;
 		
 		template<typename U=T>
 		Optional(U&& value);
@@ -89,9 +225,9 @@ namespace fgl {
 		template<typename U=T>
 		Optional<T>& operator=(U&& value);
 		
-		inline operator std::optional<T>&();
-		inline operator const std::optional<T>&() const;
-		inline operator std::optional<T>&&() &&;
+		inline operator std::optional<T>&() requires (!usesNiche);
+		inline operator const std::optional<T>&() const requires (!usesNiche);
+		inline operator std::optional<T>&&() && requires (!usesNiche);
 		template<typename U,
 			typename std::enable_if<std::is_convertible_v<T,U>,std::nullptr_t>::type = nullptr>
 		inline explicit operator std::optional<U>() const;
@@ -205,48 +341,310 @@ namespace fgl {
 
 
 
+#pragma mark _NicheOptional implementation
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional() noexcept {
+		Niche::reset(_storage);
+	}
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional(std::nullopt_t) noexcept {
+		Niche::reset(_storage);
+	}
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional(const _NicheOptional& optional) {
+		if(optional.has_value()) {
+			new(_storage) T(*optional.get());
+		} else {
+			Niche::reset(_storage);
+		}
+	}
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional(_NicheOptional&& optional) noexcept(std::is_nothrow_move_constructible_v<T>) {
+		if(optional.has_value()) {
+			new(_storage) T(std::move(*optional.get()));
+		} else {
+			Niche::reset(_storage);
+		}
+	}
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional(const std::optional<T>& optional) {
+		if(optional.has_value()) {
+			new(_storage) T(*optional);
+		} else {
+			Niche::reset(_storage);
+		}
+	}
+
+	template<typename T>
+	_NicheOptional<T>::_NicheOptional(std::optional<T>&& optional) {
+		if(optional.has_value()) {
+			new(_storage) T(std::move(*optional));
+		} else {
+			Niche::reset(_storage);
+		}
+	}
+
+	template<typename T>
+	template<typename... Args>
+	_NicheOptional<T>::_NicheOptional(std::in_place_t, Args&&... args) {
+		new(_storage) T(std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	_NicheOptional<T>::_NicheOptional(U&& value) {
+		new(_storage) T(std::forward<U>(value));
+	}
+
+	template<typename T>
+	_NicheOptional<T>::~_NicheOptional() {
+		if constexpr(!std::is_trivially_destructible_v<T>) {
+			if(has_value()) {
+				get()->~T();
+			}
+		}
+	}
+
+	template<typename T>
+	_NicheOptional<T>& _NicheOptional<T>::operator=(std::nullopt_t) noexcept {
+		reset();
+		return *this;
+	}
+
+	template<typename T>
+	_NicheOptional<T>& _NicheOptional<T>::operator=(const _NicheOptional& optional) {
+		if(this == &optional) {
+			return *this;
+		}
+		if(!optional.has_value()) {
+			reset();
+		} else if(has_value()) {
+			*get() = *optional.get();
+		} else {
+			new(_storage) T(*optional.get());
+		}
+		return *this;
+	}
+
+	template<typename T>
+	_NicheOptional<T>& _NicheOptional<T>::operator=(_NicheOptional&& optional) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) {
+		if(this == &optional) {
+			return *this;
+		}
+		if(!optional.has_value()) {
+			reset();
+		} else if(has_value()) {
+			*get() = std::move(*optional.get());
+		} else {
+			new(_storage) T(std::move(*optional.get()));
+		}
+		return *this;
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	_NicheOptional<T>& _NicheOptional<T>::operator=(U&& value) {
+		if(has_value()) {
+			*get() = std::forward<U>(value);
+		} else {
+			new(_storage) T(std::forward<U>(value));
+		}
+		return *this;
+	}
+
+	template<typename T>
+	T* _NicheOptional<T>::operator->() {
+		return get();
+	}
+
+	template<typename T>
+	const T* _NicheOptional<T>::operator->() const {
+		return get();
+	}
+
+	template<typename T>
+	T& _NicheOptional<T>::operator*() & {
+		return *get();
+	}
+
+	template<typename T>
+	const T& _NicheOptional<T>::operator*() const& {
+		return *get();
+	}
+
+	template<typename T>
+	T&& _NicheOptional<T>::operator*() && {
+		return std::move(*get());
+	}
+
+	template<typename T>
+	_NicheOptional<T>::operator bool() const noexcept {
+		return has_value();
+	}
+
+	template<typename T>
+	bool _NicheOptional<T>::has_value() const noexcept {
+		return !Niche::isEmpty(_storage);
+	}
+
+	template<typename T>
+	T& _NicheOptional<T>::value() & {
+		if(!has_value()) {
+			throw std::bad_optional_access();
+		}
+		return *get();
+	}
+
+	template<typename T>
+	const T& _NicheOptional<T>::value() const& {
+		if(!has_value()) {
+			throw std::bad_optional_access();
+		}
+		return *get();
+	}
+
+	template<typename T>
+	T&& _NicheOptional<T>::value() && {
+		if(!has_value()) {
+			throw std::bad_optional_access();
+		}
+		return std::move(*get());
+	}
+
+	template<typename T>
+	template<typename U>
+	T _NicheOptional<T>::value_or(U&& defaultValue) const& {
+		if(has_value()) {
+			return *get();
+		}
+		return static_cast<T>(std::forward<U>(defaultValue));
+	}
+
+	template<typename T>
+	template<typename U>
+	T _NicheOptional<T>::value_or(U&& defaultValue) && {
+		if(has_value()) {
+			return std::move(*get());
+		}
+		return static_cast<T>(std::forward<U>(defaultValue));
+	}
+
+	template<typename T>
+	void _NicheOptional<T>::swap(_NicheOptional& optional) {
+		if(has_value() && optional.has_value()) {
+			using std::swap;
+			swap(*get(), *optional.get());
+		} else if(has_value()) {
+			optional = std::move(*this);
+			reset();
+		} else if(optional.has_value()) {
+			*this = std::move(optional);
+			optional.reset();
+		}
+	}
+
+	template<typename T>
+	void _NicheOptional<T>::reset() noexcept {
+		if(has_value()) {
+			get()->~T();
+			Niche::reset(_storage);
+		}
+	}
+
+	template<typename T>
+	template<typename... Args>
+	T& _NicheOptional<T>::emplace(Args&&... args) {
+		reset();
+		try {
+			new(_storage) T(std::forward<Args>(args)...);
+		} catch(...) {
+			Niche::reset(_storage);
+			throw;
+		}
+		return *get();
+	}
+
+	template<typename T>
+	_NicheOptional<T>::operator std::optional<T>() const& {
+		if(!has_value()) {
+			return std::nullopt;
+		}
+		return *get();
+	}
+
+	template<typename T>
+	_NicheOptional<T>::operator std::optional<T>() && {
+		if(!has_value()) {
+			return std::nullopt;
+		}
+		return std::move(*get());
+	}
+
+	template<typename T>
+	T* _NicheOptional<T>::get() noexcept {
+		return std::launder(reinterpret_cast<T*>(_storage));
+	}
+
+	template<typename T>
+	const T* _NicheOptional<T>::get() const noexcept {
+		return std::launder(reinterpret_cast<const T*>(_storage));
+	}
+
+
+
 #pragma mark Optional implementation
 
 	template<typename T>
 	template<typename U>
-	Optional<T>::Optional(U&& value): std::optional<T>(value) {
+	Optional<T>::Optional(U&& value): BaseType(std::forward<U>(value)) {
 		//
 	}
 	
 	template<typename T>
 	template<typename U>
 	Optional<T>& Optional<T>::operator=(U&& value) {
-		std::optional<T>::operator=(value);
+		BaseType::operator=(std::forward<U>(value));
 		return *this;
 	}
 
 	template<typename T>
-	Optional<T>::operator std::optional<T>&() {
+	Optional<T>::operator std::optional<T>&() requires (!usesNiche) {
 		return *this;
 	}
 
 	template<typename T>
-	Optional<T>::operator const std::optional<T>&() const {
+	Optional<T>::operator const std::optional<T>&() const requires (!usesNiche) {
 		return *this;
 	}
 
 	template<typename T>
-	Optional<T>::operator std::optional<T>&&() && {
-		return *this;
+	Optional<T>::operator std::optional<T>&&() && requires (!usesNiche) {
+		return std::move(*this);
 	}
 
 	template<typename T>
 	template<typename U,
 		typename std::enable_if<std::is_convertible_v<T,U>,std::nullptr_t>::type>
 	Optional<T>::operator std::optional<U>() const {
-		return static_cast<std::optional<U>>((const std::optional<T>&)*this);
+		if(!has_value()) {
+			return std::nullopt;
+		}
+		return std::optional<U>(**this);
 	}
 
 	template<typename T>
 	template<typename U,
 		typename std::enable_if<std::is_convertible_v<T,U>,std::nullptr_t>::type>
 	Optional<T>::operator Optional<U>() const {
-		return Optional<U>(static_cast<std::optional<U>>((const std::optional<T>&)*this));
+		if(!has_value()) {
+			return std::nullopt;
+		}
+		return Optional<U>(std::in_place, **this);
 	}
 	
 	template<typename T>
@@ -410,199 +808,187 @@ namespace fgl {
 
 	template<typename T>
 	bool operator==(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		if(static_cast<bool>(left1) != static_cast<bool>(right1)) {
+		if(left.has_value() != right.has_value()) {
 			return false;
 		}
-		if(!static_cast<bool>(left1)) {
+		if(!left.has_value()) {
 			return true;
 		}
-		return left1.value() == right1.value();
+		return *left == *right;
 	}
 
 	template<typename T>
 	bool operator!=(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		if(static_cast<bool>(left1) != static_cast<bool>(right1)) {
+		if(left.has_value() != right.has_value()) {
 			return true;
 		}
-		if(!static_cast<bool>(left1)) {
+		if(!left.has_value()) {
 			return false;
 		}
-		return left1.value() != right1.value();
+		return *left != *right;
 	}
 
 	template<typename T>
 	bool operator<(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		return left1 < right1;
+		if(!right.has_value()) {
+			return false;
+		}
+		if(!left.has_value()) {
+			return true;
+		}
+		return *left < *right;
 	}
 
 	template<typename T>
 	bool operator<=(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		return left1 <= right1;
+		if(!left.has_value()) {
+			return true;
+		}
+		if(!right.has_value()) {
+			return false;
+		}
+		return *left <= *right;
 	}
 
 	template<typename T>
 	bool operator>(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		return left1 > right1;
+		if(!left.has_value()) {
+			return false;
+		}
+		if(!right.has_value()) {
+			return true;
+		}
+		return *left > *right;
 	}
 
 	template<typename T>
 	bool operator>=(const Optional<T>& left, const Optional<T>& right) {
-		const std::optional<T>& left1 = left;
-		const std::optional<T>& right1 = right;
-		return left1 >= right1;
+		if(!right.has_value()) {
+			return true;
+		}
+		if(!left.has_value()) {
+			return false;
+		}
+		return *left >= *right;
 	}
 
 	template<typename T>
 	bool operator==(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 == right;
+		return !left.has_value();
 	}
 
 	template<typename T>
 	bool operator==(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left == right1;
+		return !right.has_value();
 	}
 
 	template<typename T>
 	bool operator!=(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 != right;
+		return left.has_value();
 	}
 
 	template<typename T>
 	bool operator!=(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left != right1;
+		return right.has_value();
 	}
 
 	template<typename T>
 	bool operator<(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 < right;
+		return false;
 	}
 
 	template<typename T>
 	bool operator<(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left < right1;
+		return right.has_value();
 	}
 
 	template<typename T>
 	bool operator<=(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 <= right;
+		return !left.has_value();
 	}
 
 	template<typename T>
 	bool operator<=(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left <= right1;
+		return true;
 	}
 
 	template<typename T>
 	bool operator>(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 > right;
+		return left.has_value();
 	}
 
 	template<typename T>
 	bool operator>(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left > right1;
+		return false;
 	}
 
 	template<typename T>
 	bool operator>=(const Optional<T>& left, std::nullopt_t right) {
-		const std::optional<T>& left1 = left;
-		return left1 >= right;
+		return true;
 	}
 
 	template<typename T>
 	bool operator>=(std::nullopt_t left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left >= right1;
+		return !right.has_value();
 	}
 
 	template<typename T, typename U>
 	bool operator==(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 == right;
+		return left.has_value() && *left == right;
 	}
 
 	template<typename T, typename U>
 	bool operator==(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left == right1;
+		return right.has_value() && left == *right;
 	}
 
 	template<typename T, typename U>
 	bool operator!=(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 != right;
+		return !left.has_value() || *left != right;
 	}
 
 	template<typename T, typename U>
 	bool operator!=(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left != right1;
+		return !right.has_value() || left != *right;
 	}
 
 	template<typename T, typename U>
 	bool operator<(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 < right;
+		return !left.has_value() || *left < right;
 	}
 
 	template<typename T, typename U>
 	bool operator<(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left < right1;
+		return right.has_value() && left < *right;
 	}
 
 	template<typename T, typename U>
 	bool operator<=(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 <= right;
+		return !left.has_value() || *left <= right;
 	}
 
 	template<typename T, typename U>
 	bool operator<=(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left <= right1;
+		return right.has_value() && left <= *right;
 	}
 
 	template<typename T, typename U>
 	bool operator>(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 > right;
+		return left.has_value() && *left > right;
 	}
 
 	template<typename T, typename U>
 	bool operator>(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left > right1;
+		return !right.has_value() || left > *right;
 	}
 
 	template<typename T, typename U>
 	bool operator>=(const Optional<T>& left, const U& right) {
-		const std::optional<T>& left1 = left;
-		return left1 >= right;
+		return left.has_value() && *left >= right;
 	}
 
 	template<typename T, typename U>
 	bool operator>=(const U& left, const Optional<T>& right) {
-		const std::optional<T>& right1 = right;
-		return left >= right1;
+		return !right.has_value() || left >= *right;
 	}
 }
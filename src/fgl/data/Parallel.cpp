@@ -0,0 +1,68 @@
+//
+//  Parallel.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/Parallel.hpp>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace fgl {
+	void runParallel(size_t count, size_t threadCount, const std::function<void(size_t)>& work) {
+		if(threadCount == 0) {
+			threadCount = std::max((size_t)1, (size_t)std::thread::hardware_concurrency());
+		}
+		threadCount = std::min(threadCount, count);
+		if(threadCount <= 1) {
+			for(size_t i=0; i<count; i++) {
+				work(i);
+			}
+			return;
+		}
+		// indexes are handed out one at a time, so threads that finish early take on more of the work
+		std::atomic<size_t> nextIndex = 0;
+		std::exception_ptr error;
+		std::mutex errorMutex;
+		auto runWorker = [&]() {
+			while(true) {
+				size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+				if(index >= count) {
+					break;
+				}
+				try {
+					work(index);
+				} catch(...) {
+					std::lock_guard<std::mutex> lock(errorMutex);
+					if(!error) {
+						error = std::current_exception();
+					}
+					nextIndex.store(count, std::memory_order_relaxed);
+				}
+			}
+		};
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount - 1);
+		for(size_t i=1; i<threadCount; i++) {
+			try {
+				threads.emplace_back(runWorker);
+			} catch(std::system_error&) {
+				// the threads that did start, and this one, will share the remaining work
+				break;
+			}
+		}
+		runWorker();
+		for(auto& thread : threads) {
+			thread.join();
+		}
+		if(error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
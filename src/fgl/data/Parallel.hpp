@@ -0,0 +1,19 @@
+//
+//  Parallel.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <functional>
+
+namespace fgl {
+	/// Calls work(index) for every index below count, spread across up to threadCount threads, or one per core if threadCount is 0.
+	/// The calling thread does its share of the work, and this returns once every index is done.
+	/// If work throws, the remaining indexes are skipped, and the first exception is rethrown once every thread has stopped.
+	void runParallel(size_t count, size_t threadCount, const std::function<void(size_t)>& work);
+}
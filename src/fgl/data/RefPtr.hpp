@@ -0,0 +1,578 @@
+//
+//  RefPtr.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/SharedPtr.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace fgl {
+	template<typename T, bool ThreadSafe = true>
+	class RefCounted;
+	template<typename T>
+	class RefPtr;
+	template<typename T>
+	class WeakRef;
+
+	template<bool ThreadSafe>
+	class _RefCountedBase;
+	template<bool ThreadSafe>
+	class _WeakRefControl;
+
+	template<bool ThreadSafe>
+	struct _RefCounter {
+		std::atomic<size_t> count;
+
+		inline explicit _RefCounter(size_t count): count(count) {}
+		inline size_t load() const {
+			return count.load(std::memory_order_relaxed);
+		}
+		inline void increment() {
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+		inline bool incrementIfNonZero() {
+			size_t prevCount = count.load(std::memory_order_relaxed);
+			while(prevCount != 0) {
+				if(count.compare_exchange_weak(prevCount, prevCount + 1, std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+			return false;
+		}
+		/// returns true if the count reached 0
+		inline bool decrement() {
+			return (count.fetch_sub(1, std::memory_order_acq_rel) == 1);
+		}
+	};
+
+	template<>
+	struct _RefCounter<false> {
+		size_t count;
+
+		inline explicit _RefCounter(size_t count): count(count) {}
+		inline size_t load() const {
+			return count;
+		}
+		inline void increment() {
+			count++;
+		}
+		inline bool incrementIfNonZero() {
+			if(count == 0) {
+				return false;
+			}
+			count++;
+			return true;
+		}
+		inline bool decrement() {
+			return (--count == 0);
+		}
+	};
+
+	struct _NoMutex {
+		inline void lock() {}
+		inline void unlock() {}
+	};
+
+	template<bool ThreadSafe>
+	class _WeakRefControl {
+		friend class _RefCountedBase<ThreadSafe>;
+	public:
+		using Mutex = std::conditional_t<ThreadSafe, std::mutex, _NoMutex>;
+
+		inline void retain() {
+			refCount.increment();
+		}
+		inline void release() {
+			if(refCount.decrement()) {
+				delete this;
+			}
+		}
+		inline bool expired() const {
+			std::lock_guard<Mutex> lock(mutex);
+			return (object == nullptr);
+		}
+		inline bool tryRetainObject();
+
+	private:
+		inline explicit _WeakRefControl(_RefCountedBase<ThreadSafe>* object): refCount(1), object(object) {}
+		inline void detachObject() {
+			std::lock_guard<Mutex> lock(mutex);
+			object = nullptr;
+		}
+
+		_RefCounter<ThreadSafe> refCount;
+		mutable Mutex mutex;
+		_RefCountedBase<ThreadSafe>* object;
+	};
+
+	template<bool ThreadSafe>
+	class _RefCountedBase {
+		friend class _WeakRefControl<ThreadSafe>;
+	public:
+		using WeakRefControl = _WeakRefControl<ThreadSafe>;
+
+		_RefCountedBase(const _RefCountedBase&) = delete;
+		_RefCountedBase& operator=(const _RefCountedBase&) = delete;
+
+		inline void retainRef() const {
+			_refCount.increment();
+		}
+		inline size_t refCount() const {
+			return _refCount.load();
+		}
+		/// Gets the control block shared by weak references to this object, creating it if needed.
+		/// The returned control block has already been retained for the caller.
+		inline WeakRefControl* retainWeakRefControl() const;
+
+	protected:
+		_RefCountedBase(): _refCount(0), _weakRefControl(nullptr) {}
+		~_RefCountedBase() = default;
+
+		/// returns true if the object should be destroyed
+		inline bool releaseRefCount() const;
+
+	private:
+		mutable _RefCounter<ThreadSafe> _refCount;
+		mutable std::conditional_t<ThreadSafe, std::atomic<WeakRefControl*>, WeakRefControl*> _weakRefControl;
+	};
+
+
+	/// An intrusive reference counted base class. Objects deriving from RefCounted keep their reference count
+	/// inline, so a RefPtr is a single pointer and creating one requires no extra allocation.
+	/// If ThreadSafe is false, the reference count is not atomic and the object must only be referenced from one thread.
+	/// Objects that are subclassed further must have a virtual destructor.
+	template<typename T, bool ThreadSafe>
+	class RefCounted: public _RefCountedBase<ThreadSafe> {
+	public:
+		inline void releaseRef() const;
+
+	protected:
+		RefCounted() = default;
+		~RefCounted() = default;
+	};
+
+
+	template<typename T>
+	class RefPtr {
+		template<typename U>
+		friend class RefPtr;
+		template<typename U>
+		friend class WeakRef;
+	public:
+		using element_type = T;
+
+		inline RefPtr() noexcept;
+		inline RefPtr(std::nullptr_t) noexcept;
+		inline explicit RefPtr(T* ptr);
+		inline RefPtr(const RefPtr&);
+		inline RefPtr(RefPtr&&) noexcept;
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		inline RefPtr(const RefPtr<U>&);
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		inline RefPtr(RefPtr<U>&&) noexcept;
+		inline ~RefPtr();
+
+		inline RefPtr& operator=(std::nullptr_t);
+		inline RefPtr& operator=(const RefPtr&);
+		inline RefPtr& operator=(RefPtr&&) noexcept;
+
+		/// Wraps a pointer that has already been retained, without retaining it again
+		static inline RefPtr adopt(T* ptr) noexcept;
+
+		inline T* get() const noexcept;
+		inline T& operator*() const noexcept;
+		inline T* operator->() const noexcept;
+		inline explicit operator bool() const noexcept;
+
+		inline void reset();
+		inline void swap(RefPtr&) noexcept;
+		/// Releases ownership of the pointer without releasing the reference
+		inline T* leak() noexcept;
+		inline size_t refCount() const;
+
+		template<typename U>
+		inline RefPtr<U> as() const;
+		template<typename U>
+		inline RefPtr<U> forceAs() const;
+
+	private:
+		T* _ptr;
+	};
+
+	template<typename T, typename U>
+	inline bool operator==(const RefPtr<T>& left, const RefPtr<U>& right) noexcept;
+	template<typename T, typename U>
+	inline bool operator!=(const RefPtr<T>& left, const RefPtr<U>& right) noexcept;
+	template<typename T>
+	inline bool operator==(const RefPtr<T>& left, std::nullptr_t) noexcept;
+	template<typename T>
+	inline bool operator!=(const RefPtr<T>& left, std::nullptr_t) noexcept;
+
+
+	template<typename T>
+	class WeakRef {
+		template<typename U>
+		friend class WeakRef;
+	public:
+		using WeakRefControl = typename T::WeakRefControl;
+
+		inline WeakRef() noexcept;
+		inline WeakRef(std::nullptr_t) noexcept;
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		inline WeakRef(const RefPtr<U>&);
+		inline WeakRef(const WeakRef&);
+		inline WeakRef(WeakRef&&) noexcept;
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		inline WeakRef(const WeakRef<U>&);
+		inline ~WeakRef();
+
+		inline WeakRef& operator=(const WeakRef&);
+		inline WeakRef& operator=(WeakRef&&) noexcept;
+
+		inline bool expired() const;
+		inline RefPtr<T> lock() const;
+		inline void reset();
+
+	private:
+		WeakRefControl* _control;
+		T* _ptr;
+	};
+
+
+	template<typename T, typename... Args>
+	RefPtr<T> newRef(Args&&... args) {
+		return RefPtr<T>(new T(std::forward<Args>(args)...));
+	}
+
+	template<typename T>
+	struct is_ptr_container<RefPtr<T>>: std::true_type {
+		using content_type = T;
+	};
+
+
+
+	#pragma mark _WeakRefControl implementation
+
+	template<bool ThreadSafe>
+	bool _WeakRefControl<ThreadSafe>::tryRetainObject() {
+		std::lock_guard<Mutex> lock(mutex);
+		if(object == nullptr) {
+			return false;
+		}
+		return object->_refCount.incrementIfNonZero();
+	}
+
+
+
+	#pragma mark _RefCountedBase implementation
+
+	template<bool ThreadSafe>
+	_WeakRefControl<ThreadSafe>* _RefCountedBase<ThreadSafe>::retainWeakRefControl() const {
+		if constexpr(ThreadSafe) {
+			auto control = _weakRefControl.load(std::memory_order_acquire);
+			if(control == nullptr) {
+				auto newControl = new WeakRefControl(const_cast<_RefCountedBase*>(this));
+				if(_weakRefControl.compare_exchange_strong(control, newControl, std::memory_order_acq_rel)) {
+					control = newControl;
+				} else {
+					delete newControl;
+				}
+			}
+			control->retain();
+			return control;
+		} else {
+			if(_weakRefControl == nullptr) {
+				_weakRefControl = new WeakRefControl(const_cast<_RefCountedBase*>(this));
+			}
+			_weakRefControl->retain();
+			return _weakRefControl;
+		}
+	}
+
+	template<bool ThreadSafe>
+	bool _RefCountedBase<ThreadSafe>::releaseRefCount() const {
+		if(!_refCount.decrement()) {
+			return false;
+		}
+		WeakRefControl* control;
+		if constexpr(ThreadSafe) {
+			control = _weakRefControl.load(std::memory_order_acquire);
+		} else {
+			control = _weakRefControl;
+		}
+		if(control != nullptr) {
+			control->detachObject();
+			control->release();
+		}
+		return true;
+	}
+
+
+
+	#pragma mark RefCounted implementation
+
+	template<typename T, bool ThreadSafe>
+	void RefCounted<T,ThreadSafe>::releaseRef() const {
+		if(this->releaseRefCount()) {
+			delete static_cast<const T*>(this);
+		}
+	}
+
+
+
+	#pragma mark RefPtr implementation
+
+	template<typename T>
+	RefPtr<T>::RefPtr() noexcept: _ptr(nullptr) {
+		//
+	}
+
+	template<typename T>
+	RefPtr<T>::RefPtr(std::nullptr_t) noexcept: _ptr(nullptr) {
+		//
+	}
+
+	template<typename T>
+	RefPtr<T>::RefPtr(T* ptr): _ptr(ptr) {
+		if(_ptr != nullptr) {
+			_ptr->retainRef();
+		}
+	}
+
+	template<typename T>
+	RefPtr<T>::RefPtr(const RefPtr& ptr): _ptr(ptr._ptr) {
+		if(_ptr != nullptr) {
+			_ptr->retainRef();
+		}
+	}
+
+	template<typename T>
+	RefPtr<T>::RefPtr(RefPtr&& ptr) noexcept: _ptr(ptr._ptr) {
+		ptr._ptr = nullptr;
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	RefPtr<T>::RefPtr(const RefPtr<U>& ptr): _ptr(ptr._ptr) {
+		if(_ptr != nullptr) {
+			_ptr->retainRef();
+		}
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	RefPtr<T>::RefPtr(RefPtr<U>&& ptr) noexcept: _ptr(ptr._ptr) {
+		ptr._ptr = nullptr;
+	}
+
+	template<typename T>
+	RefPtr<T>::~RefPtr() {
+		if(_ptr != nullptr) {
+			_ptr->releaseRef();
+		}
+	}
+
+	template<typename T>
+	RefPtr<T>& RefPtr<T>::operator=(std::nullptr_t) {
+		reset();
+		return *this;
+	}
+
+	template<typename T>
+	RefPtr<T>& RefPtr<T>::operator=(const RefPtr& ptr) {
+		RefPtr<T>(ptr).swap(*this);
+		return *this;
+	}
+
+	template<typename T>
+	RefPtr<T>& RefPtr<T>::operator=(RefPtr&& ptr) noexcept {
+		RefPtr<T>(std::move(ptr)).swap(*this);
+		return *this;
+	}
+
+	template<typename T>
+	RefPtr<T> RefPtr<T>::adopt(T* ptr) noexcept {
+		RefPtr<T> refPtr;
+		refPtr._ptr = ptr;
+		return refPtr;
+	}
+
+	template<typename T>
+	T* RefPtr<T>::get() const noexcept {
+		return _ptr;
+	}
+
+	template<typename T>
+	T& RefPtr<T>::operator*() const noexcept {
+		return *_ptr;
+	}
+
+	template<typename T>
+	T* RefPtr<T>::operator->() const noexcept {
+		return _ptr;
+	}
+
+	template<typename T>
+	RefPtr<T>::operator bool() const noexcept {
+		return (_ptr != nullptr);
+	}
+
+	template<typename T>
+	void RefPtr<T>::reset() {
+		T* ptr = _ptr;
+		_ptr = nullptr;
+		if(ptr != nullptr) {
+			ptr->releaseRef();
+		}
+	}
+
+	template<typename T>
+	void RefPtr<T>::swap(RefPtr& ptr) noexcept {
+		std::swap(_ptr, ptr._ptr);
+	}
+
+	template<typename T>
+	T* RefPtr<T>::leak() noexcept {
+		T* ptr = _ptr;
+		_ptr = nullptr;
+		return ptr;
+	}
+
+	template<typename T>
+	size_t RefPtr<T>::refCount() const {
+		if(_ptr == nullptr) {
+			return 0;
+		}
+		return _ptr->refCount();
+	}
+
+	template<typename T>
+	template<typename U>
+	RefPtr<U> RefPtr<T>::as() const {
+		return RefPtr<U>(dynamic_cast<U*>(_ptr));
+	}
+
+	template<typename T>
+	template<typename U>
+	RefPtr<U> RefPtr<T>::forceAs() const {
+		return RefPtr<U>(static_cast<U*>(_ptr));
+	}
+
+	template<typename T, typename U>
+	bool operator==(const RefPtr<T>& left, const RefPtr<U>& right) noexcept {
+		return (left.get() == right.get());
+	}
+
+	template<typename T, typename U>
+	bool operator!=(const RefPtr<T>& left, const RefPtr<U>& right) noexcept {
+		return (left.get() != right.get());
+	}
+
+	template<typename T>
+	bool operator==(const RefPtr<T>& left, std::nullptr_t) noexcept {
+		return (left.get() == nullptr);
+	}
+
+	template<typename T>
+	bool operator!=(const RefPtr<T>& left, std::nullptr_t) noexcept {
+		return (left.get() != nullptr);
+	}
+
+
+
+	#pragma mark WeakRef implementation
+
+	template<typename T>
+	WeakRef<T>::WeakRef() noexcept: _control(nullptr), _ptr(nullptr) {
+		//
+	}
+
+	template<typename T>
+	WeakRef<T>::WeakRef(std::nullptr_t) noexcept: _control(nullptr), _ptr(nullptr) {
+		//
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	WeakRef<T>::WeakRef(const RefPtr<U>& ptr): _control(nullptr), _ptr(ptr.get()) {
+		if(_ptr != nullptr) {
+			_control = _ptr->retainWeakRefControl();
+		}
+	}
+
+	template<typename T>
+	WeakRef<T>::WeakRef(const WeakRef& ref): _control(ref._control), _ptr(ref._ptr) {
+		if(_control != nullptr) {
+			_control->retain();
+		}
+	}
+
+	template<typename T>
+	WeakRef<T>::WeakRef(WeakRef&& ref) noexcept: _control(ref._control), _ptr(ref._ptr) {
+		ref._control = nullptr;
+		ref._ptr = nullptr;
+	}
+
+	template<typename T>
+	template<typename U, typename _>
+	WeakRef<T>::WeakRef(const WeakRef<U>& ref): _control(ref._control), _ptr(ref._ptr) {
+		if(_control != nullptr) {
+			_control->retain();
+		}
+	}
+
+	template<typename T>
+	WeakRef<T>::~WeakRef() {
+		if(_control != nullptr) {
+			_control->release();
+		}
+	}
+
+	template<typename T>
+	WeakRef<T>& WeakRef<T>::operator=(const WeakRef& ref) {
+		if(ref._control != nullptr) {
+			ref._control->retain();
+		}
+		reset();
+		_control = ref._control;
+		_ptr = ref._ptr;
+		return *this;
+	}
+
+	template<typename T>
+	WeakRef<T>& WeakRef<T>::operator=(WeakRef&& ref) noexcept {
+		std::swap(_control, ref._control);
+		std::swap(_ptr, ref._ptr);
+		return *this;
+	}
+
+	template<typename T>
+	bool WeakRef<T>::expired() const {
+		return (_control == nullptr || _control->expired());
+	}
+
+	template<typename T>
+	RefPtr<T> WeakRef<T>::lock() const {
+		if(_control == nullptr || !_control->tryRetainObject()) {
+			return nullptr;
+		}
+		return RefPtr<T>::adopt(_ptr);
+	}
+
+	template<typename T>
+	void WeakRef<T>::reset() {
+		auto control = _control;
+		_control = nullptr;
+		_ptr = nullptr;
+		if(control != nullptr) {
+			control->release();
+		}
+	}
+}
@@ -0,0 +1,102 @@
+//
+//  SharedData.cpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#include <fgl/data/SharedData.hpp>
+
+namespace fgl {
+	#pragma mark SharedData implementation
+
+	SharedData::SharedData() noexcept
+	: _data(nullptr), _size(0) {
+		//
+	}
+
+	SharedData::SharedData(Data&& data)
+	: _storage(std::make_shared<Storage>(std::in_place_type<Data>, std::move(data))) {
+		auto& buffer = std::get<Data>(*_storage);
+		_data = buffer.data();
+		_size = buffer.size();
+	}
+
+	SharedData::SharedData(String&& str)
+	: _storage(std::make_shared<Storage>(std::in_place_type<String>, std::move(str))) {
+		auto& buffer = std::get<String>(*_storage);
+		_data = (const uint8_t*)buffer.data();
+		_size = buffer.size();
+	}
+
+	SharedData::SharedData(DataView bytes)
+	: SharedData(bytes.toData()) {
+		//
+	}
+
+	SharedData::SharedData(std::shared_ptr<Storage> storage, const uint8_t* data, size_type size) noexcept
+	: _storage(std::move(storage)), _data(data), _size(size) {
+		//
+	}
+
+	SharedData SharedData::slice(DataView bytes) const {
+		if(bytes.size() > 0 && (bytes.data() < _data || (bytes.data() + bytes.size()) > (_data + _size))) {
+			throw std::out_of_range("DataView is not within the bounds of this SharedData");
+		}
+		return SharedData(_storage, bytes.data(), bytes.size());
+	}
+
+	ArrayList<SharedData> SharedData::split(uint8_t delimiter) const {
+		auto views = view().split(delimiter);
+		return views.map([&](auto& part) {
+			return SharedData(_storage, part.data(), part.size());
+		});
+	}
+
+	ArrayList<SharedData> SharedData::split(DataView delimiter) const {
+		auto views = view().split(delimiter);
+		return views.map([&](auto& part) {
+			return SharedData(_storage, part.data(), part.size());
+		});
+	}
+
+	bool SharedData::ownsWholeBuffer() const noexcept {
+		if(!_storage || _storage.use_count() != 1) {
+			return false;
+		}
+		return std::visit([&](auto& buffer) {
+			return (const uint8_t*)buffer.data() == _data && buffer.size() == _size;
+		}, *_storage);
+	}
+
+	Data SharedData::toData() const& {
+		return view().toData();
+	}
+
+	Data SharedData::toData() && {
+		if(ownsWholeBuffer() && std::holds_alternative<Data>(*_storage)) {
+			Data data = std::move(std::get<Data>(*_storage));
+			_storage.reset();
+			_data = nullptr;
+			_size = 0;
+			return data;
+		}
+		return view().toData();
+	}
+
+	String SharedData::toString() const& {
+		return view().toString();
+	}
+
+	String SharedData::toString() && {
+		if(ownsWholeBuffer() && std::holds_alternative<String>(*_storage)) {
+			String str = std::move(std::get<String>(*_storage));
+			_storage.reset();
+			_data = nullptr;
+			_size = 0;
+			return str;
+		}
+		return view().toString();
+	}
+}
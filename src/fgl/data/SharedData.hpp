@@ -0,0 +1,169 @@
+//
+//  SharedData.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/ArrayList.hpp>
+#include <fgl/data/Data.hpp>
+#include <fgl/data/DataView.hpp>
+#include <fgl/data/String.hpp>
+#include <memory>
+#include <variant>
+
+namespace fgl {
+	/// A reference counted, immutable range of bytes.
+	/// Slices share the buffer of the SharedData they were sliced from, so slicing never copies and keeps the buffer alive.
+	/// The buffer can be a Data or a String, which are moved in and, when nothing else shares them, moved back out without copying.
+	class SharedData {
+	public:
+		using value_type = uint8_t;
+		using size_type = size_t;
+		using const_iterator = const uint8_t*;
+		using iterator = const_iterator;
+
+		static constexpr size_type npos = DataView::npos;
+
+		SharedData() noexcept;
+		SharedData(Data&& data);
+		explicit SharedData(String&& str);
+		/// Copies the given bytes into a new buffer
+		explicit SharedData(DataView bytes);
+
+		inline const uint8_t* data() const noexcept;
+		inline size_type size() const noexcept;
+		inline bool empty() const noexcept;
+		inline const_iterator begin() const noexcept;
+		inline const_iterator end() const noexcept;
+		inline const uint8_t& operator[](size_type index) const noexcept;
+		inline const uint8_t& at(size_type index) const;
+
+		inline DataView view() const noexcept;
+		inline operator DataView() const noexcept;
+
+		/// A slice of count bytes starting at startIndex, sharing this buffer
+		inline SharedData slice(size_type startIndex, size_type count = npos) const;
+		/// Converts a view of this buffer, such as one returned by DataView::split, into a slice sharing this buffer
+		SharedData slice(DataView bytes) const;
+		ArrayList<SharedData> split(uint8_t delimiter) const;
+		ArrayList<SharedData> split(DataView delimiter) const;
+
+		inline size_type indexOf(uint8_t byte, size_type startIndex = 0) const noexcept;
+		inline size_type indexOf(DataView bytes, size_type startIndex = 0) const noexcept;
+		inline bool contains(DataView bytes) const noexcept;
+		inline bool startsWith(DataView bytes) const noexcept;
+		inline bool endsWith(DataView bytes) const noexcept;
+
+		/// The number of SharedData instances sharing this buffer
+		inline long useCount() const noexcept;
+
+		Data toData() const&;
+		/// Moves the buffer out if it's a Data that nothing else shares and this covers all of it. Otherwise copies.
+		Data toData() &&;
+		inline std::string_view stringView() const noexcept;
+		String toString() const&;
+		/// Moves the buffer out if it's a String that nothing else shares and this covers all of it. Otherwise copies.
+		String toString() &&;
+
+	private:
+		using Storage = std::variant<Data,String>;
+
+		SharedData(std::shared_ptr<Storage> storage, const uint8_t* data, size_type size) noexcept;
+
+		/// Whether this is the only owner of the whole buffer
+		bool ownsWholeBuffer() const noexcept;
+
+		std::shared_ptr<Storage> _storage;
+		const uint8_t* _data;
+		size_type _size;
+	};
+
+	inline bool operator==(const SharedData&, const SharedData&) noexcept;
+	inline bool operator!=(const SharedData&, const SharedData&) noexcept;
+
+
+
+#pragma mark SharedData implementation
+
+	const uint8_t* SharedData::data() const noexcept {
+		return _data;
+	}
+
+	SharedData::size_type SharedData::size() const noexcept {
+		return _size;
+	}
+
+	bool SharedData::empty() const noexcept {
+		return _size == 0;
+	}
+
+	SharedData::const_iterator SharedData::begin() const noexcept {
+		return _data;
+	}
+
+	SharedData::const_iterator SharedData::end() const noexcept {
+		return _data + _size;
+	}
+
+	const uint8_t& SharedData::operator[](size_type index) const noexcept {
+		return _data[index];
+	}
+
+	const uint8_t& SharedData::at(size_type index) const {
+		return view().at(index);
+	}
+
+	DataView SharedData::view() const noexcept {
+		return DataView(_data, _size);
+	}
+
+	SharedData::operator DataView() const noexcept {
+		return DataView(_data, _size);
+	}
+
+	SharedData SharedData::slice(size_type startIndex, size_type count) const {
+		auto bytes = view().slice(startIndex, count);
+		return SharedData(_storage, bytes.data(), bytes.size());
+	}
+
+	SharedData::size_type SharedData::indexOf(uint8_t byte, size_type startIndex) const noexcept {
+		return view().indexOf(byte, startIndex);
+	}
+
+	SharedData::size_type SharedData::indexOf(DataView bytes, size_type startIndex) const noexcept {
+		return view().indexOf(bytes, startIndex);
+	}
+
+	bool SharedData::contains(DataView bytes) const noexcept {
+		return view().contains(bytes);
+	}
+
+	bool SharedData::startsWith(DataView bytes) const noexcept {
+		return view().startsWith(bytes);
+	}
+
+	bool SharedData::endsWith(DataView bytes) const noexcept {
+		return view().endsWith(bytes);
+	}
+
+	long SharedData::useCount() const noexcept {
+		return _storage.use_count();
+	}
+
+	std::string_view SharedData::stringView() const noexcept {
+		return view().stringView();
+	}
+
+	bool operator==(const SharedData& left, const SharedData& right) noexcept {
+		return left.view().equals(right.view());
+	}
+
+	bool operator!=(const SharedData& left, const SharedData& right) noexcept {
+		return !left.view().equals(right.view());
+	}
+}
@@ -67,7 +67,11 @@ namespace fgl {
 	using w$ = WeakPtr<T>;
 	template<typename T, typename... Args>
 	$<T> new$(Args&&... args) {
-		return std::make_shared<T>(args...);
+		return std::make_shared<T>(std::forward<Args>(args)...);
+	}
+	template<typename T, typename Allocator, typename... Args>
+	$<T> allocateShared(const Allocator& allocator, Args&&... args) {
+		return std::allocate_shared<T>(allocator, std::forward<Args>(args)...);
 	}
 
 	template<typename T>
@@ -111,7 +115,7 @@ namespace fgl {
 	#pragma mark SharedPtr implementation
 
 	template<typename T>
-	SharedPtr<T>::SharedPtr(std::shared_ptr<T>&& ptr): std::shared_ptr<T>(ptr) {
+	SharedPtr<T>::SharedPtr(std::shared_ptr<T>&& ptr): std::shared_ptr<T>(std::move(ptr)) {
 		//
 	}
 
@@ -176,7 +180,7 @@ namespace fgl {
 	#pragma mark WeakPtr implementation
 
 	template<typename T>
-	WeakPtr<T>::WeakPtr(std::weak_ptr<T>&& ptr): std::weak_ptr<T>(ptr) {
+	WeakPtr<T>::WeakPtr(std::weak_ptr<T>&& ptr): std::weak_ptr<T>(std::move(ptr)) {
 		//
 	}
 
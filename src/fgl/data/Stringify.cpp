@@ -9,11 +9,85 @@
 #include <fgl/data/Stringify.hpp>
 #include <fgl/data/String.hpp>
 #include <cxxabi.h>
+#include <charconv>
+#include <cstdio>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
 
 namespace fgl {
 	std::string demangled_type(std::string const& sym) {
 		std::unique_ptr<char, void(*)(void*)>
 		name{abi::__cxa_demangle(sym.c_str(), nullptr, nullptr, nullptr), std::free};
+		if(!name) {
+			return sym;
+		}
 		return {name.get()};
 	}
+
+	String stringify_type(const std::type_info& type) {
+		static std::mutex typeNamesMutex;
+		static std::unordered_map<std::type_index,String> typeNames;
+		std::unique_lock<std::mutex> lock(typeNamesMutex);
+		auto it = typeNames.find(type);
+		if(it != typeNames.end()) {
+			return it->second;
+		}
+		lock.unlock();
+		String name = demangled_type(type.name());
+		lock.lock();
+		typeNames.emplace(type, name);
+		return name;
+	}
+
+
+
+	namespace {
+		template<typename FloatType>
+		void writeFixedFloat(StringifyWriter& writer, FloatType value, const char* format) {
+			// same output as std::to_string
+			#if defined(__cpp_lib_to_chars) && !defined(__APPLE__)
+				char buffer[128];
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+				if(result.ec == std::errc()) {
+					writer.write(buffer, (size_t)(result.ptr - buffer));
+					return;
+				}
+			#else
+				char buffer[64];
+			#endif
+			int length = std::snprintf(buffer, sizeof(buffer), format, value);
+			if(length < 0) {
+				return;
+			}
+			if((size_t)length < sizeof(buffer)) {
+				writer.write(buffer, (size_t)length);
+				return;
+			}
+			std::string str((size_t)length + 1, '\0');
+			std::snprintf(str.data(), str.size(), format, value);
+			writer.write(str.data(), (size_t)length);
+		}
+	}
+
+	void StringifyWriter::writeFloat(double value) {
+		writeFixedFloat(*this, value, "%f");
+	}
+
+	void StringifyWriter::writeFloat(long double value) {
+		writeFixedFloat(*this, value, "%Lf");
+	}
+
+	void StringifyWriter::writeAddress(std::string_view typeName, const void* ptr) {
+		static constexpr char hexDigits[] = "0123456789abcdef";
+		char buffer[sizeof(uintptr_t) * 2];
+		uintptr_t address = (uintptr_t)ptr;
+		for(size_t i=sizeof(buffer); i>0; i--) {
+			buffer[i-1] = hexDigits[address & 0xF];
+			address >>= 4;
+		}
+		write(typeName);
+		write(" @ 0x", 5);
+		write(buffer, sizeof(buffer));
+	}
 }
@@ -11,10 +11,15 @@
 #include <fgl/data/Common.hpp>
 #include <fgl/data/BasicString.hpp>
 #include <fgl/data/Traits.hpp>
+#include <fgl/data/TypeId.hpp>
 #include <fgl/data/Optional.hpp>
 #include <fgl/data/Variant.hpp>
 #include <fgl/data/SharedPtr.hpp>
-#include <list>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <string_view>
 
 namespace fgl {
 	namespace StringifyUtils {
@@ -50,129 +55,332 @@ namespace fgl {
 
 	template<typename T>
 	String stringify_type() {
-		std::stringstream ss;
-		ss << demangled_type(typeid(T).name());
-		if (std::is_const<typename std::remove_reference<T>::type>::value) {
-			ss << " const";
+		static const String typeName = []() {
+			String name = TypeId::of<T>().name();
+			if (std::is_const<typename std::remove_reference<T>::type>::value) {
+				name += " const";
+			}
+			if (std::is_lvalue_reference<T>::value) {
+				name += " &";
+			}
+			if (std::is_rvalue_reference<T>::value) {
+				name += " &&";
+			}
+			return name;
+		}();
+		return typeName;
+	}
+
+
+	String stringify_type(const std::type_info& type);
+
+
+	/// Limits applied while stringifying, so that logging a large structure stays bounded
+	struct StringifyOptions {
+		/// Collections nested deeper than this are written with "..." in place of their items
+		size_t maxDepth = (size_t)-1;
+		/// Collections with more items than this are cut off with "..."
+		size_t maxItems = (size_t)-1;
+		/// Output past this many characters is dropped and "..." is appended
+		size_t maxLength = (size_t)-1;
+	};
+
+
+	class StringifyWriter;
+
+	template<typename T>
+	void stringifyTo(StringifyWriter& writer, const T& obj);
+	template<typename Sink, typename T>
+	requires (!std::is_same_v<Sink,StringifyWriter>)
+	void stringifyTo(Sink& sink, const T& obj, const StringifyOptions& options = StringifyOptions());
+
+
+	/// Appends stringified values to a sink without building intermediate strings.
+	/// A sink can be a std::ostream or anything with an append(const char*, size_t) function, such as String.
+	/// Types can write themselves directly by declaring void toString(StringifyWriter&) const.
+	class StringifyWriter {
+	public:
+		template<typename Sink>
+		StringifyWriter(Sink& sink, const StringifyOptions& options = StringifyOptions());
+		StringifyWriter(const StringifyWriter&) = delete;
+		StringifyWriter& operator=(const StringifyWriter&) = delete;
+
+		inline void write(const char* str, size_t length);
+		inline void write(const char* str);
+		inline void write(std::string_view str);
+		inline void write(char c);
+		template<typename Integer>
+		void writeInteger(Integer value);
+		void writeFloat(double value);
+		void writeFloat(long double value);
+		void writeAddress(std::string_view typeName, const void* ptr);
+
+		/// Writes the items between open and close, applying the depth and item limits
+		template<typename Iterator>
+		void writeItems(Iterator begin, Iterator end, std::string_view open, std::string_view separator, std::string_view close);
+		template<typename Iterator, typename WriteItem>
+		void writeItems(Iterator begin, Iterator end, std::string_view open, std::string_view separator, std::string_view close, WriteItem writeItem);
+
+		inline const StringifyOptions& options() const noexcept;
+		/// The number of characters written so far
+		inline size_t length() const noexcept;
+		/// Whether output was dropped because the length limit was reached
+		inline bool isTruncated() const noexcept;
+
+	private:
+		using AppendFunc = void(*)(void* sink, const char* str, size_t length);
+
+		void* _sink;
+		AppendFunc _append;
+		StringifyOptions _options;
+		size_t _length;
+		size_t _depth;
+		bool _truncated;
+	};
+
+
+	template<typename T>
+	String stringify(const T& obj, const StringifyOptions& options = StringifyOptions());
+
+
+
+#pragma mark StringifyWriter implementation
+
+	template<typename Sink>
+	StringifyWriter::StringifyWriter(Sink& sink, const StringifyOptions& options)
+	: _sink(&sink),
+	_append([](void* sink, const char* str, size_t length) {
+		if constexpr(std::is_base_of_v<std::ostream,Sink>) {
+			static_cast<Sink*>(sink)->write(str, (std::streamsize)length);
+		} else {
+			static_cast<Sink*>(sink)->append(str, length);
 		}
-		if (std::is_lvalue_reference<T>::value) {
-			ss << " &";
+	}),
+	_options(options),
+	_length(0),
+	_depth(0),
+	_truncated(false) {
+		//
+	}
+
+	void StringifyWriter::write(const char* str, size_t length) {
+		if(_truncated) {
+			return;
 		}
-		if (std::is_rvalue_reference<T>::value) {
-			ss << " &&";
+		size_t remaining = _options.maxLength - _length;
+		if(length > remaining) {
+			_append(_sink, str, remaining);
+			_append(_sink, "...", 3);
+			_length = _options.maxLength;
+			_truncated = true;
+			return;
 		}
-		return ss.str();
+		_append(_sink, str, length);
+		_length += length;
+	}
+
+	void StringifyWriter::write(const char* str) {
+		write(str, std::strlen(str));
 	}
 
+	void StringifyWriter::write(std::string_view str) {
+		write(str.data(), str.size());
+	}
+
+	void StringifyWriter::write(char c) {
+		write(&c, 1);
+	}
 
-	inline String stringify_type(const std::type_info& type) {
-		return demangled_type(type.name());
+	template<typename Integer>
+	void StringifyWriter::writeInteger(Integer value) {
+		// promote character types so that to_chars accepts them
+		using PromotedType = decltype(+value);
+		char buffer[std::numeric_limits<PromotedType>::digits10 + 3];
+		auto result = std::to_chars(buffer, buffer + sizeof(buffer), +value);
+		write(buffer, (size_t)(result.ptr - buffer));
 	}
 
+	template<typename Iterator>
+	void StringifyWriter::writeItems(Iterator begin, Iterator end, std::string_view open, std::string_view separator, std::string_view close) {
+		writeItems(begin, end, open, separator, close, [&](const auto& item) {
+			stringifyTo(*this, item);
+		});
+	}
+
+	template<typename Iterator, typename WriteItem>
+	void StringifyWriter::writeItems(Iterator begin, Iterator end, std::string_view open, std::string_view separator, std::string_view close, WriteItem writeItem) {
+		write(open);
+		if(_depth >= _options.maxDepth) {
+			write("...", 3);
+		} else {
+			_depth++;
+			size_t count = 0;
+			for(auto it=begin; it!=end && !_truncated; it++) {
+				if(count != 0) {
+					write(separator);
+				}
+				if(count == _options.maxItems) {
+					write("...", 3);
+					break;
+				}
+				writeItem(*it);
+				count++;
+			}
+			_depth--;
+		}
+		write(close);
+	}
+
+	const StringifyOptions& StringifyWriter::options() const noexcept {
+		return _options;
+	}
+
+	size_t StringifyWriter::length() const noexcept {
+		return _length;
+	}
+
+	bool StringifyWriter::isTruncated() const noexcept {
+		return _truncated;
+	}
+
+
+
+#pragma mark stringify implementation
 
 	template<typename T>
-	String stringify(const T& obj) {
+	void stringifyTo(StringifyWriter& writer, const T& obj) {
 		using Type = std::remove_cvref_t<T>;
 		if constexpr(std::is_same<T,std::nullptr_t>::value) {
-			return "nullptr_t";
+			writer.write("nullptr_t");
+		}
+		else if constexpr(std::is_same<char,Type>::value) {
+			writer.write(obj);
 		}
 		else if constexpr(std::is_same<String,Type>::value || std::is_same<std::string,Type>::value
-		   || std::is_same<char*,Type>::value || std::is_same<const char*,Type>::value || std::is_same<char,Type>::value
-		   || std::is_same<std::wstring,Type>::value || std::is_same<const wchar_t*,Type>::value
+		   || std::is_same<char*,Type>::value || std::is_same<const char*,Type>::value) {
+			writer.write(std::string_view(obj));
+		}
+		else if constexpr(std::is_same<std::wstring,Type>::value || std::is_same<const wchar_t*,Type>::value
 		   || std::is_same<wchar_t*,Type>::value || std::is_same<wchar_t,Type>::value) {
-			return (String)obj;
+			writer.write((String)obj);
 		}
 		else if constexpr(is_variant<Type>::value) {
-			if(obj.valueless_by_exception()) {
-				return "Variant{##INVALID##}";
+			if constexpr(requires { obj.valueless_by_exception(); }) {
+				if(obj.valueless_by_exception()) {
+					writer.write("Variant{##INVALID##}");
+					return;
+				}
 			}
-			return String::join("Variant{ ",std::visit([](auto& val) {
-				return stringify(val);
-			}, obj)," }");
+			writer.write("Variant{ ");
+			visitVariants([&](auto& val) {
+				stringifyTo(writer, val);
+			}, obj);
+			writer.write(" }");
 		}
 		else if constexpr(is_optional<Type>::value) {
-			return obj ? String::join({"Optional{ ",stringify(obj.value())," }"}) : "Optional{}";
+			if(obj) {
+				writer.write("Optional{ ");
+				stringifyTo(writer, obj.value());
+				writer.write(" }");
+			} else {
+				writer.write("Optional{}");
+			}
 		}
 		else if constexpr(is_weak_ptr<Type>::value) {
-			return String::join({"weak_ptr<",stringify_type<typename is_weak_ptr<Type>::content_type>(),">(use_count=",std::to_string(obj.use_count()),")"});
+			writer.write("weak_ptr<");
+			writer.write(stringify_type<typename is_weak_ptr<Type>::content_type>());
+			writer.write(">(use_count=");
+			writer.writeInteger(obj.use_count());
+			writer.write(")");
 		}
 		else if constexpr(is_ptr_container<Type>::value) {
 			if(obj == nullptr) {
-				return "null";
+				writer.write("null");
+				return;
 			}
-			return stringify<typename is_ptr_container<Type>::content_type*>(obj.get());
+			stringifyTo<typename is_ptr_container<Type>::content_type*>(writer, obj.get());
 		}
 		else if constexpr(is_pair<Type>::value) {
-			return String::join({"pair( ",stringify(obj.first)," , ",stringify(obj.second)," )"});
+			writer.write("pair( ");
+			stringifyTo(writer, obj.first);
+			writer.write(" , ");
+			stringifyTo(writer, obj.second);
+			writer.write(" )");
 		}
 		else if constexpr(std::is_array<Type>::value) {
 			size_t arraySize = sizeof(Type) / sizeof(typename std::remove_extent<Type>::type);
 			if(arraySize == 0) {
-				return "[]";
-			}
-			std::list<String> strParts;
-			strParts.push_back("[ ");
-			for(size_t i=0; i<arraySize; i++) {
-				if(i != 0) {
-					strParts.push_back(", ");
-				}
-				strParts.push_back(stringify(obj[i]));
+				writer.write("[]");
+				return;
 			}
-			strParts.push_back(" ]");
-			return String::join(strParts);
+			writer.writeItems(obj, obj + arraySize, "[ ", ", ", " ]");
 		}
 		else if constexpr(std::is_pointer<Type>::value) {
 			if(obj == nullptr) {
-				return "null";
+				writer.write("null");
+				return;
 			}
 			using U = typename std::remove_pointer<Type>::type;
-			if(std::is_class<U>::value || std::is_arithmetic<U>::value) {
-				return stringify(*obj);
+			if constexpr(std::is_class<U>::value || std::is_arithmetic<U>::value) {
+				stringifyTo(writer, *obj);
 			} else {
-				std::stringstream ss;
-				ss << stringify_type<U>() << " @ 0x" << std::setfill('0') << std::setw(sizeof(obj)*2) << std::hex << ((uintptr_t)obj);
-				return ss.str();
+				writer.writeAddress(stringify_type<U>(), (const void*)obj);
 			}
 		}
 		else if constexpr(std::is_same<bool,Type>::value && !std::is_same<unsigned char,Type>::value) {
-			return obj ? "true" : "false";
+			writer.write(obj ? "true" : "false");
+		}
+		else if constexpr(std::is_integral<Type>::value) {
+			writer.writeInteger(obj);
+		}
+		else if constexpr(std::is_floating_point<Type>::value) {
+			if constexpr(std::is_same<long double,Type>::value) {
+				writer.writeFloat(obj);
+			} else {
+				writer.writeFloat((double)obj);
+			}
 		}
-		else if constexpr(std::is_arithmetic<Type>::value) {
-			return std::to_string(obj);
+		else if constexpr(requires(StringifyWriter& w) { obj.toString(w); }) {
+			obj.toString(writer);
 		}
 		else if constexpr(StringifyUtils::has_members<Type>::toString) {
-			return obj.toString();
+			writer.write(obj.toString());
 		}
 		else if constexpr(StringifyUtils::has_members<Type>::to_string) {
-			return obj.to_string();
+			writer.write(obj.to_string());
 		}
 		else if constexpr(std::is_base_of<std::exception,Type>::value) {
-			return obj.what();
+			writer.write(obj.what());
 		}
 		else if constexpr(is_collection<Type>::value) {
 			auto begin = obj.begin();
 			auto end = obj.end();
 			if(begin == end) {
-				return "[]";
-			}
-			std::list<String> strParts;
-			strParts.push_back("[ ");
-			for(auto it=begin; it!=end; it++) {
-				if(it != begin) {
-					strParts.push_back(", ");
-				}
-				strParts.push_back(stringify(*it));
+				writer.write("[]");
+				return;
 			}
-			strParts.push_back(" ]");
-			return String::join(strParts);
+			writer.writeItems(begin, end, "[ ", ", ", " ]");
 		}
 		else {
-			std::stringstream ss;
-			ss << stringify_type<T>() << " @ 0x" << std::setfill('0') << std::setw(sizeof(&obj)*2) << std::hex << ((uintptr_t)&obj);
-			return ss.str();
+			writer.writeAddress(stringify_type<T>(), (const void*)&obj);
 		}
 	}
 
+	template<typename Sink, typename T>
+	requires (!std::is_same_v<Sink,StringifyWriter>)
+	void stringifyTo(Sink& sink, const T& obj, const StringifyOptions& options) {
+		StringifyWriter writer(sink, options);
+		stringifyTo(writer, obj);
+	}
+
+	template<typename T>
+	String stringify(const T& obj, const StringifyOptions& options) {
+		String str;
+		StringifyWriter writer(str, options);
+		stringifyTo<T>(writer, obj);
+		return str;
+	}
+
 	#ifndef STRINGIFY_TOKEN
 		#define STRINGIFY_TOKEN(token) #token
 	#endif
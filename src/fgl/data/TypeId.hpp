@@ -0,0 +1,120 @@
+//
+//  TypeId.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/BasicString.hpp>
+#include <functional>
+#include <typeinfo>
+
+namespace fgl {
+	std::string demangled_type(std::string const& sym);
+
+	/// The name TypeId and stringify_type give a type. Specialize this to replace the demangled name of a type.
+	template<typename T>
+	struct type_name {
+		static String value() {
+			return demangled_type(typeid(T).name());
+		}
+	};
+
+	/// Strings with the default allocator keep the spelling they had before BasicString took an allocator
+	template<typename Char>
+	struct type_name<BasicString<Char>> {
+		static String value() {
+			return "fgl::BasicString<" + type_name<Char>::value() + ">";
+		}
+	};
+
+	/// A lightweight type identifier. Each type is identified by the address of a static tag, so equal types usually compare with a single pointer compare.
+	/// With hidden visibility, or across shared libraries, one type can have a tag in each binary, so tags at different addresses fall back to comparing std::type_info.
+	/// cv-qualifiers and references are stripped, matching the behavior of typeid.
+	/// The demangled name of a type is only computed the first time it is requested.
+	class TypeId {
+	private:
+		struct Info {
+			const std::type_info* type;
+			const String& (*name)();
+		};
+
+		template<typename T>
+		struct Tag {
+			static const String& name();
+			static constexpr Info info = { &typeid(T), &Tag<T>::name };
+		};
+
+		constexpr explicit TypeId(const Info* info) noexcept;
+
+		const Info* _info;
+
+	public:
+		/// Gets the identifier for the type T
+		template<typename T>
+		static constexpr TypeId of() noexcept;
+
+		/// Constructs the identifier for void
+		constexpr TypeId() noexcept;
+
+		inline bool operator==(const TypeId&) const noexcept;
+		inline bool operator!=(const TypeId&) const noexcept;
+
+		/// Gets the demangled name of the type. This is cached after the first call.
+		inline const String& name() const;
+		inline size_t hash() const noexcept;
+	};
+
+
+
+	#pragma mark TypeId implementation
+
+	template<typename T>
+	const String& TypeId::Tag<T>::name() {
+		static const String name = type_name<T>::value();
+		return name;
+	}
+
+	constexpr TypeId::TypeId(const Info* info) noexcept: _info(info) {
+		//
+	}
+
+	constexpr TypeId::TypeId() noexcept: _info(&Tag<void>::info) {
+		//
+	}
+
+	template<typename T>
+	constexpr TypeId TypeId::of() noexcept {
+		return TypeId(&Tag<std::remove_cv_t<std::remove_reference_t<T>>>::info);
+	}
+
+	bool TypeId::operator==(const TypeId& typeId) const noexcept {
+		return _info == typeId._info || *_info->type == *typeId._info->type;
+	}
+
+	bool TypeId::operator!=(const TypeId& typeId) const noexcept {
+		return !(*this == typeId);
+	}
+
+	const String& TypeId::name() const {
+		return _info->name();
+	}
+
+	size_t TypeId::hash() const noexcept {
+		// hashed by type_info, so that equal types from different binaries hash the same
+		return _info->type->hash_code();
+	}
+}
+
+namespace std {
+	template<>
+	struct hash<fgl::TypeId> {
+		inline size_t operator()(const fgl::TypeId& typeId) const noexcept {
+			return typeId.hash();
+		}
+	};
+}
@@ -7,13 +7,27 @@
 //
 
 #include "URL.hpp"
+#include <fgl/data/Parallel.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+
+#if !defined(FGL_URL_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	#define FGL_URL_SIMD_SSE2
+#elif !defined(FGL_URL_DISABLE_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+	#include <arm_neon.h>
+	#define FGL_URL_SIMD_NEON
+#endif
 
 namespace fgl {
 	#pragma mark URL encoding / decoding / validating
 
 	// code adapted from https://github.com/chmike/CxxUrl/blob/master/url.cpp
 
-	static const uint8_t URL_chars_table[256] = {
+	static constexpr uint8_t URL_chars_table[256] = {
 		0,0,0,0, 0,0,0,0,     // NUL SOH STX ETX  EOT ENQ ACK BEL
 		0,0,0,0, 0,0,0,0,     // BS  HT  LF  VT   FF  CR  SO  SI
 		0,0,0,0, 0,0,0,0,     // DLE DC1 DC2 DC3  DC4 NAK SYN ETB
@@ -36,7 +50,7 @@ namespace fgl {
 		0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0
 	};
 
-	inline bool is_char(char c, std::uint8_t mask) {
+	constexpr bool is_char(char c, std::uint8_t mask) {
 		return (URL_chars_table[static_cast<unsigned char>(c)]&mask) != 0;
 	}
 
@@ -115,58 +129,290 @@ namespace fgl {
 
 
 
-	String URL::encodeComponent(const std::string& str, Function<bool(char)> shouldEncodeChar, const std::map<char,char>& mappedChars) {
-		std::ostringstream encoded;
-		encoded.fill('0');
-		encoded << std::hex;
-		
-		for(char c : str) {
-			auto mappedCharIt = mappedChars.find(c);
-			if(mappedCharIt != mappedChars.end()) {
-				encoded << mappedCharIt->second;
+	// how each byte of a component is written when encoding it
+	enum : uint8_t {
+		URL_ENCODE_COPY = 0,
+		URL_ENCODE_PERCENT = 1,
+		URL_ENCODE_PLUS = 2
+	};
+
+	using URL_EncodingTable = std::array<uint8_t,256>;
+
+	template<typename ShouldEncode>
+	constexpr URL_EncodingTable URL_makeEncodingTable(ShouldEncode shouldEncode, bool spaceAsPlus) {
+		URL_EncodingTable table = {};
+		for(size_t i=0; i<256; i++) {
+			char c = (char)i;
+			if(spaceAsPlus && c == ' ') {
+				table[i] = URL_ENCODE_PLUS;
+			} else if(shouldEncode(c)) {
+				table[i] = URL_ENCODE_PERCENT;
+			} else {
+				table[i] = URL_ENCODE_COPY;
 			}
-			else if(shouldEncodeChar(c)) {
-				encoded << std::uppercase;
-				encoded << '%' << std::setw(2) << int((unsigned char)c);
-				encoded << std::nouppercase;
+		}
+		return table;
+	}
+
+	constexpr auto URL_userEncodingTable = URL_makeEncodingTable([](char c) {
+		return !is_char(c, 0x05);
+	}, false);
+	constexpr auto URL_pathPartEncodingTable = URL_makeEncodingTable([](char c) {
+		return !is_char(c, 0x0F) || c == '/';
+	}, false);
+	constexpr auto URL_queryKeyEncodingTable = URL_makeEncodingTable([](char c) {
+		return c == '+' || c == '=' || c == '&' || c == ';' || !is_char(c, 0x1F);
+	}, true);
+	constexpr auto URL_queryValueEncodingTable = URL_makeEncodingTable([](char c) {
+		return c == '+' || c == '&' || c == ';' || !is_char(c, 0x1F);
+	}, true);
+
+	/// Letters, digits and - . _ ~, which no component encodes
+	constexpr bool URL_isUnreserved(char c) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+			|| c == '-' || c == '.' || c == '_' || c == '~';
+	}
+
+	constexpr bool URL_copiesUnreserved(const URL_EncodingTable& table) {
+		for(size_t i=0; i<256; i++) {
+			if(URL_isUnreserved((char)i) && table[i] != URL_ENCODE_COPY) {
+				return false;
 			}
-			else {
-				encoded << c;
+		}
+		return true;
+	}
+
+	static_assert(URL_copiesUnreserved(URL_userEncodingTable) && URL_copiesUnreserved(URL_pathPartEncodingTable)
+		&& URL_copiesUnreserved(URL_queryKeyEncodingTable) && URL_copiesUnreserved(URL_queryValueEncodingTable),
+		"unreserved characters are copied without checking the encoding table");
+
+	/// The value of each byte as a hex digit. Invalid digits decode to the same values they always have, rather than being rejected.
+	constexpr std::array<uint8_t,256> URL_makeHexValueTable() {
+		std::array<uint8_t,256> table = {};
+		for(size_t i=0; i<256; i++) {
+			char c = (char)i;
+			if(c >= '0' && c <= '9') {
+				table[i] = (uint8_t)(c - '0');
+			} else {
+				char lower = (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+				table[i] = (uint8_t)(lower - 'a' + 10);
 			}
 		}
-		
-		return encoded.str();
+		return table;
+	}
+
+	constexpr auto URL_hexValues = URL_makeHexValueTable();
+
+	/// The length of the run of unreserved characters at the start of the range
+	inline size_t URL_unreservedLength(const char* begin, const char* end) {
+		const char* it = begin;
+		#if defined(FGL_URL_SIMD_SSE2)
+		const __m128i caseBit = _mm_set1_epi8(0x20);
+		while((end - it) >= 16) {
+			__m128i chunk = _mm_loadu_si128((const __m128i*)it);
+			// subtracting the start of a range wraps everything outside of it above the range's size
+			__m128i letterOffset = _mm_sub_epi8(_mm_or_si128(chunk, caseBit), _mm_set1_epi8('a'));
+			__m128i digitOffset = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+			__m128i unreserved = _mm_or_si128(
+				_mm_or_si128(
+					_mm_cmpeq_epi8(_mm_min_epu8(letterOffset, _mm_set1_epi8(25)), letterOffset),
+					_mm_cmpeq_epi8(_mm_min_epu8(digitOffset, _mm_set1_epi8(9)), digitOffset)),
+				_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('-')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('.'))),
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~')))));
+			unsigned int mask = (unsigned int)_mm_movemask_epi8(unreserved);
+			if(mask != 0xFFFF) {
+				return (size_t)(it - begin) + (size_t)std::countr_one(mask);
+			}
+			it += 16;
+		}
+		#elif defined(FGL_URL_SIMD_NEON)
+		const uint8x16_t caseBit = vdupq_n_u8(0x20);
+		while((end - it) >= 16) {
+			uint8x16_t chunk = vld1q_u8((const uint8_t*)it);
+			// subtracting the start of a range wraps everything outside of it above the range's size
+			uint8x16_t letterOffset = vsubq_u8(vorrq_u8(chunk, caseBit), vdupq_n_u8('a'));
+			uint8x16_t digitOffset = vsubq_u8(chunk, vdupq_n_u8('0'));
+			uint8x16_t unreserved = vorrq_u8(
+				vorrq_u8(vcleq_u8(letterOffset, vdupq_n_u8(25)), vcleq_u8(digitOffset, vdupq_n_u8(9))),
+				vorrq_u8(
+					vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('-')), vceqq_u8(chunk, vdupq_n_u8('.'))),
+					vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('_')), vceqq_u8(chunk, vdupq_n_u8('~')))));
+			if(vminvq_u8(unreserved) != 0xFF) {
+				// the scalar loop below finds the exact position
+				break;
+			}
+			it += 16;
+		}
+		#endif
+		while(it != end && URL_isUnreserved(*it)) {
+			it++;
+		}
+		return (size_t)(it - begin);
+	}
+
+	/// Finds the next '%', or the next '+' if plus is given as the special character too
+	inline const char* URL_findEscape(const char* it, const char* end, char plus) {
+		#if defined(FGL_URL_SIMD_SSE2)
+		const __m128i percentChar = _mm_set1_epi8('%');
+		const __m128i plusChar = _mm_set1_epi8(plus);
+		while((end - it) >= 16) {
+			__m128i chunk = _mm_loadu_si128((const __m128i*)it);
+			unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, percentChar), _mm_cmpeq_epi8(chunk, plusChar)));
+			if(mask != 0) {
+				return it + std::countr_zero(mask);
+			}
+			it += 16;
+		}
+		#elif defined(FGL_URL_SIMD_NEON)
+		const uint8x16_t percentChar = vdupq_n_u8('%');
+		const uint8x16_t plusChar = vdupq_n_u8((uint8_t)plus);
+		while((end - it) >= 16) {
+			uint8x16_t chunk = vld1q_u8((const uint8_t*)it);
+			if(vmaxvq_u8(vorrq_u8(vceqq_u8(chunk, percentChar), vceqq_u8(chunk, plusChar))) != 0) {
+				break;
+			}
+			it += 16;
+		}
+		#endif
+		while(it != end && *it != '%' && *it != plus) {
+			it++;
+		}
+		return it;
+	}
+
+
+
+	/// Copies a run of bytes between escapes. Runs are often only a few bytes long, so they're copied with fixed size moves rather than a call to memcpy.
+	inline char* URL_copyRun(char* out, const char* begin, size_t length) {
+		if(length >= 16) {
+			std::memcpy(out, begin, length);
+		} else if(length >= 8) {
+			std::memcpy(out, begin, 8);
+			std::memcpy(out + length - 8, begin + length - 8, 8);
+		} else if(length >= 4) {
+			std::memcpy(out, begin, 4);
+			std::memcpy(out + length - 4, begin + length - 4, 4);
+		} else if(length > 0) {
+			out[0] = begin[0];
+			out[length / 2] = begin[length / 2];
+			out[length - 1] = begin[length - 1];
+		}
+		return out + length;
+	}
+
+
+
+	/// The length of a range once it's encoded. changed is set to whether encoding would modify it at all.
+	inline size_t URL_encodedLength(const char* begin, const char* end, const uint8_t* encodingTable, bool& changed) {
+		size_t encodedSize = (size_t)(end - begin);
+		changed = false;
+		const char* it = begin;
+		while(it != end) {
+			if(URL_isUnreserved(*it)) {
+				it += URL_unreservedLength(it, end);
+				continue;
+			}
+			uint8_t encoding = encodingTable[(uint8_t)*it];
+			if(encoding == URL_ENCODE_PERCENT) {
+				encodedSize += 2;
+			}
+			changed = changed || (encoding != URL_ENCODE_COPY);
+			it++;
+		}
+		return encodedSize;
+	}
+
+	/// Encodes a range into out, which must have room for its encoded length, and returns the end of the written bytes
+	inline char* URL_encodeInto(char* out, const char* begin, const char* end, const uint8_t* encodingTable) {
+		const char* hexDigits = "0123456789ABCDEF";
+		const char* it = begin;
+		while(it != end) {
+			uint8_t c = (uint8_t)*it;
+			if(URL_isUnreserved((char)c)) {
+				// copy runs that don't need encoding all at once
+				size_t runLength = URL_unreservedLength(it, end);
+				out = URL_copyRun(out, it, runLength);
+				it += runLength;
+				continue;
+			}
+			switch(encodingTable[c]) {
+				case URL_ENCODE_PERCENT:
+					out[0] = '%';
+					out[1] = hexDigits[c >> 4];
+					out[2] = hexDigits[c & 0x0F];
+					out += 3;
+					break;
+				case URL_ENCODE_PLUS:
+					*out = '+';
+					out++;
+					break;
+				default:
+					*out = (char)c;
+					out++;
+					break;
+			}
+			it++;
+		}
+		return out;
+	}
+
+	String URL::encodeComponent(StringView str, const uint8_t* encodingTable) {
+		const char* begin = str.data();
+		const char* end = begin + str.length();
+		// size the output first, so that it's only allocated once
+		bool changed = false;
+		size_t encodedSize = URL_encodedLength(begin, end, encodingTable, changed);
+		if(!changed) {
+			return String(begin, end);
+		}
+		String encoded;
+		encoded.resize(encodedSize);
+		URL_encodeInto(encoded.data(), begin, end, encodingTable);
+		return encoded;
 	}
 
 
-	String URL::decodeComponent(const char* str_begin, const char* str_end, const std::map<char,char>& mappedChars) {
+	String URL::decodeComponent(const char* str_begin, const char* str_end, bool plusAsSpace) {
+		// '+' is only special when decoding queries, otherwise the search looks for '%' twice
+		char plus = plusAsSpace ? '+' : '%';
+		const char* escape = URL_findEscape(str_begin, str_end, plus);
+		if(escape == str_end) {
+			return String(str_begin, str_end);
+		}
+		// decoding never makes a component longer
 		String decoded;
-		decoded.reserve(str_end - str_begin);
-		
-		auto from_hex = [](char ch) -> char {
-			return isdigit(ch) ? ch - '0' : tolower(ch) - 'a' + 10;
-		};
-		for (auto it=str_begin, end=str_end; it != end; it++) {
-			char c = (*it);
-			auto mappedCharIt = mappedChars.find(c);
-			if(mappedCharIt != mappedChars.end()) {
-				decoded += mappedCharIt->second;
+		decoded.resize(str_end - str_begin);
+		char* out = decoded.data();
+		const char* it = str_begin;
+		while(true) {
+			out = URL_copyRun(out, it, (size_t)(escape - it));
+			it = escape;
+			if(it == str_end) {
+				break;
 			}
-			else if (c == '%' && it[1] && it[2]) {
-				char h = (from_hex(it[1]) << 4) | from_hex(it[2]);
-				decoded += h;
-				it += 2;
+			if(*it == '%' && (str_end - it) > 2) {
+				*out = (char)((URL_hexValues[(uint8_t)it[1]] << 4) | URL_hexValues[(uint8_t)it[2]]);
+				it += 3;
+			}
+			else if(*it == '+' && plusAsSpace) {
+				*out = ' ';
+				it++;
 			}
 			else {
-				decoded += c;
+				*out = *it;
+				it++;
 			}
+			out++;
+			escape = URL_findEscape(it, str_end, plus);
 		}
+		decoded.resize(out - decoded.data());
 		return decoded;
 	}
 
 
 	String URL::encodeUserComponent(const std::string& str) {
-		return encodeComponent(str, [](char c) { return !is_char(c, 0x05); });
+		return encodeComponent(str, URL_userEncodingTable.data());
 	}
 
 	String URL::decodeUserComponent(const char* begin, const char* end) {
@@ -179,7 +425,7 @@ namespace fgl {
 
 
 	String URL::encodePathPart(const std::string& str) {
-		return encodeComponent(str, [](char c) { return !is_char(c, 0x0F) || c == '/'; });
+		return encodeComponent(str, URL_pathPartEncodingTable.data());
 	}
 
 	String URL::decodePathPart(const char* begin, const char* end) {
@@ -192,18 +438,11 @@ namespace fgl {
 
 
 	String URL::encodeQueryKey(const std::string& str) {
-		return encodeComponent(str, [](char c) {
-			return c == '+' || c == '=' || c == '&' || c == ';'
-				|| !is_char(c, 0x1F);
-		}, {
-			{ ' ', '+' }
-		});
+		return encodeComponent(str, URL_queryKeyEncodingTable.data());
 	}
 
 	String URL::decodeQueryKey(const char* begin, const char* end) {
-		return decodeComponent(begin, end, {
-			{ '+', ' ' }
-		});
+		return decodeComponent(begin, end, true);
 	}
 
 	String URL::decodeQueryKey(const std::string& str) {
@@ -212,18 +451,11 @@ namespace fgl {
 
 
 	String URL::encodeQueryValue(const std::string& str) {
-		return encodeComponent(str, [](char c) {
-			return c == '+' || c == '&' || c == ';'
-				|| !is_char(c, 0x1F);
-		}, {
-			{ ' ', '+' }
-		});
+		return encodeComponent(str, URL_queryValueEncodingTable.data());
 	}
 
 	String URL::decodeQueryValue(const char* begin, const char* end) {
-		return decodeComponent(begin, end, {
-			{ '+', ' ' }
-		});
+		return decodeComponent(begin, end, true);
 	}
 
 	String URL::decodeQueryValue(const std::string& str) {
@@ -266,7 +498,7 @@ namespace fgl {
 		}
 		if(*begin == '[' && *(end-1) == ']') {
 			// detect ipvfuture
-			if(*(begin+1) == 'v' && is_hexdigit(*(begin+2))) {
+			if((end - begin) > 3 && *(begin+1) == 'v' && is_hexdigit(*(begin+2))) {
 				return true;
 			}
 			// detect ipv6
@@ -351,189 +583,158 @@ namespace fgl {
 
 
 
+	void URL_appendPathParts(LinkedList<String>& parts, StringView path) {
+		if(path.empty()) {
+			return;
+		}
+		auto begin = path.data();
+		auto end = begin + path.length();
+		auto it = begin;
+		// ignore leading slash if available
+		if(*it == '/') {
+			it++;
+		}
+		auto lastStart = it;
+		while(it != end) {
+			if(*it == '/') {
+				parts.pushBack(URL::decodePathPart(lastStart, it));
+				it++;
+				lastStart = it;
+			}
+			else {
+				it++;
+			}
+		}
+		if(lastStart != it) {
+			parts.pushBack(URL::decodePathPart(lastStart, it));
+		}
+	}
+
+	void URL_appendQueryItems(LinkedList<URL::QueryItem>& items, StringView queryString) {
+		if(queryString.empty()) {
+			return;
+		}
+		auto begin = queryString.data();
+		auto end = begin + queryString.length();
+		auto it = begin;
+		auto lastStart = begin;
+		while(it != end) {
+			if(*it == '&') {
+				items.pushBack(URL::QueryItem::parse(lastStart, it));
+				it++;
+				lastStart = it;
+			}
+			else {
+				it++;
+			}
+		}
+		if(lastStart != it) {
+			items.pushBack(URL::QueryItem::parse(lastStart, it));
+		}
+	}
+
+
+
+	inline void URL_lowercaseASCII(String& str) {
+		for(auto& c : str) {
+			if(c >= 'A' && c <= 'Z') {
+				c = (char)(c + ('a' - 'A'));
+			}
+		}
+	}
+
+	/// The port a scheme uses when none is given, or 0 if it doesn't have one. The scheme must already be lowercase.
+	inline uint16_t URL_defaultPort(const String& scheme) {
+		if(scheme == "http" || scheme == "ws") {
+			return 80;
+		} else if(scheme == "https" || scheme == "wss") {
+			return 443;
+		} else if(scheme == "ftp") {
+			return 21;
+		}
+		return 0;
+	}
+
+
+
 	#pragma mark URL::Components
 
 	URL::Components::Components() {
 		//
 	}
 
-	URL::Components::Components(const std::string& str) {
-		if (str.empty()) {
-			throw std::invalid_argument("Empty string is not a valid URL");
-		}
-		
-		const char *s=str.data(), *e=s+str.length();
-		const char *scheme_b, *scheme_e, *user_b, *user_e, *host_b, *host_e,
-				*port_b, *port_e, *path_b, *path_e, *query_b, *query_e,
-				*fragment_b, *fragment_e;
-		scheme_b=scheme_e=user_b=user_e=host_b=host_e=port_b=port_e=path_b=
-				path_e=query_b=query_e=fragment_b=fragment_e=nullptr;
+	URL::Components::Components(const std::string& str)
+	: Components(URLView(str)) {
+		//
+	}
 
-		const char *b=s, *p=find_first_of(b, e, ":/?#");
-		if (p==e) {
-			// character for end of scheme wasn't found, so entire URL is likely a path
-			if (!isPathValid(b, p)) {
-				// path is invalid
-				throw std::invalid_argument("Path '"+std::string(b,p)+"' in '"+str+"' is invalid");
+	URL::Components::Components(const URLView& url, bool normalize) {
+		if(auto urlScheme = url.scheme()) {
+			this->scheme = String(urlScheme.value());
+			if(normalize) {
+				URL_lowercaseASCII(this->scheme.value());
 			}
-			// entire URL is a path
-			path_b=b;
-			path_e=e;
-		} else {
-			// get schema if any
-			if (*p==':') {
-				if (!isSchemeValid(b, p)) {
-					// scheme is invalid
-					throw std::invalid_argument("Scheme in '"+str+"' is invalid");
-				}
-				scheme_b=b;
-				scheme_e=p;
-				// bump beginning past scheme, find next stop character
-				b=p+1;
-				p=find_first_of(b, e, "/?#");
-			}
-			// get authority if any
-			if (p!=e && *p=='/' && (e-b)>1 && b[0]=='/' && b[1]=='/') {
-				// bump beginning past slashes
-				b+=2;
-				// locate end of authority
-				const char* ea=find_first_of(b, e, "/?#");
-				p=find_char(b, ea, '@');
-				// get user info if any
-				if (p!=ea) {
-					// found @ symbol to end authority component, so validate user authority string
-					if (!is_chars(b, p, 0x25)) {
-						// user info is invalid
-						throw std::invalid_argument("User info in '"+str+"' is invalid");
-					}
-					user_b=b;
-					user_e=p;
-					// bump beginning past user authority
-					b=p+1;
-				}
-				// get IP literal if any
-				if (*b=='[') {
-					// locate end of IP literal
-					p=find_char(b+1, ea, ']');
-					if (*p!=']') {
-						// missing ending ]
-						throw std::invalid_argument("Missing ] in '"+str+"'");
-					}
-					if(!isHostValid(b, p+1)) {
-						// host is invalid
-						throw std::invalid_argument("Host address in '"+str+"' is invalid");
-					}
-					host_b=b;
-					host_e=p+1;
-					b=p+1;
-				}
-				// get host
-				else {
-					p=find_char(b, ea, ':');
-					if (!isHostValid(b, p)) {
-						// host is invalid
-						throw std::invalid_argument("Host address in '"+str+"' is invalid");
-					}
-					host_b=b;
-					host_e=p;
-					b=p;
+		}
+		this->username = url.decodedUsername();
+		this->password = url.decodedPassword();
+		this->host = url.decodedHost();
+		if(normalize && this->host) {
+			URL_lowercaseASCII(this->host.value());
+		}
+		this->port = url.port();
+		if(normalize && this->port && this->scheme && this->port.value() == URL_defaultPort(this->scheme.value())) {
+			this->port = std::nullopt;
+		}
+		auto urlPath = url.path();
+		// dot segments only have a fixed meaning in absolute paths
+		bool resolveDotSegments = normalize && !urlPath.empty() && urlPath[0] == '/';
+		const char* path_b = urlPath.data();
+		const char* path_e = path_b + urlPath.length();
+		LinkedList<String> pathParts;
+		auto appendPathPart = [&](const char* part_b, const char* part_e) {
+			auto decodedPart = decodePathPart(part_b, part_e);
+			if(resolveDotSegments && !pathParts.empty()) {
+				if(decodedPart == ".") {
+					return;
 				}
-				// get port if any
-				if (b!=ea && *b==':') {
-					if (!isPortValid(++b, ea)) {
-						// port is invalid
-						throw std::invalid_argument("Port '"+std::string(b,ea-b)+"' in '"+str+"' is invalid");
+				else if(decodedPart == "..") {
+					// never remove the empty part before the leading slash
+					if(pathParts.size() > 1) {
+						pathParts.popBack();
 					}
-					port_b=b;
-					port_e=ea;
-				}
-				b=ea;
-			}
-			// get path
-			p=find_first_of(b,e,"?#");
-			if (!isPathValid(b, p)) {
-				// path is invalid
-				throw std::invalid_argument("Path '"+std::string(b,p)+"' in '"+str+"' is invalid");
-			}
-			path_b=b;
-			path_e=p;
-			if (p!=e && *p=='?') {
-				// move beginning to start of query and find next stop character (#) for fragment start
-				b=p+1;
-				p=find_char(b,e,'#');
-				if(!isQueryValid(b, p)) {
-					// query is invalid
-					throw std::invalid_argument("Query '"+std::string(b,p)+"' in '"+str+"' is invalid");
-				}
-				query_b=b;
-				query_e=p;
-			}
-			if (p!=e && *p=='#') {
-				if (!isFragmentValid(p+1, e)) {
-					// fragment is invalid
-					throw std::invalid_argument("Fragment '"+std::string(p+1,e)+"' in '"+std::string(s,e-s)+"' is invalid");
+					return;
 				}
-				fragment_b=p+1;
-				fragment_e=e;
-			}
-		}
-		// apply components
-		if(scheme_b) {
-			this->scheme = String(scheme_b, scheme_e);
-		}
-		if(user_b) {
-			auto colon = find_char(user_b, user_e, ':');
-			if(colon != user_e) {
-				this->username = decodeUserComponent(user_b, colon);
-				this->password = decodeUserComponent(colon+1, user_e);
-			}
-			else {
-				this->username = decodeUserComponent(user_b, user_e);
 			}
+			pathParts.pushBack(encodePathPart(decodedPart));
+		};
+		const char* pathPart_b = path_b;
+		const char* delim = find_char(pathPart_b, path_e, '/');
+		// split path parts by '/' character
+		while(delim != path_e) {
+			appendPathPart(pathPart_b, delim);
+			pathPart_b = delim + 1;
+			delim = find_char(pathPart_b, path_e, '/');
 		}
-		if(host_b) {
-			this->host = decodeComponent(host_b, host_e);
+		if(pathPart_b != path_e) {
+			appendPathPart(pathPart_b, delim);
 		}
-		if(port_b && port_b != port_e) {
-			this->port = String(port_b, port_e).toArithmeticValue<int>();
+		if(!pathParts.empty()) {
+			this->path = String::join(pathParts, "/");
 		}
-		if(path_b) {
-			LinkedList<StringView> pathParts;
-			const char* pathPart_b = path_b;
-			const char* delim = find_char(pathPart_b, path_e, '/');
-			// split path parts by '/' character
-			while(delim != path_e) {
-				pathParts.pushBack(StringView(pathPart_b, (delim - pathPart_b)));
-				pathPart_b = delim + 1;
-				delim = find_char(pathPart_b, path_e, '/');
-			}
-			if(pathPart_b != path_e) {
-				pathParts.pushBack(StringView(pathPart_b, (delim - pathPart_b)));
-			}
-			if(!pathParts.empty()) {
-				this->path = String::join(pathParts.map([=](auto& pathPart) {
-					auto part_b = pathPart.data();
-					auto part_e = part_b + pathPart.length();
-					auto decodedPart = decodePathPart(part_b, part_e);
-					return encodePathPart(decodedPart);
-				}), "/");
-			}
+		if(auto urlQuery = url.query()) {
+			this->query = String(urlQuery.value());
 		}
-		if(query_b) {
-			this->query = String(query_b, query_e);
-		}
-		if(fragment_b) {
-			this->fragment = String(fragment_b, fragment_e);
+		if(auto urlFragment = url.fragment()) {
+			this->fragment = String(urlFragment.value());
 		}
 	}
 
 	Optional<URL::Components> URL::Components::parse(const std::string& urlString) {
-		try {
-			return Components(urlString);
-		}
-		catch(const std::invalid_argument&) {
+		auto url = URLView::parse(urlString);
+		if(!url) {
 			return std::nullopt;
 		}
+		return Components(url.value());
 	}
 
 
@@ -588,30 +789,7 @@ namespace fgl {
 
 	LinkedList<String> URL::Components::pathParts() const {
 		auto parts = LinkedList<String>();
-		if(path.empty()) {
-			return parts;
-		}
-		auto begin = path.data();
-		auto end = begin + path.length();
-		auto it = begin;
-		// ignore leading slash if available
-		if(*it == '/') {
-			it++;
-		}
-		auto lastStart = it;
-		while(it != end) {
-			if(*it == '/') {
-				parts.pushBack(decodePathPart(lastStart, it));
-				it++;
-				lastStart = it;
-			}
-			else {
-				it++;
-			}
-		}
-		if(lastStart != it) {
-			parts.pushBack(decodePathPart(lastStart, it));
-		}
+		URL_appendPathParts(parts, path);
 		return parts;
 	}
 
@@ -623,29 +801,19 @@ namespace fgl {
 
 	LinkedList<URL::QueryItem> URL::Components::queryItems() const {
 		auto items = LinkedList<QueryItem>();
-		if(!query.hasValue() || query->empty()) {
-			return items;
-		}
-		auto begin = query.value().data();
-		auto end = begin + query.value().length();
-		auto it = begin;
-		auto lastStart = begin;
-		while(it != end) {
-			if(*it == '&') {
-				items.pushBack(QueryItem::parse(lastStart, it));
-				it++;
-				lastStart = it;
-			}
-			else {
-				it++;
-			}
-		}
-		if(lastStart != it) {
-			items.pushBack(QueryItem::parse(lastStart, it));
+		if(query.hasValue()) {
+			URL_appendQueryItems(items, query.value());
 		}
 		return items;
 	}
 
+	URL::QueryParams URL::Components::queryParams() const {
+		if(!query.hasValue()) {
+			return QueryParams();
+		}
+		return QueryParams(query.value());
+	}
+
 	void URL::Components::setQueryItems(const ArrayList<QueryItem>& queryItems) {
 		if(queryItems.empty()) {
 			query = std::nullopt;
@@ -662,6 +830,10 @@ namespace fgl {
 		//
 	}
 
+	URL::URL(const URLView& url, bool normalize) : _components(url, normalize) {
+		//
+	}
+
 	URL::URL(Components url) {
 		// validate components
 		if(url.scheme) {
@@ -736,13 +908,58 @@ namespace fgl {
 
 
 
-	Optional<URL> parse(const std::string& str) {
-		try {
-			return URL(str);
+	Optional<URL> URL::parse(const std::string& str) {
+		return tryParse(str).url;
+	}
+
+	URLParseResult URL::tryParse(StringView str, const URLParseOptions& options) {
+		URLView url;
+		auto error = URLView::parseInto(url, str, nullptr);
+		if(error != URLParseError::None) {
+			return URLParseResult{ .url = std::nullopt, .error = error };
 		}
-		catch(const std::invalid_argument&) {
-			return std::nullopt;
+		return URLParseResult{ .url = URL(url, options.normalize), .error = URLParseError::None };
+	}
+
+	void URL::parseMany(std::span<const StringView> inputs, std::span<URLParseResult> results, const URLParseOptions& options) {
+		if(results.size() < inputs.size()) {
+			throw std::invalid_argument("parseMany needs a result for each of the "+std::to_string(inputs.size())+" inputs, but only has room for "+std::to_string(results.size()));
 		}
+		// URLs are handed out in batches, so threads aren't contending over every one of them
+		constexpr size_t BATCH_SIZE = 256;
+		size_t batchCount = (inputs.size() + BATCH_SIZE - 1) / BATCH_SIZE;
+		runParallel(batchCount, options.threadCount, [&](size_t batch) {
+			size_t end = std::min(inputs.size(), (batch + 1) * BATCH_SIZE);
+			for(size_t i=(batch * BATCH_SIZE); i<end; i++) {
+				results[i] = tryParse(inputs[i], options);
+			}
+		});
+	}
+
+	const char* URL::describe(URLParseError error) {
+		switch(error) {
+			case URLParseError::None:
+				return "none";
+			case URLParseError::Empty:
+				return "empty";
+			case URLParseError::InvalidScheme:
+				return "invalid scheme";
+			case URLParseError::InvalidUserInfo:
+				return "invalid user info";
+			case URLParseError::UnterminatedIPLiteral:
+				return "unterminated IP literal";
+			case URLParseError::InvalidHost:
+				return "invalid host";
+			case URLParseError::InvalidPort:
+				return "invalid port";
+			case URLParseError::InvalidPath:
+				return "invalid path";
+			case URLParseError::InvalidQuery:
+				return "invalid query";
+			case URLParseError::InvalidFragment:
+				return "invalid fragment";
+		}
+		return "unknown";
 	}
 
 
@@ -856,11 +1073,56 @@ namespace fgl {
 		return _components.queryItems();
 	}
 
+	URL::QueryParams URL::queryParams() const {
+		return _components.queryParams();
+	}
+
 	void URL::setQueryItems(const ArrayList<QueryItem>& queryItems) {
 		_components.setQueryItems(queryItems);
 	}
 
 
+	/// Writes a query string for a list of items, where toItem gives a URL::QueryParams::Item for each one
+	template<typename Items, typename ToItem>
+	String URL_makeQueryString(const Items& items, ToItem toItem) {
+		// size the whole string first, so that it's only allocated once
+		size_t size = 0;
+		bool first = true;
+		bool changed = false;
+		for(auto&& listItem : items) {
+			auto item = toItem(listItem);
+			size += URL_encodedLength(item.key.data(), item.key.data() + item.key.length(), URL_queryKeyEncodingTable.data(), changed);
+			if(item.value) {
+				auto value = item.value.value();
+				size += 1 + URL_encodedLength(value.data(), value.data() + value.length(), URL_queryValueEncodingTable.data(), changed);
+			}
+			if(!first) {
+				size++;
+			}
+			first = false;
+		}
+		String queryString;
+		queryString.resize(size);
+		char* out = queryString.data();
+		first = true;
+		for(auto&& listItem : items) {
+			auto item = toItem(listItem);
+			if(!first) {
+				*out = '&';
+				out++;
+			}
+			first = false;
+			out = URL_encodeInto(out, item.key.data(), item.key.data() + item.key.length(), URL_queryKeyEncodingTable.data());
+			if(item.value) {
+				auto value = item.value.value();
+				*out = '=';
+				out = URL_encodeInto(out + 1, value.data(), value.data() + value.length(), URL_queryValueEncodingTable.data());
+			}
+		}
+		return queryString;
+	}
+
+
 	const URL::Components& URL::components() const {
 		return _components;
 	}
@@ -873,7 +1135,8 @@ namespace fgl {
 		auto separatorIt = find_char(begin, end, '=');
 		if(separatorIt == end) {
 			return QueryItem{
-				.key = decodeQueryKey(begin, end)
+				.key = decodeQueryKey(begin, end),
+				.value = std::nullopt
 			};
 		}
 		return QueryItem{
@@ -894,21 +1157,28 @@ namespace fgl {
 	}
 
 	String URL::makeQueryString(const ArrayList<QueryItem>& items) {
-		return String::join(items.map([](auto& item) {
-			return item.toString();
-		}), "&");
+		return URL_makeQueryString(items, [](const QueryItem& item) {
+			if(!item.value) {
+				return QueryParams::Item{ .key = item.key, .value = std::nullopt };
+			}
+			return QueryParams::Item{ .key = item.key, .value = StringView(item.value.value()) };
+		});
 	}
 
 	String URL::makeQueryString(const std::map<String,String>& items) {
-		LinkedList<String> itemStrings;
-		for(auto& pair : items) {
-			itemStrings.pushBack(QueryItem{ .key = pair.first, .value = pair.second }.toString());
-		}
-		return String::join(itemStrings, "&");
+		return URL_makeQueryString(items, [](const std::pair<const String,String>& pair) {
+			return QueryParams::Item{ .key = pair.first, .value = StringView(pair.second) };
+		});
 	}
 
 	LinkedList<URL::QueryItem> URL::parseQueryItems(const String& queryString) {
 		auto items = LinkedList<QueryItem>();
+		URL_appendQueryItems(items, queryString);
+		return items;
+	}
+
+	Map<String,String> URL::parseQueryItemMap(const String& queryString) {
+		auto items = Map<String,String>();
 		if(queryString.empty()) {
 			return items;
 		}
@@ -918,7 +1188,8 @@ namespace fgl {
 		auto lastStart = begin;
 		while(it != end) {
 			if(*it == '&') {
-				items.pushBack(QueryItem::parse(lastStart, it));
+				auto item = QueryItem::parse(lastStart, it);
+				items[item.key] = item.value.valueOr(String());
 				it++;
 				lastStart = it;
 			}
@@ -927,35 +1198,365 @@ namespace fgl {
 			}
 		}
 		if(lastStart != it) {
-			items.pushBack(QueryItem::parse(lastStart, it));
+			auto item = QueryItem::parse(lastStart, it);
+			items[item.key] = item.value.valueOr(String());
 		}
 		return items;
 	}
 
-	Map<String,String> URL::parseQueryItemMap(const String& queryString) {
-		auto items = Map<String,String>();
+
+
+	#pragma mark URL::QueryParams
+
+	URL::QueryParams::QueryParams() {
+		//
+	}
+
+	URL::QueryParams::QueryParams(StringView queryString) {
 		if(queryString.empty()) {
-			return items;
+			return;
 		}
 		auto begin = queryString.data();
 		auto end = begin + queryString.length();
-		auto it = begin;
-		auto lastStart = begin;
+		// decoding never makes the query longer, so every item fits in a buffer the size of the query
+		_buffer.resize(queryString.length());
+		// there's at most one more item than there are separators
+		_entries.reserve((size_t)std::count(begin, end, '&') + 1);
+		char* bufferStart = _buffer.data();
+		char* out = bufferStart;
+		Entry entry = { .keyOffset = 0, .keyLength = 0, .valueLength = NO_VALUE };
+		bool inValue = false;
+		// items are split, and their keys and values decoded, in a single pass
+		const char* it = begin;
 		while(it != end) {
-			if(*it == '&') {
-				auto item = QueryItem::parse(lastStart, it);
-				items[item.key] = item.value.valueOr(String());
+			char c = *it;
+			if(c == '&') {
+				if(inValue) {
+					entry.valueLength = (size_t)(out - bufferStart) - entry.keyOffset - entry.keyLength;
+				} else {
+					entry.keyLength = (size_t)(out - bufferStart) - entry.keyOffset;
+				}
+				_entries.pushBack(entry);
+				entry = { .keyOffset = (size_t)(out - bufferStart), .keyLength = 0, .valueLength = NO_VALUE };
+				inValue = false;
+				it++;
+				continue;
+			}
+			else if(c == '=' && !inValue) {
+				entry.keyLength = (size_t)(out - bufferStart) - entry.keyOffset;
+				inValue = true;
+				it++;
+				continue;
+			}
+			else if(c == '%' && (end - it) > 2 && it[1] != '&' && it[2] != '&' && (inValue || (it[1] != '=' && it[2] != '='))) {
+				// an escape is only decoded if it fits in the key or value it's in
+				*out = (char)((URL_hexValues[(uint8_t)it[1]] << 4) | URL_hexValues[(uint8_t)it[2]]);
+				it += 3;
+			}
+			else if(c == '+') {
+				*out = ' ';
 				it++;
-				lastStart = it;
 			}
 			else {
+				*out = c;
 				it++;
 			}
+			out++;
 		}
-		if(lastStart != it) {
-			auto item = QueryItem::parse(lastStart, it);
-			items[item.key] = item.value.valueOr(String());
+		if(it != begin && end[-1] != '&') {
+			if(inValue) {
+				entry.valueLength = (size_t)(out - bufferStart) - entry.keyOffset - entry.keyLength;
+			} else {
+				entry.keyLength = (size_t)(out - bufferStart) - entry.keyOffset;
+			}
+			_entries.pushBack(entry);
+		}
+		_buffer.resize(out - bufferStart);
+	}
+
+	URL::QueryParams::Item URL::QueryParams::at(size_t index) const {
+		if(index >= _entries.size()) {
+			throw std::out_of_range("index " + std::to_string(index) + " is out of bounds in QueryParams with " + std::to_string(_entries.size()) + " items");
+		}
+		return (*this)[index];
+	}
+
+	template<typename OnMatch>
+	void URL::QueryParams::findMatches(StringView key, OnMatch onMatch) const {
+		if(_index.empty()) {
+			size_t count = _entries.size();
+			for(size_t i=0; i<count; i++) {
+				if(this->key(_entries[i]) == key && !onMatch(i)) {
+					return;
+				}
+			}
+			return;
+		}
+		// items with the same key were inserted in order, so probing finds them in order
+		size_t mask = _index.size() - 1;
+		size_t slot = std::hash<StringView>()(key) & mask;
+		while(_index[slot] != 0) {
+			size_t i = _index[slot] - 1;
+			if(this->key(_entries[i]) == key && !onMatch(i)) {
+				return;
+			}
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	void URL::QueryParams::buildIndex() {
+		if(!_index.empty() || _entries.empty()) {
+			return;
+		}
+		// keep the table at most half full, so probes stay short
+		size_t slotCount = std::bit_ceil(_entries.size() * 2);
+		_index.resize(slotCount, 0);
+		size_t mask = slotCount - 1;
+		size_t count = _entries.size();
+		for(size_t i=0; i<count; i++) {
+			size_t slot = std::hash<StringView>()(key(_entries[i])) & mask;
+			while(_index[slot] != 0) {
+				slot = (slot + 1) & mask;
+			}
+			_index[slot] = i + 1;
+		}
+	}
+
+	Optional<StringView> URL::QueryParams::get(StringView key) const {
+		Optional<StringView> value;
+		findMatches(key, [&](size_t index) {
+			value = (*this)[index].value.valueOr(StringView());
+			return false;
+		});
+		return value;
+	}
+
+	ArrayList<StringView> URL::QueryParams::getAll(StringView key) const {
+		ArrayList<StringView> values;
+		findMatches(key, [&](size_t index) {
+			values.pushBack((*this)[index].value.valueOr(StringView()));
+			return true;
+		});
+		return values;
+	}
+
+	bool URL::QueryParams::has(StringView key) const {
+		bool found = false;
+		findMatches(key, [&](size_t) {
+			found = true;
+			return false;
+		});
+		return found;
+	}
+
+	String URL::QueryParams::toString() const {
+		return URL_makeQueryString(*this, [](const Item& item) {
+			return item;
+		});
+	}
+
+
+
+	#pragma mark URLView
+
+	URLView::URLView()
+	: _path{ .offset = 0, .length = 0 } {
+		//
+	}
+
+	URLView::URLView(StringView str) {
+		std::string error;
+		if(parseInto(*this, str, &error) != URLParseError::None) {
+			throw std::invalid_argument(error);
+		}
+	}
+
+	Optional<URLView> URLView::parse(StringView str) {
+		URLView url;
+		if(parseInto(url, str, nullptr) != URLParseError::None) {
+			return std::nullopt;
+		}
+		return url;
+	}
+
+	URLParseError URLView::parseInto(URLView& url, StringView str, std::string* error) {
+		// the error description is only built if the caller wants it, so rejecting an invalid URL doesn't allocate
+		auto fail = [&](URLParseError code, auto describe) {
+			if(error != nullptr) {
+				*error = describe();
+			}
+			return code;
+		};
+		if (str.empty()) {
+			return fail(URLParseError::Empty, []() { return std::string("Empty string is not a valid URL"); });
+		}
+		
+		const char *s=str.data(), *e=s+str.length();
+		auto range = [=](const char* begin, const char* end) {
+			return Range{ .offset = (size_t)(begin - s), .length = (size_t)(end - begin) };
+		};
+		url = URLView();
+		url._source = str;
+
+		const char *b=s, *p=find_first_of(b, e, ":/?#");
+		if (p==e) {
+			// character for end of scheme wasn't found, so entire URL is likely a path
+			if (!URL::isPathValid(b, p)) {
+				return fail(URLParseError::InvalidPath, [&]() { return "Path '"+std::string(b,p)+"' in '"+std::string(str)+"' is invalid"; });
+			}
+			url._path = range(b, e);
+			return URLParseError::None;
+		}
+		// get schema if any
+		if (*p==':') {
+			if (!URL::isSchemeValid(b, p)) {
+				return fail(URLParseError::InvalidScheme, [&]() { return "Scheme in '"+std::string(str)+"' is invalid"; });
+			}
+			url._scheme = range(b, p);
+			// bump beginning past scheme, find next stop character
+			b=p+1;
+			p=find_first_of(b, e, "/?#");
+		}
+		// get authority if any
+		if (p!=e && *p=='/' && (e-b)>1 && b[0]=='/' && b[1]=='/') {
+			// bump beginning past slashes
+			b+=2;
+			// locate end of authority
+			const char* ea=find_first_of(b, e, "/?#");
+			p=find_char(b, ea, '@');
+			// get user info if any
+			if (p!=ea) {
+				// found @ symbol to end authority component, so validate user authority string
+				if (!URL::isPasswordValid(b, p)) {
+					return fail(URLParseError::InvalidUserInfo, [&]() { return "User info in '"+std::string(str)+"' is invalid"; });
+				}
+				const char* colon = find_char(b, p, ':');
+				url._username = range(b, colon);
+				if (colon!=p) {
+					url._password = range(colon+1, p);
+				}
+				// bump beginning past user authority
+				b=p+1;
+			}
+			// get IP literal if any
+			if (b!=ea && *b=='[') {
+				// locate end of IP literal
+				p=find_char(b+1, ea, ']');
+				if (p==ea) {
+					return fail(URLParseError::UnterminatedIPLiteral, [&]() { return "Missing ] in '"+std::string(str)+"'"; });
+				}
+				if (!URL::isHostValid(b, p+1)) {
+					return fail(URLParseError::InvalidHost, [&]() { return "Host address in '"+std::string(str)+"' is invalid"; });
+				}
+				url._host = range(b, p+1);
+				b=p+1;
+			}
+			// get host
+			else {
+				p=find_char(b, ea, ':');
+				if (!URL::isHostValid(b, p)) {
+					return fail(URLParseError::InvalidHost, [&]() { return "Host address in '"+std::string(str)+"' is invalid"; });
+				}
+				url._host = range(b, p);
+				b=p;
+			}
+			// get port if any
+			if (b!=ea && *b==':') {
+				b++;
+				if (!URL::isPortValid(b, ea)) {
+					return fail(URLParseError::InvalidPort, [&]() { return "Port '"+std::string(b,ea-b)+"' in '"+std::string(str)+"' is invalid"; });
+				}
+				url._port = range(b, ea);
+			}
+			b=ea;
+		}
+		// get path
+		p=find_first_of(b,e,"?#");
+		if (!URL::isPathValid(b, p)) {
+			return fail(URLParseError::InvalidPath, [&]() { return "Path '"+std::string(b,p)+"' in '"+std::string(str)+"' is invalid"; });
+		}
+		url._path = range(b, p);
+		if (p!=e && *p=='?') {
+			// move beginning to start of query and find next stop character (#) for fragment start
+			b=p+1;
+			p=find_char(b,e,'#');
+			if (!URL::isQueryValid(b, p)) {
+				return fail(URLParseError::InvalidQuery, [&]() { return "Query '"+std::string(b,p)+"' in '"+std::string(str)+"' is invalid"; });
+			}
+			url._query = range(b, p);
+		}
+		if (p!=e && *p=='#') {
+			if (!URL::isFragmentValid(p+1, e)) {
+				return fail(URLParseError::InvalidFragment, [&]() { return "Fragment '"+std::string(p+1,e)+"' in '"+std::string(str)+"' is invalid"; });
+			}
+			url._fragment = range(p+1, e);
+		}
+		return URLParseError::None;
+	}
+
+	Optional<uint16_t> URLView::port() const {
+		if(_port.offset == std::string_view::npos || _port.length == 0) {
+			return std::nullopt;
+		}
+		// the port was validated when parsing, so it only contains digits and fits in 16 bits
+		uint32_t value = 0;
+		for(char c : _source.substr(_port.offset, _port.length)) {
+			value = (value * 10) + (uint32_t)(c - '0');
+		}
+		return (uint16_t)value;
+	}
+
+	Optional<String> URLView::decodedUsername() const {
+		if(_username.offset == std::string_view::npos) {
+			return std::nullopt;
+		}
+		auto begin = _source.data() + _username.offset;
+		return URL::decodeUserComponent(begin, begin + _username.length);
+	}
+
+	Optional<String> URLView::decodedPassword() const {
+		if(_password.offset == std::string_view::npos) {
+			return std::nullopt;
+		}
+		auto begin = _source.data() + _password.offset;
+		return URL::decodeUserComponent(begin, begin + _password.length);
+	}
+
+	Optional<String> URLView::decodedHost() const {
+		if(_host.offset == std::string_view::npos) {
+			return std::nullopt;
+		}
+		auto begin = _source.data() + _host.offset;
+		return URL::decodeComponent(begin, begin + _host.length);
+	}
+
+	bool URLView::pathIsRelative() const {
+		auto urlPath = path();
+		return !urlPath.empty() && urlPath[0] != '/';
+	}
+
+	LinkedList<String> URLView::pathParts() const {
+		auto parts = LinkedList<String>();
+		URL_appendPathParts(parts, path());
+		return parts;
+	}
+
+	LinkedList<URL::QueryItem> URLView::queryItems() const {
+		auto items = LinkedList<URL::QueryItem>();
+		if(auto urlQuery = query()) {
+			URL_appendQueryItems(items, urlQuery.value());
 		}
 		return items;
 	}
-}
+
+	URL::QueryParams URLView::queryParams() const {
+		if(auto urlQuery = query()) {
+			return URL::QueryParams(urlQuery.value());
+		}
+		return URL::QueryParams();
+	}
+
+	URL URLView::toURL() const {
+		return URL(*this);
+	}
+}
\ No newline at end of file
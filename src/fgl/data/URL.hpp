@@ -11,10 +11,37 @@
 #include <fgl/data/Common.hpp>
 #include <fgl/data/String.hpp>
 #include <fgl/data/ArrayList.hpp>
+#include <fgl/data/LinkedList.hpp>
 #include <fgl/data/Map.hpp>
 #include <fgl/data/Optional.hpp>
+#include <iterator>
+#include <span>
 
 namespace fgl {
+	class URLView;
+	struct URLParseResult;
+	
+	/// Why a string couldn't be parsed as a URL
+	enum class URLParseError: uint8_t {
+		None,
+		Empty,
+		InvalidScheme,
+		InvalidUserInfo,
+		UnterminatedIPLiteral,
+		InvalidHost,
+		InvalidPort,
+		InvalidPath,
+		InvalidQuery,
+		InvalidFragment
+	};
+	
+	struct URLParseOptions {
+		/// Lowercases the scheme and host, drops the port if it's the scheme's default, and resolves "." and ".." segments in absolute paths
+		bool normalize = false;
+		/// The number of threads URL::parseMany may use, or 0 for one per core
+		size_t threadCount = 1;
+	};
+	
 	class URL {
 	public:
 		/// A (decoded) key-value item for the query component of a URL
@@ -29,10 +56,14 @@ namespace fgl {
 			String toString() const;
 		};
 		
+		class QueryParams;
+		
 		/// Contains the individual components of a URL
 		struct Components {
 			explicit Components();
 			explicit Components(const std::string&);
+			/// Copies the components of a parsed URL, normalizing them if normalize is true
+			explicit Components(const URLView&, bool normalize = false);
 			
 			static Optional<Components> parse(const std::string&);
 			
@@ -55,6 +86,8 @@ namespace fgl {
 			
 			/// The decoded items in the query component
 			LinkedList<QueryItem> queryItems() const;
+			/// The decoded items in the query component, in a single buffer
+			QueryParams queryParams() const;
 			/// Sets the query items for the query string
 			void setQueryItems(const ArrayList<QueryItem>& queryItems);
 			
@@ -109,8 +142,15 @@ namespace fgl {
 		static bool isFragmentValid(const std::string&);
 		
 		static Optional<URL> parse(const std::string& str);
+		/// Parses a URL without throwing, so invalid input is cheap to reject
+		static URLParseResult tryParse(StringView str, const URLParseOptions& options = {});
+		/// Parses many URLs, writing a result for each input to the same index of results
+		static void parseMany(std::span<const StringView> inputs, std::span<URLParseResult> results, const URLParseOptions& options = {});
+		/// The name of a parse error, for logging
+		static const char* describe(URLParseError error);
 		
 		explicit URL(const std::string&);
+		explicit URL(const URLView&, bool normalize = false);
 		explicit URL(Components);
 		String toString() const;
 		
@@ -128,15 +168,283 @@ namespace fgl {
 		LinkedList<String> pathParts() const;
 		
 		LinkedList<QueryItem> queryItems() const;
+		QueryParams queryParams() const;
 		void setQueryItems(const ArrayList<QueryItem>& queryItems);
 		
 		const Components& components() const;
 		
 	private:
-		static String encodeComponent(const std::string& str, Function<bool(char)> shouldEncodeChar, const std::map<char,char>& mappedChars = {});
-		static String decodeComponent(const char* begin, const char* end, const std::map<char,char>& mappedChars = {});
+		friend class URLView;
+		
+		/// Percent-encodes str, using a 256 entry table that says how each byte is written
+		static String encodeComponent(StringView str, const uint8_t* encodingTable);
+		static String decodeComponent(const char* begin, const char* end, bool plusAsSpace = false);
 		
 		/// The individual components of the URL
 		Components _components;
 	};
+	
+	
+	
+	/// The decoded items of a query string. Every key and value is decoded into one buffer, and items are stored as offsets into it,
+	/// so parsing a query only allocates twice no matter how many items it has.
+	/// Lookups scan the items, unless buildIndex has been called, and then use a hash index.
+	/// Lookups never modify the QueryParams, so it can be searched from multiple threads at once.
+	class URL::QueryParams {
+	public:
+		/// A decoded item. The key and value refer to the buffer of the QueryParams, so they're only valid as long as it is.
+		struct Item {
+			StringView key;
+			Optional<StringView> value;
+		};
+		
+		class Iterator {
+			friend class QueryParams;
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Item;
+			using difference_type = std::ptrdiff_t;
+			using reference = Item;
+			using pointer = void;
+			
+			Iterator() noexcept: _params(nullptr), _index(0) {
+				//
+			}
+			
+			inline reference operator*() const {
+				return (*_params)[_index];
+			}
+			
+			inline Iterator& operator++() {
+				_index++;
+				return *this;
+			}
+			
+			inline Iterator operator++(int) {
+				auto copy = *this;
+				_index++;
+				return copy;
+			}
+			
+			inline bool operator==(const Iterator& it) const {
+				return _index == it._index;
+			}
+			
+			inline bool operator!=(const Iterator& it) const {
+				return _index != it._index;
+			}
+			
+		private:
+			Iterator(const QueryParams* params, size_t index) noexcept: _params(params), _index(index) {
+				//
+			}
+			
+			const QueryParams* _params;
+			size_t _index;
+		};
+		
+		using const_iterator = Iterator;
+		
+		QueryParams();
+		explicit QueryParams(StringView queryString);
+		
+		inline size_t size() const;
+		inline bool empty() const;
+		inline Item operator[](size_t index) const;
+		Item at(size_t index) const;
+		
+		inline Iterator begin() const;
+		inline Iterator end() const;
+		
+		/// The value of the first item with the given key, or null if there isn't one. An item without a value gives an empty string.
+		Optional<StringView> get(StringView key) const;
+		/// The values of every item with the given key, in the order they appear
+		ArrayList<StringView> getAll(StringView key) const;
+		bool has(StringView key) const;
+		
+		/// Builds a hash index of the keys, so later lookups don't scan every item.
+		/// This is worth it for a query with many items that will be searched more than a few times.
+		void buildIndex();
+		
+		/// Encodes the items back into a query string
+		String toString() const;
+		
+	private:
+		struct Entry {
+			size_t keyOffset;
+			size_t keyLength;
+			/// The value follows the key in the buffer. NO_VALUE means the item doesn't have one.
+			size_t valueLength;
+		};
+		static constexpr size_t NO_VALUE = (size_t)-1;
+		
+		inline StringView key(const Entry& entry) const;
+		/// Calls onMatch with the index of each item with the given key, in order, until it returns false
+		template<typename OnMatch>
+		void findMatches(StringView key, OnMatch onMatch) const;
+		
+		String _buffer;
+		ArrayList<Entry> _entries;
+		/// An open addressing table of entry indexes plus one, where 0 is an empty slot. Empty until buildIndex is called.
+		ArrayList<size_t> _index;
+	};
+	
+	
+	
+	struct URLParseResult {
+		/// The parsed URL, or null if parsing failed
+		Optional<URL> url;
+		URLParseError error = URLParseError::None;
+	};
+	
+	
+	
+	/// A parsed URL that refers to the components of the string it was parsed from, rather than copying them.
+	/// Parsing doesn't allocate, and components are only decoded when they're asked for.
+	/// The source string must outlive the view.
+	class URLView {
+	public:
+		URLView();
+		/// Parses a URL, throwing std::invalid_argument if it is invalid
+		explicit URLView(StringView str);
+		
+		/// Parses a URL, or returns null if it is invalid. Invalid URLs don't throw, so this is cheap to call on untrusted input.
+		static Optional<URLView> parse(StringView str);
+		
+		/// The string that the URL was parsed from
+		inline StringView source() const;
+		
+		/// The scheme of the URL (ex: ftp, http, https)
+		inline Optional<StringView> scheme() const;
+		/// The encoded username component of the URL
+		inline Optional<StringView> username() const;
+		/// The encoded password component of the URL
+		inline Optional<StringView> password() const;
+		/// The encoded host component of the URL
+		inline Optional<StringView> host() const;
+		Optional<uint16_t> port() const;
+		/// The encoded path portion of the URL, exactly as it appears in the source
+		inline StringView path() const;
+		/// The encoded URL query component, if available
+		inline Optional<StringView> query() const;
+		/// The URL fragment (hash) component, if available
+		inline Optional<StringView> fragment() const;
+		
+		Optional<String> decodedUsername() const;
+		Optional<String> decodedPassword() const;
+		Optional<String> decodedHost() const;
+		
+		bool pathIsRelative() const;
+		/// The individual decoded parts of the URL path, split by the '/' delimiter
+		LinkedList<String> pathParts() const;
+		/// The decoded items in the query component
+		LinkedList<URL::QueryItem> queryItems() const;
+		/// The decoded items in the query component, in a single buffer
+		URL::QueryParams queryParams() const;
+		
+		/// Copies the components into a URL, which doesn't depend on the source string
+		URL toURL() const;
+		
+	private:
+		friend class URL;
+		
+		/// The position of a component in the source string. An offset of npos means the component isn't present.
+		struct Range {
+			size_t offset = std::string_view::npos;
+			size_t length = 0;
+		};
+		
+		/// Parses str into url, and returns why it is invalid, or None if it is valid. If error isn't null, it's given a description of the problem.
+		static URLParseError parseInto(URLView& url, StringView str, std::string* error);
+		
+		inline Optional<StringView> component(const Range& range) const;
+		
+		StringView _source;
+		Range _scheme;
+		Range _username;
+		Range _password;
+		Range _host;
+		Range _port;
+		Range _path;
+		Range _query;
+		Range _fragment;
+	};
+	
+	
+	
+	#pragma mark URL::QueryParams implementation
+	
+	size_t URL::QueryParams::size() const {
+		return _entries.size();
+	}
+	
+	bool URL::QueryParams::empty() const {
+		return _entries.empty();
+	}
+	
+	URL::QueryParams::Item URL::QueryParams::operator[](size_t index) const {
+		auto& entry = _entries[index];
+		if(entry.valueLength == NO_VALUE) {
+			return Item{ .key = key(entry), .value = std::nullopt };
+		}
+		return Item{
+			.key = key(entry),
+			.value = StringView(_buffer.data() + entry.keyOffset + entry.keyLength, entry.valueLength)
+		};
+	}
+	
+	URL::QueryParams::Iterator URL::QueryParams::begin() const {
+		return Iterator(this, 0);
+	}
+	
+	URL::QueryParams::Iterator URL::QueryParams::end() const {
+		return Iterator(this, _entries.size());
+	}
+	
+	StringView URL::QueryParams::key(const Entry& entry) const {
+		return StringView(_buffer.data() + entry.keyOffset, entry.keyLength);
+	}
+	
+	
+	
+	#pragma mark URLView implementation
+	
+	StringView URLView::source() const {
+		return _source;
+	}
+	
+	Optional<StringView> URLView::component(const Range& range) const {
+		if(range.offset == std::string_view::npos) {
+			return std::nullopt;
+		}
+		return _source.substr(range.offset, range.length);
+	}
+	
+	Optional<StringView> URLView::scheme() const {
+		return component(_scheme);
+	}
+	
+	Optional<StringView> URLView::username() const {
+		return component(_username);
+	}
+	
+	Optional<StringView> URLView::password() const {
+		return component(_password);
+	}
+	
+	Optional<StringView> URLView::host() const {
+		return component(_host);
+	}
+	
+	StringView URLView::path() const {
+		return _source.substr(_path.offset, _path.length);
+	}
+	
+	Optional<StringView> URLView::query() const {
+		return component(_query);
+	}
+	
+	Optional<StringView> URLView::fragment() const {
+		return component(_fragment);
+	}
 }
@@ -0,0 +1,1534 @@
+//
+//  UnrolledList.hpp
+//  DataCpp
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data/Common.hpp>
+#include <fgl/data/BasicList.hpp>
+#include <fgl/data/BasicString.hpp>
+#include <fgl/data/MemoryResource.hpp>
+#include <fgl/data/Stringify.hpp>
+#include <fgl/data/Traits.hpp>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace fgl {
+	/// A doubly linked list of fixed-capacity chunks, each storing its elements contiguously.
+	/// Elements within a chunk occupy the range [startIndex, endIndex), so pushing to either end is O(1).
+	/// Splicing and splitting only relink chunks, moving at most half a chunk of elements at the boundary.
+	template<typename T, typename Allocator, size_t ChunkCapacity>
+	class _UnrolledListBase {
+	private:
+		static_assert(ChunkCapacity > 0, "ChunkCapacity must be greater than 0");
+
+		struct ChunkHeader {
+			ChunkHeader* prev;
+			ChunkHeader* next;
+			size_t startIndex;
+			size_t endIndex;
+		};
+
+		struct Chunk: public ChunkHeader {
+			alignas(T) unsigned char storage[sizeof(T) * ChunkCapacity];
+		};
+
+		using AllocatorTraits = std::allocator_traits<Allocator>;
+		using ChunkAllocator = typename AllocatorTraits::template rebind_alloc<Chunk>;
+		using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+		template<bool Const>
+		class Iterator {
+			friend class _UnrolledListBase;
+			template<bool> friend class Iterator;
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const T*, T*>;
+			using reference = std::conditional_t<Const, const T&, T&>;
+
+			Iterator() noexcept: _chunk(nullptr), _ptr(nullptr), _end(nullptr) {
+				//
+			}
+
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			Iterator(const Iterator<false>& it) noexcept: _chunk(it._chunk), _ptr(it._ptr), _end(it._end) {
+				//
+			}
+
+			inline reference operator*() const {
+				return *_ptr;
+			}
+
+			inline pointer operator->() const {
+				return _ptr;
+			}
+
+			inline Iterator& operator++() {
+				_ptr++;
+				if(_ptr == _end) {
+					setChunk(_chunk->next, _chunk->next->startIndex);
+				}
+				return *this;
+			}
+
+			inline Iterator operator++(int) {
+				auto it = *this;
+				++(*this);
+				return it;
+			}
+
+			inline Iterator& operator--() {
+				if(_ptr == nullptr || _ptr == (dataOf(_chunk) + _chunk->startIndex)) {
+					setChunk(_chunk->prev, _chunk->prev->endIndex);
+				}
+				_ptr--;
+				return *this;
+			}
+
+			inline Iterator operator--(int) {
+				auto it = *this;
+				--(*this);
+				return it;
+			}
+
+			friend inline bool operator==(const Iterator& left, const Iterator& right) noexcept {
+				return left._ptr == right._ptr && left._chunk == right._chunk;
+			}
+
+			friend inline bool operator!=(const Iterator& left, const Iterator& right) noexcept {
+				return left._ptr != right._ptr || left._chunk != right._chunk;
+			}
+
+		private:
+			Iterator(ChunkHeader* chunk, size_t index) noexcept {
+				setChunk(chunk, index);
+			}
+
+			inline void setChunk(ChunkHeader* chunk, size_t index) noexcept {
+				// the sentinel is the only linked chunk without elements
+				_chunk = chunk;
+				if(chunk->startIndex == chunk->endIndex) {
+					_ptr = nullptr;
+					_end = nullptr;
+				} else {
+					T* data = dataOf(chunk);
+					_ptr = data + index;
+					_end = data + chunk->endIndex;
+				}
+			}
+
+			inline size_t index() const noexcept {
+				return (_ptr == nullptr) ? 0 : (size_t)(_ptr - dataOf(_chunk));
+			}
+
+			ChunkHeader* _chunk;
+			T* _ptr;
+			T* _end;
+		};
+
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = typename AllocatorTraits::pointer;
+		using const_pointer = typename AllocatorTraits::const_pointer;
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		_UnrolledListBase();
+		explicit _UnrolledListBase(const Allocator& allocator);
+		_UnrolledListBase(size_type count, const T& value, const Allocator& allocator = Allocator());
+		template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+		_UnrolledListBase(InputIterator first, InputIterator last, const Allocator& allocator = Allocator());
+		_UnrolledListBase(std::initializer_list<T> list, const Allocator& allocator = Allocator());
+		_UnrolledListBase(const _UnrolledListBase&);
+		_UnrolledListBase(_UnrolledListBase&&) noexcept;
+		~_UnrolledListBase();
+
+		_UnrolledListBase& operator=(const _UnrolledListBase&);
+		_UnrolledListBase& operator=(_UnrolledListBase&&);
+		_UnrolledListBase& operator=(std::initializer_list<T> list);
+
+		void assign(size_type count, const T& value);
+		template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+		void assign(InputIterator first, InputIterator last);
+		void assign(std::initializer_list<T> list);
+
+		inline allocator_type get_allocator() const noexcept;
+
+		inline iterator begin() noexcept;
+		inline const_iterator begin() const noexcept;
+		inline const_iterator cbegin() const noexcept;
+		inline iterator end() noexcept;
+		inline const_iterator end() const noexcept;
+		inline const_iterator cend() const noexcept;
+		inline reverse_iterator rbegin() noexcept;
+		inline const_reverse_iterator rbegin() const noexcept;
+		inline const_reverse_iterator crbegin() const noexcept;
+		inline reverse_iterator rend() noexcept;
+		inline const_reverse_iterator rend() const noexcept;
+		inline const_reverse_iterator crend() const noexcept;
+
+		inline bool empty() const noexcept;
+		inline size_type size() const noexcept;
+		inline size_type max_size() const noexcept;
+
+		inline reference front();
+		inline const_reference front() const;
+		inline reference back();
+		inline const_reference back() const;
+
+		void clear() noexcept;
+
+		iterator insert(const_iterator pos, const T& value);
+		iterator insert(const_iterator pos, T&& value);
+		template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+		iterator insert(const_iterator pos, InputIterator first, InputIterator last);
+		iterator insert(const_iterator pos, std::initializer_list<T> list);
+		template<typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args);
+
+		iterator erase(const_iterator pos);
+		iterator erase(const_iterator first, const_iterator last);
+
+		inline void push_back(const T& value);
+		inline void push_back(T&& value);
+		template<typename... Args>
+		reference emplace_back(Args&&... args);
+		void pop_back();
+
+		inline void push_front(const T& value);
+		inline void push_front(T&& value);
+		template<typename... Args>
+		reference emplace_front(Args&&... args);
+		void pop_front();
+
+		/// Moves all elements of list in front of pos. When the allocators are equal, only chunks are relinked.
+		void splice(const_iterator pos, _UnrolledListBase& list);
+		inline void splice(const_iterator pos, _UnrolledListBase&& list);
+
+		inline size_type remove(const T& value);
+		template<typename Predicate>
+		size_type remove_if(Predicate predicate);
+
+		void swap(_UnrolledListBase& list) noexcept;
+
+		bool operator==(const _UnrolledListBase& list) const;
+		inline bool operator!=(const _UnrolledListBase& list) const;
+
+	protected:
+		/// Gets an iterator to the element at offset, walking chunks from the closer end
+		const_iterator iteratorAt(size_type offset) const;
+		/// Moves the elements in [begin, end) to the back of list
+		void splitFront(const_iterator end, _UnrolledListBase& list);
+		/// Moves the elements in [start, end) to the front of list
+		void splitBack(const_iterator start, _UnrolledListBase& list);
+
+	private:
+		static inline T* dataOf(ChunkHeader* chunk) noexcept;
+		static inline void linkChunks(ChunkHeader* pos, ChunkHeader* first, ChunkHeader* last) noexcept;
+		static inline void unlinkChunks(ChunkHeader* first, ChunkHeader* last) noexcept;
+		static inline void moveChain(ChunkHeader& source, ChunkHeader& dest) noexcept;
+		static inline iterator makeIterator(ChunkHeader* chunk, size_type index) noexcept;
+
+		Chunk* allocateChunk(size_type index);
+		void deallocateChunk(ChunkHeader* chunk) noexcept;
+		void destroyRange(T* first, T* last) noexcept;
+		void relocateRange(T* first, T* last, T* dest);
+		template<typename... Args>
+		iterator emplaceInNewChunk(ChunkHeader* pos, size_type index, Args&&... args);
+		ChunkHeader* splitChunkAt(const_iterator pos);
+		void transferChunks(ChunkHeader* first, ChunkHeader* end, _UnrolledListBase& list, ChunkHeader* pos) noexcept;
+		void mergeSparseChunks();
+
+		ChunkHeader _sentinel;
+		size_type _size;
+		Allocator _allocator;
+	};
+
+
+
+	template<typename T, typename Allocator = std::allocator<T>, size_t ChunkCapacity = std::max<size_t>(8, 512 / sizeof(T))>
+	class UnrolledList: public BasicList<_UnrolledListBase<T,Allocator,ChunkCapacity>> {
+	public:
+		using BaseType = _UnrolledListBase<T,Allocator,ChunkCapacity>;
+		using typename BasicList<BaseType>::ValueType;
+
+		using typename BasicList<BaseType>::value_type;
+		using typename BasicList<BaseType>::allocator_type;
+		using typename BasicList<BaseType>::size_type;
+		using typename BasicList<BaseType>::reference;
+		using typename BasicList<BaseType>::const_reference;
+
+		using typename BasicList<BaseType>::iterator;
+		using typename BasicList<BaseType>::const_iterator;
+		using typename BasicList<BaseType>::reverse_iterator;
+		using typename BasicList<BaseType>::const_reverse_iterator;
+
+		using BasicList<BaseType>::BasicList;
+		using BasicList<BaseType>::operator=;
+		using BasicList<BaseType>::operator BaseType&;
+		using BasicList<BaseType>::operator BaseType&&;
+		using BasicList<BaseType>::operator const BaseType&;
+
+		using BasicList<BaseType>::size;
+		using BasicList<BaseType>::front;
+		using BasicList<BaseType>::back;
+
+		using BasicList<BaseType>::begin;
+		using BasicList<BaseType>::cbegin;
+		using BasicList<BaseType>::rbegin;
+		using BasicList<BaseType>::crbegin;
+		using BasicList<BaseType>::end;
+		using BasicList<BaseType>::cend;
+		using BasicList<BaseType>::rend;
+		using BasicList<BaseType>::crend;
+
+		using BasicList<BaseType>::findEqual;
+		using BasicList<BaseType>::findLastEqual;
+		using BasicList<BaseType>::findWhere;
+		using BasicList<BaseType>::findLastWhere;
+
+		using BasicList<BaseType>::toMap;
+
+		using BaseType::insert;
+		using BaseType::emplace;
+		using BaseType::push_front;
+		using BaseType::push_back;
+		using BaseType::emplace_front;
+		using BaseType::emplace_back;
+		using BaseType::pop_front;
+		using BaseType::pop_back;
+		using BaseType::remove;
+		using BaseType::remove_if;
+		using BaseType::erase;
+		using BaseType::clear;
+		using BaseType::splice;
+		using BaseType::get_allocator;
+
+		static constexpr size_type npos = (size_type)-1;
+		static constexpr size_type chunkCapacity = ChunkCapacity;
+
+		UnrolledList(const BaseType&);
+		UnrolledList(BaseType&&);
+		template<typename Collection, typename Transform, typename = IsCollection<std::remove_reference_t<Collection>>>
+		UnrolledList(Collection&& collection, Transform transform);
+
+		#ifdef __OBJC__
+		template<typename Transform>
+		UnrolledList(NSArray* objcArray, Transform transform);
+		#endif
+
+		#ifdef JNIEXPORT
+		template<typename Transform>
+		UnrolledList(JNIEnv* env, jobjectArray javaArray, Transform transform);
+		#endif
+
+		UnrolledList& operator=(const BaseType&);
+		UnrolledList& operator=(BaseType&&);
+
+		UnrolledList slice(size_type offset, size_type count = npos) const;
+
+		inline iterator insert(const_iterator pos, const BaseType& list);
+		inline iterator insert(const_iterator pos, BaseType&& list);
+
+		inline void pushFront(const T& value);
+		inline void pushFront(T&& value);
+		inline void pushFrontList(const BaseType& list);
+		inline void pushFrontList(BaseType&& list);
+		template<typename Collection, typename = IsCollectionOf<T,std::remove_reference_t<Collection>>>
+		inline void pushFrontList(Collection&& collection);
+		inline void popFront();
+		inline T extractFront();
+		inline UnrolledList extractListFront(size_t count = 1);
+		inline UnrolledList extractListFront(const_iterator end);
+
+		inline void pushBack(const T& value);
+		inline void pushBack(T&& value);
+		inline void pushBackList(const BaseType& list);
+		inline void pushBackList(BaseType&& list);
+		template<typename Collection, typename = IsCollectionOf<T,std::remove_reference_t<Collection>>>
+		inline void pushBackList(Collection&& list);
+		inline void popBack();
+		inline T extractBack();
+		inline UnrolledList extractListBack(size_t count = 1);
+		inline UnrolledList extractListBack(const_iterator start);
+
+		inline size_type removeEqual(const T& value);
+		inline bool removeFirstEqual(const T& value);
+		inline bool removeLastEqual(const T& value);
+		template<typename Predicate>
+		inline size_type removeWhere(Predicate predicate);
+		template<typename Predicate>
+		inline bool removeFirstWhere(Predicate predicate);
+		template<typename Predicate>
+		inline bool removeLastWhere(Predicate predicate);
+
+		template<typename Predicate>
+		inline UnrolledList where(Predicate predicate) const;
+
+		template<typename Transform>
+		inline auto map(Transform transform);
+		template<typename Transform>
+		inline auto map(Transform transform) const;
+
+		String toString() const;
+		void toString(StringifyWriter& writer) const;
+	};
+
+	template<typename T, typename A, size_t C, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	UnrolledList<T,A,C> operator+(const UnrolledList<T,A,C>& left, Collection&& right);
+	template<typename T, typename A, size_t C, typename Collection, typename = IsCollection<std::remove_reference_t<Collection>>>
+	UnrolledList<T,A,C> operator+(UnrolledList<T,A,C>&& left, Collection&& right);
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> operator+(UnrolledList<T,A,C>&& left, UnrolledList<T,A,C>&& right);
+
+
+
+#pragma mark _UnrolledListBase implementation
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase()
+	: _UnrolledListBase(A()) {
+		//
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(const A& allocator)
+	: _sentinel{ &_sentinel, &_sentinel, 0, 0 }, _size(0), _allocator(allocator) {
+		//
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(size_type count, const T& value, const A& allocator)
+	: _UnrolledListBase(allocator) {
+		assign(count, value);
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename InputIterator, typename _>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(InputIterator first, InputIterator last, const A& allocator)
+	: _UnrolledListBase(allocator) {
+		assign(first, last);
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(std::initializer_list<T> list, const A& allocator)
+	: _UnrolledListBase(allocator) {
+		assign(list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(const _UnrolledListBase& list)
+	: _UnrolledListBase(AllocatorTraits::select_on_container_copy_construction(list._allocator)) {
+		assign(list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::_UnrolledListBase(_UnrolledListBase&& list) noexcept
+	: _sentinel{ &_sentinel, &_sentinel, 0, 0 }, _size(list._size), _allocator(std::move(list._allocator)) {
+		moveChain(list._sentinel, _sentinel);
+		list._size = 0;
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>::~_UnrolledListBase() {
+		clear();
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>& _UnrolledListBase<T,A,C>::operator=(const _UnrolledListBase& list) {
+		if(&list != this) {
+			assign(list.begin(), list.end());
+		}
+		return *this;
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>& _UnrolledListBase<T,A,C>::operator=(_UnrolledListBase&& list) {
+		if(&list == this) {
+			return *this;
+		}
+		clear();
+		if constexpr(AllocatorTraits::propagate_on_container_move_assignment::value) {
+			_allocator = std::move(list._allocator);
+		} else if(_allocator != list._allocator) {
+			for(auto& item : list) {
+				emplace_back(std::move(item));
+			}
+			list.clear();
+			return *this;
+		}
+		moveChain(list._sentinel, _sentinel);
+		_size = list._size;
+		list._size = 0;
+		return *this;
+	}
+
+	template<typename T, typename A, size_t C>
+	_UnrolledListBase<T,A,C>& _UnrolledListBase<T,A,C>::operator=(std::initializer_list<T> list) {
+		assign(list.begin(), list.end());
+		return *this;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::assign(size_type count, const T& value) {
+		clear();
+		for(size_type i=0; i<count; i++) {
+			emplace_back(value);
+		}
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename InputIterator, typename _>
+	void _UnrolledListBase<T,A,C>::assign(InputIterator first, InputIterator last) {
+		clear();
+		for(; first != last; first++) {
+			emplace_back(*first);
+		}
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::assign(std::initializer_list<T> list) {
+		assign(list.begin(), list.end());
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::allocator_type _UnrolledListBase<T,A,C>::get_allocator() const noexcept {
+		return _allocator;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::begin() noexcept {
+		return iterator(_sentinel.next, _sentinel.next->startIndex);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_iterator _UnrolledListBase<T,A,C>::begin() const noexcept {
+		return const_iterator(_sentinel.next, _sentinel.next->startIndex);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_iterator _UnrolledListBase<T,A,C>::cbegin() const noexcept {
+		return begin();
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::end() noexcept {
+		return iterator(&_sentinel, 0);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_iterator _UnrolledListBase<T,A,C>::end() const noexcept {
+		return const_iterator(const_cast<ChunkHeader*>(&_sentinel), 0);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_iterator _UnrolledListBase<T,A,C>::cend() const noexcept {
+		return end();
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::reverse_iterator _UnrolledListBase<T,A,C>::rbegin() noexcept {
+		return reverse_iterator(end());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reverse_iterator _UnrolledListBase<T,A,C>::rbegin() const noexcept {
+		return const_reverse_iterator(end());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reverse_iterator _UnrolledListBase<T,A,C>::crbegin() const noexcept {
+		return const_reverse_iterator(end());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::reverse_iterator _UnrolledListBase<T,A,C>::rend() noexcept {
+		return reverse_iterator(begin());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reverse_iterator _UnrolledListBase<T,A,C>::rend() const noexcept {
+		return const_reverse_iterator(begin());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reverse_iterator _UnrolledListBase<T,A,C>::crend() const noexcept {
+		return const_reverse_iterator(begin());
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	bool _UnrolledListBase<T,A,C>::empty() const noexcept {
+		return _size == 0;
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::size_type _UnrolledListBase<T,A,C>::size() const noexcept {
+		return _size;
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::size_type _UnrolledListBase<T,A,C>::max_size() const noexcept {
+		return AllocatorTraits::max_size(_allocator);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::reference _UnrolledListBase<T,A,C>::front() {
+		return dataOf(_sentinel.next)[_sentinel.next->startIndex];
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reference _UnrolledListBase<T,A,C>::front() const {
+		return dataOf(_sentinel.next)[_sentinel.next->startIndex];
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::reference _UnrolledListBase<T,A,C>::back() {
+		return dataOf(_sentinel.prev)[_sentinel.prev->endIndex - 1];
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_reference _UnrolledListBase<T,A,C>::back() const {
+		return dataOf(_sentinel.prev)[_sentinel.prev->endIndex - 1];
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::clear() noexcept {
+		ChunkHeader* chunk = _sentinel.next;
+		while(chunk != &_sentinel) {
+			ChunkHeader* next = chunk->next;
+			T* data = dataOf(chunk);
+			destroyRange(data + chunk->startIndex, data + chunk->endIndex);
+			deallocateChunk(chunk);
+			chunk = next;
+		}
+		_sentinel.next = &_sentinel;
+		_sentinel.prev = &_sentinel;
+		_size = 0;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::insert(const_iterator pos, const T& value) {
+		return emplace(pos, value);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::insert(const_iterator pos, T&& value) {
+		return emplace(pos, std::move(value));
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename InputIterator, typename _>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::insert(const_iterator pos, InputIterator first, InputIterator last) {
+		_UnrolledListBase list(first, last, _allocator);
+		if(list._size == 0) {
+			return iterator(pos._chunk, pos.index());
+		}
+		ChunkHeader* firstChunk = list._sentinel.next;
+		list.transferChunks(firstChunk, &list._sentinel, *this, splitChunkAt(pos));
+		return iterator(firstChunk, firstChunk->startIndex);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::insert(const_iterator pos, std::initializer_list<T> list) {
+		return insert(pos, list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename... Args>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::emplace(const_iterator pos, Args&&... args) {
+		ChunkHeader* chunk = pos._chunk;
+		size_type index = pos.index();
+		if(index == chunk->startIndex) {
+			// inserting at a chunk boundary: use the free space around it if possible
+			ChunkHeader* prev = chunk->prev;
+			if(prev != &_sentinel && prev->endIndex < C) {
+				AllocatorTraits::construct(_allocator, dataOf(prev) + prev->endIndex, std::forward<Args>(args)...);
+				prev->endIndex++;
+				_size++;
+				return iterator(prev, prev->endIndex - 1);
+			} else if(chunk != &_sentinel && chunk->startIndex > 0) {
+				AllocatorTraits::construct(_allocator, dataOf(chunk) + chunk->startIndex - 1, std::forward<Args>(args)...);
+				chunk->startIndex--;
+				_size++;
+				return iterator(chunk, chunk->startIndex);
+			}
+			return emplaceInNewChunk(chunk, (chunk == &_sentinel) ? 0 : (C - 1), std::forward<Args>(args)...);
+		}
+		if(chunk->startIndex == 0 && chunk->endIndex == C) {
+			// the chunk is full, so split it at pos to make room before pos
+			ChunkHeader* splitChunk = splitChunkAt(pos);
+			return emplace(const_iterator(splitChunk, splitChunk->startIndex), std::forward<Args>(args)...);
+		}
+		T value(std::forward<Args>(args)...);
+		T* data = dataOf(chunk);
+		if(chunk->endIndex < C && (chunk->startIndex == 0 || (chunk->endIndex - index) <= (index - chunk->startIndex))) {
+			// shift the trailing elements forward
+			AllocatorTraits::construct(_allocator, data + chunk->endIndex, std::move(data[chunk->endIndex - 1]));
+			std::move_backward(data + index, data + chunk->endIndex - 1, data + chunk->endIndex);
+			chunk->endIndex++;
+			data[index] = std::move(value);
+			_size++;
+			return iterator(chunk, index);
+		}
+		// shift the leading elements backward
+		AllocatorTraits::construct(_allocator, data + chunk->startIndex - 1, std::move(data[chunk->startIndex]));
+		std::move(data + chunk->startIndex + 1, data + index, data + chunk->startIndex);
+		chunk->startIndex--;
+		data[index - 1] = std::move(value);
+		_size++;
+		return iterator(chunk, index - 1);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::erase(const_iterator pos) {
+		ChunkHeader* chunk = pos._chunk;
+		size_type index = pos.index();
+		T* data = dataOf(chunk);
+		if((index - chunk->startIndex) < (chunk->endIndex - index - 1)) {
+			std::move_backward(data + chunk->startIndex, data + index, data + index + 1);
+			AllocatorTraits::destroy(_allocator, data + chunk->startIndex);
+			chunk->startIndex++;
+			index++;
+		} else {
+			std::move(data + index + 1, data + chunk->endIndex, data + index);
+			chunk->endIndex--;
+			AllocatorTraits::destroy(_allocator, data + chunk->endIndex);
+		}
+		_size--;
+		if(chunk->startIndex == chunk->endIndex) {
+			ChunkHeader* next = chunk->next;
+			unlinkChunks(chunk, chunk);
+			deallocateChunk(chunk);
+			return iterator(next, next->startIndex);
+		}
+		return makeIterator(chunk, index);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::erase(const_iterator first, const_iterator last) {
+		ChunkHeader* firstChunk = first._chunk;
+		ChunkHeader* lastChunk = last._chunk;
+		if(first == last) {
+			return iterator(lastChunk, last.index());
+		}
+		if(firstChunk == lastChunk) {
+			T* data = dataOf(firstChunk);
+			size_type count = last.index() - first.index();
+			size_type index;
+			if((first.index() - firstChunk->startIndex) < (firstChunk->endIndex - last.index())) {
+				std::move_backward(data + firstChunk->startIndex, data + first.index(), data + last.index());
+				destroyRange(data + firstChunk->startIndex, data + firstChunk->startIndex + count);
+				firstChunk->startIndex += count;
+				index = last.index();
+			} else {
+				std::move(data + last.index(), data + firstChunk->endIndex, data + first.index());
+				destroyRange(data + firstChunk->endIndex - count, data + firstChunk->endIndex);
+				firstChunk->endIndex -= count;
+				index = first.index();
+			}
+			_size -= count;
+			if(firstChunk->startIndex == firstChunk->endIndex) {
+				ChunkHeader* next = firstChunk->next;
+				unlinkChunks(firstChunk, firstChunk);
+				deallocateChunk(firstChunk);
+				return iterator(next, next->startIndex);
+			}
+			return makeIterator(firstChunk, index);
+		}
+		// erase the tail of the first chunk, every chunk in between, and the head of the last chunk
+		T* firstData = dataOf(firstChunk);
+		_size -= (firstChunk->endIndex - first.index());
+		destroyRange(firstData + first.index(), firstData + firstChunk->endIndex);
+		firstChunk->endIndex = first.index();
+		ChunkHeader* chunk = firstChunk->next;
+		while(chunk != lastChunk) {
+			ChunkHeader* next = chunk->next;
+			T* data = dataOf(chunk);
+			_size -= (chunk->endIndex - chunk->startIndex);
+			destroyRange(data + chunk->startIndex, data + chunk->endIndex);
+			unlinkChunks(chunk, chunk);
+			deallocateChunk(chunk);
+			chunk = next;
+		}
+		if(lastChunk != &_sentinel) {
+			T* lastData = dataOf(lastChunk);
+			_size -= (last.index() - lastChunk->startIndex);
+			destroyRange(lastData + lastChunk->startIndex, lastData + last.index());
+			lastChunk->startIndex = last.index();
+		}
+		if(firstChunk->startIndex == firstChunk->endIndex) {
+			unlinkChunks(firstChunk, firstChunk);
+			deallocateChunk(firstChunk);
+		}
+		return iterator(lastChunk, lastChunk->startIndex);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::push_back(const T& value) {
+		emplace_back(value);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::push_back(T&& value) {
+		emplace_back(std::move(value));
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename... Args>
+	typename _UnrolledListBase<T,A,C>::reference _UnrolledListBase<T,A,C>::emplace_back(Args&&... args) {
+		ChunkHeader* chunk = _sentinel.prev;
+		if(chunk == &_sentinel || chunk->endIndex == C) {
+			return *emplaceInNewChunk(&_sentinel, 0, std::forward<Args>(args)...);
+		}
+		T* ptr = dataOf(chunk) + chunk->endIndex;
+		AllocatorTraits::construct(_allocator, ptr, std::forward<Args>(args)...);
+		chunk->endIndex++;
+		_size++;
+		return *ptr;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::pop_back() {
+		ChunkHeader* chunk = _sentinel.prev;
+		chunk->endIndex--;
+		AllocatorTraits::destroy(_allocator, dataOf(chunk) + chunk->endIndex);
+		_size--;
+		if(chunk->startIndex == chunk->endIndex) {
+			unlinkChunks(chunk, chunk);
+			deallocateChunk(chunk);
+		}
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::push_front(const T& value) {
+		emplace_front(value);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::push_front(T&& value) {
+		emplace_front(std::move(value));
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename... Args>
+	typename _UnrolledListBase<T,A,C>::reference _UnrolledListBase<T,A,C>::emplace_front(Args&&... args) {
+		ChunkHeader* chunk = _sentinel.next;
+		if(chunk == &_sentinel || chunk->startIndex == 0) {
+			// new front chunks fill from the back so that repeated pushes stay O(1)
+			return *emplaceInNewChunk(chunk, C - 1, std::forward<Args>(args)...);
+		}
+		T* ptr = dataOf(chunk) + chunk->startIndex - 1;
+		AllocatorTraits::construct(_allocator, ptr, std::forward<Args>(args)...);
+		chunk->startIndex--;
+		_size++;
+		return *ptr;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::pop_front() {
+		ChunkHeader* chunk = _sentinel.next;
+		AllocatorTraits::destroy(_allocator, dataOf(chunk) + chunk->startIndex);
+		chunk->startIndex++;
+		_size--;
+		if(chunk->startIndex == chunk->endIndex) {
+			unlinkChunks(chunk, chunk);
+			deallocateChunk(chunk);
+		}
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::splice(const_iterator pos, _UnrolledListBase& list) {
+		if(&list == this || list._size == 0) {
+			return;
+		}
+		if(_allocator != list._allocator) {
+			insert(pos, std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
+			list.clear();
+			return;
+		}
+		list.transferChunks(list._sentinel.next, &list._sentinel, *this, splitChunkAt(pos));
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::splice(const_iterator pos, _UnrolledListBase&& list) {
+		splice(pos, list);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::size_type _UnrolledListBase<T,A,C>::remove(const T& value) {
+		return remove_if([&](const T& item) {
+			return item == value;
+		});
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Predicate>
+	typename _UnrolledListBase<T,A,C>::size_type _UnrolledListBase<T,A,C>::remove_if(Predicate predicate) {
+		size_type count = 0;
+		ChunkHeader* chunk = _sentinel.next;
+		while(chunk != &_sentinel) {
+			ChunkHeader* next = chunk->next;
+			T* data = dataOf(chunk);
+			size_type writeIndex = chunk->startIndex;
+			for(size_type i=chunk->startIndex; i<chunk->endIndex; i++) {
+				if(!predicate(data[i])) {
+					if(writeIndex != i) {
+						data[writeIndex] = std::move(data[i]);
+					}
+					writeIndex++;
+				}
+			}
+			count += (chunk->endIndex - writeIndex);
+			destroyRange(data + writeIndex, data + chunk->endIndex);
+			chunk->endIndex = writeIndex;
+			if(chunk->startIndex == chunk->endIndex) {
+				unlinkChunks(chunk, chunk);
+				deallocateChunk(chunk);
+			}
+			chunk = next;
+		}
+		_size -= count;
+		if(count > 0) {
+			mergeSparseChunks();
+		}
+		return count;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::swap(_UnrolledListBase& list) noexcept {
+		if(&list == this) {
+			return;
+		}
+		ChunkHeader tmp = { &tmp, &tmp, 0, 0 };
+		moveChain(_sentinel, tmp);
+		moveChain(list._sentinel, _sentinel);
+		moveChain(tmp, list._sentinel);
+		std::swap(_size, list._size);
+		std::swap(_allocator, list._allocator);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	bool _UnrolledListBase<T,A,C>::operator==(const _UnrolledListBase& list) const {
+		return _size == list._size && std::equal(begin(), end(), list.begin());
+	}
+
+	template<typename T, typename A, size_t C>
+	bool _UnrolledListBase<T,A,C>::operator!=(const _UnrolledListBase& list) const {
+		return !operator==(list);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::const_iterator _UnrolledListBase<T,A,C>::iteratorAt(size_type offset) const {
+		if(offset >= _size) {
+			return end();
+		}
+		if(offset < (_size / 2)) {
+			ChunkHeader* chunk = _sentinel.next;
+			while(offset >= (chunk->endIndex - chunk->startIndex)) {
+				offset -= (chunk->endIndex - chunk->startIndex);
+				chunk = chunk->next;
+			}
+			return const_iterator(chunk, chunk->startIndex + offset);
+		}
+		size_type offsetFromEnd = _size - offset;
+		ChunkHeader* chunk = _sentinel.prev;
+		while(offsetFromEnd > (chunk->endIndex - chunk->startIndex)) {
+			offsetFromEnd -= (chunk->endIndex - chunk->startIndex);
+			chunk = chunk->prev;
+		}
+		return const_iterator(chunk, chunk->endIndex - offsetFromEnd);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::splitFront(const_iterator end, _UnrolledListBase& list) {
+		ChunkHeader* splitChunk = splitChunkAt(end);
+		transferChunks(_sentinel.next, splitChunk, list, &list._sentinel);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::splitBack(const_iterator start, _UnrolledListBase& list) {
+		ChunkHeader* splitChunk = splitChunkAt(start);
+		transferChunks(splitChunk, &_sentinel, list, list._sentinel.next);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	T* _UnrolledListBase<T,A,C>::dataOf(ChunkHeader* chunk) noexcept {
+		return reinterpret_cast<T*>(static_cast<Chunk*>(chunk)->storage);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::linkChunks(ChunkHeader* pos, ChunkHeader* first, ChunkHeader* last) noexcept {
+		ChunkHeader* prev = pos->prev;
+		prev->next = first;
+		first->prev = prev;
+		last->next = pos;
+		pos->prev = last;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::unlinkChunks(ChunkHeader* first, ChunkHeader* last) noexcept {
+		first->prev->next = last->next;
+		last->next->prev = first->prev;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::moveChain(ChunkHeader& source, ChunkHeader& dest) noexcept {
+		if(source.next == &source) {
+			dest.next = &dest;
+			dest.prev = &dest;
+			return;
+		}
+		dest.next = source.next;
+		dest.prev = source.prev;
+		dest.next->prev = &dest;
+		dest.prev->next = &dest;
+		source.next = &source;
+		source.prev = &source;
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::makeIterator(ChunkHeader* chunk, size_type index) noexcept {
+		if(index == chunk->endIndex) {
+			chunk = chunk->next;
+			index = chunk->startIndex;
+		}
+		return iterator(chunk, index);
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::Chunk* _UnrolledListBase<T,A,C>::allocateChunk(size_type index) {
+		ChunkAllocator allocator(_allocator);
+		Chunk* chunk = ChunkAllocatorTraits::allocate(allocator, 1);
+		chunk->prev = nullptr;
+		chunk->next = nullptr;
+		chunk->startIndex = index;
+		chunk->endIndex = index;
+		return chunk;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::deallocateChunk(ChunkHeader* chunk) noexcept {
+		ChunkAllocator allocator(_allocator);
+		ChunkAllocatorTraits::deallocate(allocator, static_cast<Chunk*>(chunk), 1);
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::destroyRange(T* first, T* last) noexcept {
+		if constexpr(!std::is_trivially_destructible_v<T>) {
+			for(; first != last; first++) {
+				AllocatorTraits::destroy(_allocator, first);
+			}
+		}
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::relocateRange(T* first, T* last, T* dest) {
+		for(T* it=first; it != last; it++, dest++) {
+			AllocatorTraits::construct(_allocator, dest, std::move(*it));
+		}
+		destroyRange(first, last);
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename... Args>
+	typename _UnrolledListBase<T,A,C>::iterator _UnrolledListBase<T,A,C>::emplaceInNewChunk(ChunkHeader* pos, size_type index, Args&&... args) {
+		Chunk* chunk = allocateChunk(index);
+		try {
+			AllocatorTraits::construct(_allocator, dataOf(chunk) + index, std::forward<Args>(args)...);
+		} catch(...) {
+			deallocateChunk(chunk);
+			throw;
+		}
+		chunk->endIndex = index + 1;
+		linkChunks(pos, chunk, chunk);
+		_size++;
+		return iterator(chunk, index);
+	}
+
+	template<typename T, typename A, size_t C>
+	typename _UnrolledListBase<T,A,C>::ChunkHeader* _UnrolledListBase<T,A,C>::splitChunkAt(const_iterator pos) {
+		ChunkHeader* chunk = pos._chunk;
+		size_type index = pos.index();
+		if(index == chunk->startIndex) {
+			return chunk;
+		}
+		// move whichever side of pos is smaller into a new chunk, keeping the same indexes
+		T* data = dataOf(chunk);
+		if((index - chunk->startIndex) <= (chunk->endIndex - index)) {
+			Chunk* newChunk = allocateChunk(chunk->startIndex);
+			relocateRange(data + chunk->startIndex, data + index, dataOf(newChunk) + chunk->startIndex);
+			newChunk->endIndex = index;
+			chunk->startIndex = index;
+			linkChunks(chunk, newChunk, newChunk);
+			return chunk;
+		}
+		Chunk* newChunk = allocateChunk(index);
+		relocateRange(data + index, data + chunk->endIndex, dataOf(newChunk) + index);
+		newChunk->endIndex = chunk->endIndex;
+		chunk->endIndex = index;
+		linkChunks(chunk->next, newChunk, newChunk);
+		return newChunk;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::transferChunks(ChunkHeader* first, ChunkHeader* end, _UnrolledListBase& list, ChunkHeader* pos) noexcept {
+		if(first == end) {
+			return;
+		}
+		ChunkHeader* last = end->prev;
+		size_type count = 0;
+		for(ChunkHeader* chunk=first; chunk != end; chunk=chunk->next) {
+			count += (chunk->endIndex - chunk->startIndex);
+		}
+		unlinkChunks(first, last);
+		linkChunks(pos, first, last);
+		_size -= count;
+		list._size += count;
+	}
+
+	template<typename T, typename A, size_t C>
+	void _UnrolledListBase<T,A,C>::mergeSparseChunks() {
+		ChunkHeader* chunk = _sentinel.next;
+		while(chunk != &_sentinel && chunk->next != &_sentinel) {
+			ChunkHeader* next = chunk->next;
+			size_type count = chunk->endIndex - chunk->startIndex;
+			size_type nextCount = next->endIndex - next->startIndex;
+			if((count + nextCount) > C) {
+				chunk = next;
+				continue;
+			}
+			T* data = dataOf(chunk);
+			if((chunk->endIndex + nextCount) > C) {
+				// shift this chunk's elements to the start of its storage
+				size_type startIndex = chunk->startIndex;
+				for(size_type i=0; i<count; i++) {
+					if(i < startIndex) {
+						AllocatorTraits::construct(_allocator, data + i, std::move(data[startIndex + i]));
+					} else {
+						data[i] = std::move(data[startIndex + i]);
+					}
+				}
+				destroyRange(data + std::max(startIndex, count), data + startIndex + count);
+				chunk->startIndex = 0;
+				chunk->endIndex = count;
+			}
+			T* nextData = dataOf(next);
+			relocateRange(nextData + next->startIndex, nextData + next->endIndex, data + chunk->endIndex);
+			chunk->endIndex += nextCount;
+			unlinkChunks(next, next);
+			deallocateChunk(next);
+		}
+	}
+
+
+
+#pragma mark UnrolledList implementation
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C>::UnrolledList(const BaseType& list): BasicList<BaseType>(list) {
+		//
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C>::UnrolledList(BaseType&& list): BasicList<BaseType>(std::move(list)) {
+		//
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Collection, typename Transform, typename _>
+	UnrolledList<T,A,C>::UnrolledList(Collection&& collection, Transform transform) {
+		if constexpr(std::is_reference_v<decltype(*collection.begin())>) {
+			for(auto& item : collection) {
+				pushBack(transform(item));
+			}
+		} else {
+			for(auto item : collection) {
+				pushBack(transform(item));
+			}
+		}
+	}
+
+	#ifdef __OBJC__
+
+	template<typename T, typename A, size_t C>
+	template<typename Transform>
+	UnrolledList<T,A,C>::UnrolledList(NSArray* objcArray, Transform transform) {
+		for(NSObject* obj in objcArray) {
+			pushBack(transform(obj));
+		}
+	}
+
+	#endif
+
+	#ifdef JNIEXPORT
+
+	template<typename T, typename A, size_t C>
+	template<typename Transform>
+	UnrolledList<T,A,C>::UnrolledList(JNIEnv* env, jobjectArray javaArray, Transform transform) {
+		jsize javaArraySize = env->GetArrayLength(javaArray);
+		for(jsize i=0; i<javaArraySize; i++) {
+			pushBack(transform(env, env->GetObjectArrayElement(javaArray, i)));
+		}
+	}
+
+	#endif
+
+
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C>& UnrolledList<T,A,C>::operator=(const BaseType& list) {
+		BaseType::operator=(list);
+		return *this;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C>& UnrolledList<T,A,C>::operator=(BaseType&& list) {
+		BaseType::operator=(std::move(list));
+		return *this;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::slice(size_type offset, size_type count) const {
+		UnrolledList<T,A,C> sublist(get_allocator());
+		auto endIt = end();
+		for(auto it = this->iteratorAt(offset); it != endIt && sublist.size() < count; it++) {
+			sublist.pushBack(*it);
+		}
+		return sublist;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename UnrolledList<T,A,C>::iterator UnrolledList<T,A,C>::insert(const_iterator pos, const BaseType& list) {
+		return insert(pos, list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	typename UnrolledList<T,A,C>::iterator UnrolledList<T,A,C>::insert(const_iterator pos, BaseType&& list) {
+		if(list.size() == 0) {
+			return erase(pos, pos);
+		} else if(get_allocator() != list.get_allocator()) {
+			return insert(pos, std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
+		}
+		auto it = list.begin();
+		splice(pos, list);
+		return it;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushFront(const T& value) {
+		push_front(value);
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushFront(T&& value) {
+		push_front(std::move(value));
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushFrontList(const BaseType& list) {
+		insert(begin(), list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushFrontList(BaseType&& list) {
+		splice(begin(), list);
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Collection, typename _>
+	void UnrolledList<T,A,C>::pushFrontList(Collection&& list) {
+		insert(begin(), list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::popFront() {
+		FGL_ASSERT(size() > 0, "cannot call popFront on empty list");
+		pop_front();
+	}
+
+	template<typename T, typename A, size_t C>
+	T UnrolledList<T,A,C>::extractFront() {
+		FGL_ASSERT(size() > 0, "cannot call extractFront on empty list");
+		auto value = std::move(front());
+		pop_front();
+		return value;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::extractListFront(size_t count) {
+		UnrolledList<T,A,C> extracted(get_allocator());
+		this->splitFront(this->iteratorAt(count), extracted);
+		return extracted;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::extractListFront(const_iterator end) {
+		UnrolledList<T,A,C> extracted(get_allocator());
+		this->splitFront(end, extracted);
+		return extracted;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushBack(const T& value) {
+		push_back(value);
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushBack(T&& value) {
+		push_back(std::move(value));
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushBackList(const BaseType& list) {
+		insert(end(), list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::pushBackList(BaseType&& list) {
+		splice(end(), list);
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Collection, typename _>
+	void UnrolledList<T,A,C>::pushBackList(Collection&& list) {
+		insert(end(), list.begin(), list.end());
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::popBack() {
+		FGL_ASSERT(size() > 0, "cannot call popBack on empty list");
+		pop_back();
+	}
+
+	template<typename T, typename A, size_t C>
+	T UnrolledList<T,A,C>::extractBack() {
+		FGL_ASSERT(size() > 0, "cannot call extractBack on empty list");
+		auto value = std::move(back());
+		pop_back();
+		return value;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::extractListBack(size_t count) {
+		UnrolledList<T,A,C> extracted(get_allocator());
+		this->splitBack(this->iteratorAt(size() - std::min(count, size())), extracted);
+		return extracted;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::extractListBack(const_iterator start) {
+		UnrolledList<T,A,C> extracted(get_allocator());
+		this->splitBack(start, extracted);
+		return extracted;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	typename UnrolledList<T,A,C>::size_type UnrolledList<T,A,C>::removeEqual(const T& value) {
+		return remove(value);
+	}
+
+	template<typename T, typename A, size_t C>
+	bool UnrolledList<T,A,C>::removeFirstEqual(const T& value) {
+		auto it = findEqual(value);
+		if(it == end()) {
+			return false;
+		}
+		erase(it);
+		return true;
+	}
+
+	template<typename T, typename A, size_t C>
+	bool UnrolledList<T,A,C>::removeLastEqual(const T& value) {
+		auto it = findLastEqual(value);
+		if(it == end()) {
+			return false;
+		}
+		erase(it);
+		return true;
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Predicate>
+	typename UnrolledList<T,A,C>::size_type UnrolledList<T,A,C>::removeWhere(Predicate predicate) {
+		return remove_if(predicate);
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Predicate>
+	bool UnrolledList<T,A,C>::removeFirstWhere(Predicate predicate) {
+		auto it = findWhere(predicate);
+		if(it == end()) {
+			return false;
+		}
+		erase(it);
+		return true;
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Predicate>
+	bool UnrolledList<T,A,C>::removeLastWhere(Predicate predicate) {
+		auto it = findLastWhere(predicate);
+		if(it == end()) {
+			return false;
+		}
+		erase(it);
+		return true;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	template<typename Predicate>
+	UnrolledList<T,A,C> UnrolledList<T,A,C>::where(Predicate predicate) const {
+		UnrolledList<T,A,C> newList(get_allocator());
+		for(const_reference item : *this) {
+			if(predicate(item)) {
+				newList.pushBack(item);
+			}
+		}
+		return newList;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	template<typename Transform>
+	auto UnrolledList<T,A,C>::map(Transform transform) {
+		using ReturnType = decltype(transform(front()));
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		UnrolledList<ReturnType,ReturnAllocator> newList(allocator);
+		for(reference item : *this) {
+			newList.pushBack(transform(item));
+		}
+		return newList;
+	}
+
+	template<typename T, typename A, size_t C>
+	template<typename Transform>
+	auto UnrolledList<T,A,C>::map(Transform transform) const {
+		using ReturnType = decltype(transform(front()));
+		using ReturnAllocator = typename std::allocator_traits<A>::template rebind_alloc<ReturnType>;
+		ReturnAllocator allocator(get_allocator());
+		UnrolledList<ReturnType,ReturnAllocator> newList(allocator);
+		for(const_reference item : *this) {
+			newList.pushBack(transform(item));
+		}
+		return newList;
+	}
+
+
+
+	template<typename T, typename A, size_t C>
+	String UnrolledList<T,A,C>::toString() const {
+		String str;
+		StringifyWriter writer(str);
+		toString(writer);
+		return str;
+	}
+
+	template<typename T, typename A, size_t C>
+	void UnrolledList<T,A,C>::toString(StringifyWriter& writer) const {
+		writer.write("UnrolledList<");
+		writer.write(stringify_type<T>());
+		if(size() == 0) {
+			writer.write(">[]");
+			return;
+		}
+		writer.writeItems(begin(), end(), ">[\n\t", ",\n\t", "\n]", [&](const_reference item) {
+			stringifyTo<T>(writer, item);
+		});
+	}
+
+
+
+	template<typename T, typename A, size_t C, typename Collection, typename _>
+	UnrolledList<T,A,C> operator+(const UnrolledList<T,A,C>& left, Collection&& right) {
+		UnrolledList<T,A,C> newList(left.get_allocator());
+		newList.pushBackList(left);
+		newList.pushBackList(std::forward<Collection>(right));
+		return newList;
+	}
+
+	template<typename T, typename A, size_t C, typename Collection, typename _>
+	UnrolledList<T,A,C> operator+(UnrolledList<T,A,C>&& left, Collection&& right) {
+		auto newList = std::move(left);
+		newList.pushBackList(std::forward<Collection>(right));
+		return newList;
+	}
+
+	template<typename T, typename A, size_t C>
+	UnrolledList<T,A,C> operator+(UnrolledList<T,A,C>&& left, UnrolledList<T,A,C>&& right) {
+		auto newList = std::move(left);
+		newList.splice(newList.end(), right);
+		return newList;
+	}
+
+
+
+	namespace pmr {
+		template<typename T>
+		using UnrolledList = fgl::UnrolledList<T,PolymorphicAllocator<T>>;
+	}
+}
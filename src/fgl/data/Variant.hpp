@@ -9,8 +9,11 @@
 #pragma once
 
 #include <fgl/data/Common.hpp>
+#include <fgl/data/TypeId.hpp>
+#include <functional>
 #include <variant>
 #include <typeinfo>
+#include <utility>
 
 namespace fgl {
 	template<typename... Types>
@@ -23,7 +26,42 @@ namespace fgl {
 	template<typename... T>
 	struct is_variant<Variant<T...>>: std::true_type {};
 
-	String stringify_type(const std::type_info&);
+	/// Visits one or more variants with a single visitor, dispatching through nested switch statements.
+	/// Each additional variant adds a switch inside each case of the previous one, rather than a table of every combination.
+	template<typename Visitor, typename VariantType, typename... VariantTypes>
+	constexpr decltype(auto) visitVariants(Visitor&& visitor, VariantType&& variant, VariantTypes&&... variants);
+
+	/// Gives visitVariants unchecked access to the alternatives of a variant type
+	template<typename VariantType>
+	struct _VariantAccess;
+
+	template<typename... Types>
+	struct _VariantAccess<std::variant<Types...>> {
+		static constexpr size_t size = sizeof...(Types);
+		
+		template<size_t Index, typename VariantType>
+		static constexpr decltype(auto) get(VariantType&& variant) noexcept {
+			using BaseType = std::conditional_t<std::is_const_v<std::remove_reference_t<VariantType>>, const std::variant<Types...>, std::variant<Types...>>;
+			auto ptr = std::get_if<Index>(static_cast<BaseType*>(&variant));
+			if constexpr(std::is_lvalue_reference_v<VariantType>) {
+				return *ptr;
+			} else {
+				return std::move(*ptr);
+			}
+		}
+	};
+
+	template<typename... Types>
+	struct _VariantAccess<Variant<Types...>>: _VariantAccess<std::variant<Types...>> {};
+
+	/// The number of alternatives handled by each switch in visitVariants. Variants with more alternatives chain several switches.
+	constexpr size_t _VARIANT_SWITCH_SIZE = 32;
+
+	template<size_t Offset, typename Visitor, typename VariantType>
+	constexpr decltype(auto) _visitVariantFrom(Visitor&& visitor, VariantType&& variant, size_t index);
+
+	template<typename T, typename... Types>
+	constexpr size_t _variantIndexOf() noexcept;
 
 	template<typename... Types>
 	class Variant: public std::variant<Types...> {
@@ -40,9 +78,11 @@ namespace fgl {
 		operator const BaseType&() const&;
 		
 		template<typename Visitor>
-		inline decltype(auto) visit(Visitor&& visitor);
+		inline decltype(auto) visit(Visitor&& visitor) &;
+		template<typename Visitor>
+		inline decltype(auto) visit(Visitor&& visitor) &&;
 		template<typename Visitor>
-		inline decltype(auto) visit(Visitor&& visitor) const;
+		inline decltype(auto) visit(Visitor&& visitor) const&;
 		
 		template<typename T>
 		inline bool is() const;
@@ -73,15 +113,83 @@ namespace fgl {
 		inline OptionalRef<const T> maybeGetRef() const;
 		
 		const std::type_info& type() const;
+		TypeId typeId() const;
 		String typeName() const;
 	};
 
 
 
+	#pragma mark visitVariants implementation
+
+	#define _FGL_VARIANT_VISIT_CASE(i) \
+		case i: \
+			if constexpr((Offset + i) < size) { \
+				return std::invoke(std::forward<Visitor>(visitor), Access::template get<Offset + i>(std::forward<VariantType>(variant))); \
+			} \
+			break;
+	#define _FGL_VARIANT_VISIT_CASES_8(i) \
+		_FGL_VARIANT_VISIT_CASE(i) _FGL_VARIANT_VISIT_CASE(i+1) _FGL_VARIANT_VISIT_CASE(i+2) _FGL_VARIANT_VISIT_CASE(i+3) \
+		_FGL_VARIANT_VISIT_CASE(i+4) _FGL_VARIANT_VISIT_CASE(i+5) _FGL_VARIANT_VISIT_CASE(i+6) _FGL_VARIANT_VISIT_CASE(i+7)
+
+	template<size_t Offset, typename Visitor, typename VariantType>
+	constexpr decltype(auto) _visitVariantFrom(Visitor&& visitor, VariantType&& variant, size_t index) {
+		using Access = _VariantAccess<std::remove_cvref_t<VariantType>>;
+		constexpr size_t size = Access::size;
+		static_assert(_VARIANT_SWITCH_SIZE == 32, "the switch below must have one case per _VARIANT_SWITCH_SIZE");
+		switch(index - Offset) {
+			_FGL_VARIANT_VISIT_CASES_8(0)
+			_FGL_VARIANT_VISIT_CASES_8(8)
+			_FGL_VARIANT_VISIT_CASES_8(16)
+			_FGL_VARIANT_VISIT_CASES_8(24)
+			default:
+				if constexpr((Offset + _VARIANT_SWITCH_SIZE) < size) {
+					return _visitVariantFrom<Offset + _VARIANT_SWITCH_SIZE>(std::forward<Visitor>(visitor), std::forward<VariantType>(variant), index);
+				}
+				break;
+		}
+		// the variant is valueless
+		throw std::bad_variant_access();
+	}
+
+	#undef _FGL_VARIANT_VISIT_CASES_8
+	#undef _FGL_VARIANT_VISIT_CASE
+
+	template<typename Visitor, typename VariantType, typename... VariantTypes>
+	constexpr decltype(auto) visitVariants(Visitor&& visitor, VariantType&& variant, VariantTypes&&... variants) {
+		if constexpr(sizeof...(VariantTypes) == 0) {
+			return _visitVariantFrom<0>(std::forward<Visitor>(visitor), std::forward<VariantType>(variant), variant.index());
+		} else {
+			auto index = variant.index();
+			return _visitVariantFrom<0>([&](auto&& value) -> decltype(auto) {
+				return visitVariants([&](auto&&... values) -> decltype(auto) {
+					return std::invoke(std::forward<Visitor>(visitor), std::forward<decltype(value)>(value), std::forward<decltype(values)>(values)...);
+				}, std::forward<VariantTypes>(variants)...);
+			}, std::forward<VariantType>(variant), index);
+		}
+	}
+
+	template<typename T, typename... Types>
+	constexpr size_t _variantIndexOf() noexcept {
+		// gives sizeof...(Types) if T is not an alternative, or if it occurs more than once
+		constexpr bool matches[] = { std::is_same_v<T,Types>... };
+		size_t index = sizeof...(Types);
+		for(size_t i=0; i<sizeof...(Types); i++) {
+			if(matches[i]) {
+				if(index != sizeof...(Types)) {
+					return sizeof...(Types);
+				}
+				index = i;
+			}
+		}
+		return index;
+	}
+
+
+
 	#pragma mark Variant implementation
 
 	template<typename... Types>
-	Variant<Types...>::Variant(BaseType&& v): BaseType(v) {
+	Variant<Types...>::Variant(BaseType&& v): BaseType(std::move(v)) {
 		//
 	}
 
@@ -107,20 +215,28 @@ namespace fgl {
 
 	template<typename... Types>
 	template<typename Visitor>
-	decltype(auto) Variant<Types...>::visit(Visitor&& visitor) {
-		return std::visit(visitor, *this);
+	decltype(auto) Variant<Types...>::visit(Visitor&& visitor) & {
+		return visitVariants(std::forward<Visitor>(visitor), *this);
+	}
+
+	template<typename... Types>
+	template<typename Visitor>
+	decltype(auto) Variant<Types...>::visit(Visitor&& visitor) && {
+		return visitVariants(std::forward<Visitor>(visitor), std::move(*this));
 	}
 
 	template<typename... Types>
 	template<typename Visitor>
-	decltype(auto) Variant<Types...>::visit(Visitor&& visitor) const {
-		return std::visit(visitor, *this);
+	decltype(auto) Variant<Types...>::visit(Visitor&& visitor) const& {
+		return visitVariants(std::forward<Visitor>(visitor), *this);
 	}
 
 	template<typename... Types>
 	template<typename T>
 	bool Variant<Types...>::is() const {
-		return std::holds_alternative<T>(*this);
+		constexpr size_t index = _variantIndexOf<T,Types...>();
+		static_assert(index < sizeof...(Types), "T must occur exactly once in the variant's types");
+		return this->index() == index;
 	}
 
 	template<typename... Types>
@@ -144,20 +260,26 @@ namespace fgl {
 	template<typename... Types>
 	template<typename T>
 	T* Variant<Types...>::getIf() {
-		return std::get_if<T>(*this);
+		if(!is<T>()) {
+			return nullptr;
+		}
+		return &_VariantAccess<BaseType>::template get<_variantIndexOf<T,Types...>()>(*this);
 	}
 
 	template<typename... Types>
 	template<typename T>
 	const T* Variant<Types...>::getIf() const {
-		return std::get_if<T>(*this);
+		if(!is<T>()) {
+			return nullptr;
+		}
+		return &_VariantAccess<BaseType>::template get<_variantIndexOf<T,Types...>()>(*this);
 	}
 
 	template<typename... Types>
 	template<typename T>
 	T& Variant<Types...>::getOr(T& defaultVal) {
-		if(std::holds_alternative<T>(*this)) {
-			return std::get<T>(*this);
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
 		}
 		return defaultVal;
 	}
@@ -165,8 +287,8 @@ namespace fgl {
 	template<typename... Types>
 	template<typename T>
 	const T& Variant<Types...>::getOr(const T& defaultVal) const {
-		if(std::holds_alternative<T>(*this)) {
-			return std::get<T>(*this);
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
 		}
 		return defaultVal;
 	}
@@ -174,8 +296,8 @@ namespace fgl {
 	template<typename... Types>
 	template<typename T>
 	Optional<T> Variant<Types...>::maybeGet() const {
-		if(std::holds_alternative<T>(*this)) {
-			return std::get<T>(*this);
+		if(auto ptr = getIf<T>()) {
+			return *ptr;
 		}
 		return std::nullopt;
 	}
@@ -183,8 +305,8 @@ namespace fgl {
 	template<typename... Types>
 	template<typename T>
 	OptionalRef<T> Variant<Types...>::maybeGetRef() {
-		if(std::holds_alternative<T>(*this)) {
-			return std::ref(std::get<T>(*this));
+		if(auto ptr = getIf<T>()) {
+			return std::ref(*ptr);
 		}
 		return std::nullopt;
 	}
@@ -192,21 +314,34 @@ namespace fgl {
 	template<typename... Types>
 	template<typename T>
 	OptionalRef<const T> Variant<Types...>::maybeGetRef() const {
-		if(std::holds_alternative<T>(*this)) {
-			return std::ref(std::get<T>(*this));
+		if(auto ptr = getIf<T>()) {
+			return std::ref(*ptr);
 		}
 		return std::nullopt;
 	}
 
 	template<typename... Types>
 	const std::type_info& Variant<Types...>::type() const {
-		return std::visit([](auto& val) -> const std::type_info& {
-			return typeid(val);
-		}, *this);
+		static const std::type_info* types[] = { &typeid(Types)... };
+		auto index = this->index();
+		if(index == std::variant_npos) {
+			throw std::bad_variant_access();
+		}
+		return *types[index];
+	}
+
+	template<typename... Types>
+	TypeId Variant<Types...>::typeId() const {
+		static constexpr TypeId typeIds[] = { TypeId::of<Types>()... };
+		auto index = this->index();
+		if(index == std::variant_npos) {
+			return TypeId();
+		}
+		return typeIds[index];
 	}
 
 	template<typename... Types>
 	String Variant<Types...>::typeName() const {
-		return stringify_type(type());
+		return typeId().name();
 	}
 }
@@ -0,0 +1,17 @@
+//
+//  DataCppBenchmarks.hpp
+//  DataCppTest
+//
+//  Created by Luis Finke on 10/19/26.
+//  Copyright © 2026 Luis Finke. All rights reserved.
+//
+
+#pragma once
+
+#include <fgl/data.hpp>
+
+namespace fgl_data_cpp_tests {
+
+	void runBenchmarks();
+
+}
@@ -7,11 +7,25 @@
 //
 
 #include "DataCppTests.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <random>
 
 #ifdef __ANDROID__
 #include <android/log.h>
 #endif
 
+namespace fgl_data_cpp_tests {
+	enum class TestColor {
+		None,
+		Red,
+		Green
+	};
+}
+
+template<>
+struct fgl::optional_niche<fgl_data_cpp_tests::TestColor>: fgl::optional_niche_value<fgl_data_cpp_tests::TestColor,fgl_data_cpp_tests::TestColor::None> {};
+
 namespace fgl_data_cpp_tests {
 	using namespace fgl;
 
@@ -23,6 +37,194 @@ namespace fgl_data_cpp_tests {
 		#endif
 	}
 
+	class TestRefCounted: public RefCounted<TestRefCounted> {
+	public:
+		TestRefCounted(String name): name(name) {}
+		virtual ~TestRefCounted() {}
+		String name;
+	};
+
+	struct CopyCounter {
+		static size_t copies;
+		CopyCounter() {}
+		CopyCounter(const CopyCounter&) { copies++; }
+		CopyCounter(CopyCounter&&) {}
+	};
+	size_t CopyCounter::copies = 0;
+
+	struct ThrowingCopy {
+		ThrowingCopy(bool throws = false): throws(throws) {}
+		ThrowingCopy(const ThrowingCopy& other): throws(other.throws) {
+			if(throws) {
+				throw std::runtime_error("copy failed");
+			}
+		}
+		bool throws;
+	};
+
+	struct ThrowingMoveAssign {
+		ThrowingMoveAssign() {}
+		ThrowingMoveAssign(ThrowingMoveAssign&&) noexcept {}
+		ThrowingMoveAssign& operator=(ThrowingMoveAssign&&) { return *this; }
+	};
+
+	struct CountingJSONHandler: public JSONHandler {
+		virtual void onInteger(int64_t) override { integers++; }
+		virtual void onString(std::string_view value) override { strings.pushBack(String(value)); }
+		size_t integers = 0;
+		ArrayList<String> strings;
+	};
+
+	struct CopyCounterHolder {
+		CopyCounterHolder(CopyCounter counter, const String& name): counter(std::move(counter)), name(name) {}
+		CopyCounter counter;
+		String name;
+	};
+
+	using BinaryFuzzRecord = std::tuple<int64_t,uint32_t,double,String,ArrayList<int32_t>,Optional<String>,Variant<int,String>,Date,std::vector<std::tuple<>>,std::array<uint8_t,0>>;
+
+	BinaryFuzzRecord randomBinaryFuzzRecord(std::mt19937_64& random) {
+		auto randomString = [&]() {
+			String str;
+			size_t length = random() % 24;
+			for(size_t i=0; i<length; i++) {
+				str += (char)(random() % 256);
+			}
+			return str;
+		};
+		ArrayList<int32_t> numbers;
+		size_t numberCount = random() % 16;
+		for(size_t i=0; i<numberCount; i++) {
+			numbers.pushBack((int32_t)random());
+		}
+		auto optionalString = (random() % 2) ? Optional<String>(randomString()) : Optional<String>();
+		auto variant = (random() % 2) ? Variant<int,String>((int)random()) : Variant<int,String>(randomString());
+		// stays within the roughly 292 years around 1970 that nanoseconds can hold
+		auto nanoseconds = std::chrono::nanoseconds((int64_t)(random() >> 2) - ((int64_t)1 << 61));
+		auto date = Date(TimePoint(std::chrono::duration_cast<TimeInterval>(nanoseconds)));
+		return BinaryFuzzRecord((int64_t)random(), (uint32_t)random(), (double)(int64_t)random() / 7.0, randomString(), numbers,
+			optionalString, variant, date, std::vector<std::tuple<>>(random() % 4), {});
+	}
+
+	/// Round-trips random records through Binary, and checks that corrupted and truncated encodings only fail with BinaryDecodeError
+	bool fuzzBinary(size_t iterations) {
+		std::mt19937_64 random(20261019);
+		for(size_t i=0; i<iterations; i++) {
+			auto record = randomBinaryFuzzRecord(random);
+			auto encoded = Binary::encode(record);
+			if(Binary::decode<BinaryFuzzRecord>(encoded) != record) {
+				return false;
+			}
+			auto corrupted = encoded;
+			corrupted[random() % corrupted.size()] ^= (uint8_t)(1 + (random() % 255));
+			auto truncated = std::span<const uint8_t>(encoded.data(), random() % encoded.size());
+			for(auto bytes : { std::span<const uint8_t>(corrupted.data(), corrupted.size()), truncated }) {
+				try {
+					Binary::decode<BinaryFuzzRecord>(bytes);
+				} catch(BinaryDecodeError&) {
+					//
+				} catch(...) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/// Throws when a result doesn't match its expected value, so that a wrong result stops the run instead of only being printed
+	void check(bool passed, const String& description) {
+		if(!passed) {
+			throw std::runtime_error("Check failed: " + description);
+		}
+	}
+
+	template<typename Digest>
+	String hexDigest(const Digest& digest) {
+		return Data(digest.begin(), digest.end()).toHex();
+	}
+
+	/// Checks each hasher against its published test vectors, and returns the number of vectors checked
+	size_t checkHashReferenceVectors() {
+		size_t count = 0;
+		// FIPS 180 examples
+		const String millionA(1000000, 'a');
+		struct SHAVector {
+			StringView input;
+			const char* sha1;
+			const char* sha256;
+		};
+		const SHAVector shaVectors[] = {
+			{ "", "da39a3ee5e6b4b0d3255bfef95601890afd80709", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+			{ "abc", "a9993e364706816aba3e25717850c26c9cd0d89d", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+			{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "84983e441c3bd26ebaae4aa1f95129e5e54670f1", "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+			{ millionA, "34aa973cd4c4daa4f61eeb2bdbad27316534016f", "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" }
+		};
+		for(auto& vector : shaVectors) {
+			check(hexDigest(crypto::SHA1::hash(vector.input)) == vector.sha1, "SHA-1 of " + stringify(vector.input.size()) + " bytes");
+			check(hexDigest(crypto::SHA256::hash(vector.input)) == vector.sha256, "SHA-256 of " + stringify(vector.input.size()) + " bytes");
+			count += 2;
+		}
+		
+		// RFC 3720 B.4 examples
+		uint8_t zeros[32] = {};
+		uint8_t ones[32];
+		uint8_t increasing[32];
+		uint8_t decreasing[32];
+		for(size_t i=0; i<32; i++) {
+			ones[i] = 0xFF;
+			increasing[i] = (uint8_t)i;
+			decreasing[i] = (uint8_t)(31 - i);
+		}
+		const uint8_t readPDU[48] = {
+			0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18,
+			0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+		};
+		const std::pair<DataView,uint32_t> crcVectors[] = {
+			{ DataView(zeros, sizeof(zeros)), 0x8a9136aa },
+			{ DataView(ones, sizeof(ones)), 0x62a8ab43 },
+			{ DataView(increasing, sizeof(increasing)), 0x46dd794e },
+			{ DataView(decreasing, sizeof(decreasing)), 0x113fdb5c },
+			{ DataView(readPDU, sizeof(readPDU)), 0xd9963a56 },
+			{ DataView(std::string_view("123456789")), 0xe3069283 }
+		};
+		for(auto& [input, expected] : crcVectors) {
+			check(crypto::CRC32C::hash(input) == expected, "CRC32C of " + stringify(input.size()) + " bytes");
+			count++;
+		}
+		
+		// the reference xxhash library's XXH3_64bits, over bytes (i * 31 + 7), at lengths that reach each of its code paths
+		Data pattern(100000);
+		for(size_t i=0; i<pattern.size(); i++) {
+			pattern[i] = (uint8_t)((i * 31) + 7);
+		}
+		const std::pair<size_t,uint64_t> xxh3Vectors[] = {
+			{ 0, 0x2D06800538D394C2ULL },
+			{ 1, 0x4C5CCA45D0F4811FULL },
+			{ 3, 0x15F7093B173D005CULL },
+			{ 4, 0xDCA012F95811B6B9ULL },
+			{ 8, 0xDEC6A9A43575982EULL },
+			{ 9, 0xCBE393399F17FFBDULL },
+			{ 16, 0x7E484C18D74895D0ULL },
+			{ 17, 0x208BDE5EE2BED407ULL },
+			{ 128, 0xF92B70EAA21A6288ULL },
+			{ 129, 0xF8F76713F2BB60FAULL },
+			{ 240, 0xCCC7375172C41F03ULL },
+			{ 241, 0x0B3B630948CE4A00ULL },
+			{ 1024, 0x23BC880EBF0D29C6ULL },
+			{ 100000, 0xCCF90DF7E7E37036ULL }
+		};
+		for(auto& [length, expected] : xxh3Vectors) {
+			check(crypto::XXH3::hash(DataView(pattern.data(), length)) == expected, "XXH3 of " + stringify(length) + " bytes");
+			count++;
+		}
+		// long inputs take the interleaved CRC32C and hardware SHA-256 paths
+		check(crypto::CRC32C::hash(DataView(pattern.data(), pattern.size())) == 0xf3cb210b, "CRC32C of the pattern");
+		check(hexDigest(crypto::SHA256::hash(DataView(pattern.data(), pattern.size()))) == "731620161155f68e1209f22bc34a726bf5a583f40acf23ae55684b674fdbebf2", "SHA-256 of the pattern");
+		count += 2;
+		return count;
+	}
+
 	void runTests() {
 		BasicString<char> str = String::join(std::vector<String>{ String("hello"), String(" "), String("world") });
 
@@ -43,6 +245,38 @@ namespace fgl_data_cpp_tests {
 		println("concat result ( "+stringify_type<decltype(result)>()+" ): " + result.toString());
 		println(ArrayList<int>{ 1, 2, 5 }.toString());
 		println(LinkedList<int>{ 1, 2, 5 }.toString());
+		auto pooledList = LinkedList<String, PoolAllocator<String>>{ "pooled", "list", "nodes" };
+		println((String)"pool allocated: " + pooledList.where([](auto& str) { return str.size() > 4; }).toString());
+		println((String)"pooled split: " + String("a,b,c").splitPooled(',').toString());
+		auto unrolledList = UnrolledList<int>{ 4, 5, 6, 7, 8 };
+		unrolledList.pushFront(3);
+		auto unrolledFront = unrolledList.extractListFront(2);
+		unrolledList.pushBackList(std::move(unrolledFront));
+		unrolledList.removeWhere([](int num) { return num % 2 == 0; });
+		println(unrolledList.toString());
+		println("limited stringify: " + stringify(ArrayList<int>{ 1, 2, 3, 4, 5 }, { .maxItems = 2 }));
+		struct ScoreRecord { int id; double score; };
+		auto scoreRecords = ArrayList<ScoreRecord>{ { 1, 2.5 }, { 2, 9.0 }, { 3, 7.5 } };
+		auto scoreTable = ColumnTable<int,double>(scoreRecords, &ScoreRecord::id, &ScoreRecord::score);
+		auto highScores = scoreTable.where<1>([](double score) { return score > 5.0; });
+		println("column table high scores: " + std::to_string(highScores.size()) + ", total: " + std::to_string(scoreTable.reduce<1>(0.0, [](double total, double score) { return total + score; }))
+			+ ", first: " + std::to_string(highScores.toArrayList<ScoreRecord>().front().id));
+		auto rollbackTable = ColumnTable<int,ThrowingCopy>();
+		rollbackTable.emplaceBack(1, false);
+		auto throwingRow = std::tuple<int,ThrowingCopy>(2, true);
+		bool pushThrew = false;
+		bool removeThrew = false;
+		try {
+			rollbackTable.pushBack(throwingRow);
+		} catch(std::runtime_error&) {
+			pushThrew = true;
+		}
+		try {
+			rollbackTable.removeAt(1);
+		} catch(std::out_of_range&) {
+			removeThrew = true;
+		}
+		println("column table rolled back: " + stringify(pushThrew && rollbackTable.column<0>().size() == 1 && rollbackTable.column<1>().size() == 1) + ", removeAt out of range throws: " + stringify(removeThrew));
 
 		ArrayList<int>().maybeAt(0);
 		ArrayList<int>().maybeRefAt(0);
@@ -128,6 +362,20 @@ namespace fgl_data_cpp_tests {
 			return 5;
 		});
 		println((String)"mapped value: "+stringify(mappedOptInt));
+		std::optional<String>& stdOptStr = optStr;
+		Optional<TestColor> noColor;
+		Optional<TestColor> red = TestColor::Red;
+		static_assert(sizeof(OptionalRef<String>) == sizeof(String*));
+		static_assert(sizeof(Optional<std::shared_ptr<String>>) == sizeof(std::shared_ptr<String>));
+		static_assert(sizeof(Optional<SharedPtr<String>>) == sizeof(SharedPtr<String>));
+		static_assert(sizeof(Optional<RefPtr<TestRefCounted>>) == sizeof(RefPtr<TestRefCounted>));
+		auto nullShared = Optional<SharedPtr<String>>(SharedPtr<String>());
+		auto refString = String("referenced");
+		OptionalRef<String> optionalRef = std::ref(refString);
+		OptionalRef<String> emptyRef;
+		std::optional<SharedPtr<String>> stdOptShared = nullShared;
+		println("pointer niche optionals: null SharedPtr has value: " + stringify(nullShared.hasValue()) + ", as std::optional: " + stringify(stdOptShared.has_value()) + ", ref: " + optionalRef->get() + ", empty ref: " + stringify(!emptyRef.hasValue()));
+		println("opt-in niche optional without flag: " + stringify(sizeof(Optional<TestColor>) == sizeof(TestColor) && !noColor.hasValue() && red == TestColor::Red) + ", Optional<String> as std::optional: " + stringify(stdOptStr.value_or("")));
 		
 		auto optionalizedTypeString = stringify_type<Optionalized<Optional<String>>>();
 		println("Optionalized type name: "+optionalizedTypeString);
@@ -140,13 +388,204 @@ namespace fgl_data_cpp_tests {
 			{ "hello", String("world") },
 			{ "test", "what" }
 		};
+		println("anyMap[\"hello\"] is String: " + stringify(anyMap["hello"].is<String>()) + ", typeName: " + anyMap["hello"].typeName());
+		
+		Variant<int,String> variant = String("hello");
+		println("variant typeId == String: " + stringify(variant.typeId() == TypeId::of<String>()) + ", typeName: " + variant.typeName());
+		CompactVariant<bool,int16_t> compactVariant = (int16_t)12;
+		println("visitVariants: " + visitVariants([](auto& left, auto& right) { return stringify(left) + " and " + stringify(right); }, variant, compactVariant) + ", compact variant size: " + stringify(sizeof(compactVariant)));
+		CompactVariant<bool,String> boolOrString = "x";
+		println("compact variant from a string literal holds String: " + stringify(boolOrString.is<String>()) + ", nothrow move assign with a throwing alternative: " + stringify(std::is_nothrow_move_assignable_v<CompactVariant<int,ThrowingMoveAssign>>));
+		
+		auto refPtr = newRef<TestRefCounted>("refcounted");
+		WeakRef<TestRefCounted> weakRef = refPtr;
+		auto refPtrCopy = refPtr;
+		println("RefPtr " + refPtr->name + " refCount: " + stringify(refPtr.refCount()));
+		refPtr.reset();
+		refPtrCopy.reset();
+		println("WeakRef expired after reset: " + stringify(weakRef.expired()) + ", locked: " + stringify(weakRef.lock()));
+		
+		CopyCounter::copies = 0;
+		auto counterHolder = new$<CopyCounterHolder>(CopyCounter(), "new$");
+		println("new$ argument copies: " + stringify(CopyCounter::copies));
+		{
+			Arena arena;
+			auto arenaHolder = arena.newShared<CopyCounterHolder>(CopyCounter(), "arena");
+			auto arenaHolder2 = allocateShared<CopyCounterHolder>(ArenaAllocator<CopyCounterHolder>(arena), CopyCounter(), "arena2");
+			println("arena newShared argument copies: " + stringify(CopyCounter::copies) + ", arena capacity: " + stringify(arena.capacity()));
+		}
+		{
+			Arena requestArena;
+			auto requestString = pmr::String("strings and lists from one request", &requestArena);
+			auto words = requestString.split(' ').where([](auto& word) { return word.size() > 4; });
+			auto wordsCopy = words;
+			println("arena split: " + words.toString() + ", copy on arena: " + stringify(wordsCopy.get_allocator().resource() == &requestArena) + ", arena used: " + stringify(requestArena.capacity() > 0));
+		}
 		
 		println("current date ISO string: "+Date::now().toISOString());
 		
+		auto sharedPayload = SharedData(String("header|field1|field2"));
+		auto payloadFields = sharedPayload.split('|');
+		println("SharedData fields: " + stringify(payloadFields.size()) + ", last field: " + payloadFields.back().toString() + ", shared buffer uses: " + stringify(sharedPayload.useCount()) + ", starts with header: " + stringify(DataView(sharedPayload).startsWith(DataView(std::string_view("header")))));
+		
+		{
+			auto tempPath = String((std::filesystem::temp_directory_path() / "fgl_data_file_test.bin").string());
+			auto fileContents = Data(String("line one\nline two\nline three\n"));
+			if(auto file = std::fopen(tempPath.c_str(), "wb")) {
+				std::fwrite(fileContents.data(), 1, fileContents.size(), file);
+				std::fclose(file);
+				auto readContents = Data::readFile(tempPath);
+				auto mappedContents = Data::mapFile(tempPath, FileAccess::Sequential);
+				auto reader = DataReader(tempPath, 8);
+				size_t chunkCount = 0;
+				while(!reader.readChunk().empty()) {
+					chunkCount++;
+				}
+				println("Data::readFile equal: " + stringify(readContents == fileContents) + ", mapFile lines: " + stringify(mappedContents.view().split('\n').size() - 1) + ", DataReader chunks: " + stringify(chunkCount));
+				std::remove(tempPath.c_str());
+			}
+		}
+		
+		auto encodingInput = Data(String("data-cpp?"));
+		println("base64: " + encodingInput.toBase64() + ", base64url: " + encodingInput.toBase64URL() + ", hex: " + encodingInput.toHex() + ", round trip equal: " + stringify(Data::fromBase64(encodingInput.toBase64()) == encodingInput && Data::fromHex(encodingInput.toHex()) == encodingInput) + ", random token length: " + stringify(String::randomHex(16).size()));
+		
+		crypto::MD5 md5Hasher;
+		md5Hasher.update(StringView("data"));
+		md5Hasher.update(Data(String("-cpp")));
+		auto md5Digest = md5Hasher.finalize();
+		println("MD5 incremental: " + Data(md5Digest.begin(), md5Digest.end()).toHex() + ", matches md5(): " + stringify(Data(md5Digest.begin(), md5Digest.end()).toHex() == md5("data-cpp")));
+		ArrayList<StringView> md5Inputs = { "", "abc", "data-cpp", "message digest" };
+		auto md5Digests = md5Many(md5Inputs);
+		println("MD5 many: " + Data(md5Digests[1].begin(), md5Digests[1].end()).toHex() + ", matches md5(): " + stringify(Data(md5Digests[2].begin(), md5Digests[2].end()).toHex() == md5("data-cpp")));
+		auto streamedEqualsWhole = []<crypto::Hasher HasherType>(HasherType hasher) {
+			hasher.update(StringView("data"));
+			hasher.update(StringView("-cpp"));
+			return hasher.finalize() == HasherType::hash(StringView("data-cpp"));
+		};
+		println("hash reference vectors passed: " + stringify(checkHashReferenceVectors()));
+		println("SHA-1: " + sha1("abc") + ", SHA-256: " + sha256("abc") + ", hardware: " + stringify(crypto::SHA256::isHardwareAccelerated()));
+		println("CRC32C: " + stringify(crypto::CRC32C::hash(StringView("123456789"))) + ", XXH3: " + stringify(crypto::XXH3::hash(StringView("data-cpp"))) + ", streamed equals whole: " + stringify(streamedEqualsWhole(crypto::SHA1()) && streamedEqualsWhole(crypto::SHA256()) && streamedEqualsWhole(crypto::CRC32C()) && streamedEqualsWhole(crypto::XXH3())));
+		Data treeInput;
+		for(size_t i=0; i<10000; i++) {
+			treeInput.push_back((uint8_t)(i * 31));
+		}
+		auto tree = crypto::TreeHash<crypto::SHA256>::compute(treeInput, 1024, 4);
+		auto treeProof = tree.proof(9);
+		println("TreeHash leaves: " + stringify(tree.leafCount()) + ", matches single thread: " + stringify(tree.root() == crypto::TreeHash<crypto::SHA256>::compute(treeInput, 1024, 1).root()) + ", proof verifies: " + stringify(crypto::TreeHash<crypto::SHA256>::verifyProof(tree.root(), 9, tree.leafCount(), DataView(treeInput.data() + (9 * 1024), treeInput.size() - (9 * 1024)), treeProof)) + ", tampered leaf verifies: " + stringify(tree.verifyLeaf(0, DataView(treeInput.data() + 1, 1024))));
+		auto hmacDigest = crypto::HMAC<crypto::SHA256>::hash(StringView("Jefe"), StringView("what do ya want for nothing?"));
+		crypto::HMAC<crypto::MD5> keyedHMAC(StringView("Jefe"));
+		auto messageHMAC = keyedHMAC;
+		messageHMAC.update(StringView("what do ya want for nothing?"));
+		auto md5HMACDigest = messageHMAC.finalize();
+		println("HMAC-SHA256: " + Data(hmacDigest.begin(), hmacDigest.end()).toHex() + ", HMAC-MD5: " + Data(md5HMACDigest.begin(), md5HMACDigest.end()).toHex() + ", constant time equals: " + stringify(crypto::constantTimeEquals(md5HMACDigest, crypto::HMAC<crypto::MD5>::hash(StringView("Jefe"), StringView("what do ya want for nothing?")))));
+		
+		auto jsonDocument = JSON::parse("{\"name\": \"AC\\/DC\", \"albums\": [\"Highway to Hell\", \"Back in Black\"], \"formed\": 1973}");
+		auto albums = jsonDocument.root()["albums"].as<ArrayList<String>>();
+		println("JSON name: " + jsonDocument.root()["name"].asString() + ", albums: " + albums.toString() + ", formed: " + stringify(jsonDocument.root()["formed"].asInt64()));
+		// the view ends before the extra bracket, which would be a parse error if it was read
+		auto jsonText = std::string("[1, \"two\", 3]]");
+		CountingJSONHandler jsonHandler;
+		JSON::parse(std::string_view(jsonText.data(), jsonText.size() - 1), jsonHandler);
+		println("JSON handler integers: " + stringify(jsonHandler.integers) + ", strings: " + jsonHandler.strings.toString());
+		size_t invalidUTF8Rejected = 0;
+		for(const char* invalidText : { "[\"\xFF\"]", "[\"\xC0\xAF\"]", "[\"\xED\xA0\x80\"]", "[\"\xF4\x90\x80\x80\"]", "[\"caf\xC3\"]" }) {
+			try {
+				JSON::parse(String(invalidText));
+			} catch(JSONParseError&) {
+				invalidUTF8Rejected++;
+			}
+		}
+		println("JSON invalid UTF-8 rejected: " + stringify(invalidUTF8Rejected) + " of 5, valid UTF-8: " + JSON::parse(String("[\"caf\xC3\xA9 \xF0\x9F\x8E\xB8\"]")).root()[0].asString());
+		println("JSON encode: " + JSON::encode(Map<String,ArrayList<String>>{ { "albums", albums } }));
+		auto binaryAlbums = Binary::encode(std::make_tuple(albums, Optional<Date>(Date::epoch()), Variant<int,String>(String("rock"))));
+		auto decodedAlbums = Binary::decode<std::tuple<ArrayList<String>,Optional<Date>,Variant<int,String>>>(binaryAlbums);
+		bool dateLimitsHandled = true;
+		for(auto interval : { TimeInterval::max(), TimeInterval::min() }) {
+			auto limitDate = Date(TimePoint(interval));
+			try {
+				dateLimitsHandled = dateLimitsHandled && Binary::decode<Date>(Binary::encode(limitDate)) == limitDate;
+			} catch(std::out_of_range&) {
+				// clocks coarser than nanoseconds can hold dates that the format can't
+			}
+		}
+		auto emptyItems = Binary::decode<std::vector<std::tuple<>>>(Binary::encode(std::vector<std::tuple<>>(1000)));
+		println("binary fuzz round trips: " + stringify(fuzzBinary(2000)) + ", date limits: " + stringify(dateLimitsHandled) + ", empty items: " + stringify(emptyItems.size()));
+		println("binary encode: " + stringify(binaryAlbums.size()) + " bytes, decoded albums: " + stringify(std::get<0>(decodedAlbums).size()) + ", round trip equal: " + stringify(std::get<0>(decodedAlbums) == albums && std::get<2>(decodedAlbums) == Variant<int,String>(String("rock"))));
+		
+		ByteWriter packetWriter;
+		auto packetLength = packetWriter.placeholder<uint16_t>();
+		packetWriter.writeU32BE(0xCAFEF00D);
+		packetWriter.writeString("payload");
+		packetWriter.patchBE(packetLength, (uint16_t)(packetWriter.size() - sizeof(uint16_t)));
+		auto packet = packetWriter.take();
+		ByteReader packetReader(packet);
+		auto packetSize = packetReader.readU16BE();
+		auto packetMagic = packetReader.readU32BE();
+		println("ByteWriter packet: " + stringify(packet.size()) + " bytes, length field: " + stringify(packetSize) + ", magic matches: " + stringify(packetMagic == 0xCAFEF00D) + ", payload: " + String(packetReader.readString()));
+		// both codecs share one varint encoding, so they must write the same bytes and read each other's output
+		bool varintsMatch = true;
+		for(int64_t value : { (int64_t)0, (int64_t)-1, (int64_t)127, (int64_t)-64, (int64_t)300, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max() }) {
+			ByteWriter varintWriter;
+			varintWriter.writeVarint((uint64_t)value);
+			varintWriter.writeSignedVarint(value);
+			Data encoded;
+			BinaryEncoder varintEncoder(encoded);
+			varintEncoder.writeVarint((uint64_t)value);
+			varintEncoder.writeSignedVarint(value);
+			ByteReader varintReader(encoded);
+			varintsMatch = varintsMatch && varintWriter.view() == DataView(encoded) && varintReader.readVarint() == (uint64_t)value && varintReader.readSignedVarint() == value;
+		}
+		const uint8_t overlongVarint[11] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+		size_t overlongRejected = 0;
+		try {
+			ByteReader(overlongVarint, sizeof(overlongVarint)).readVarint();
+		} catch(BinaryDecodeError&) {
+			overlongRejected++;
+		}
+		try {
+			BinaryDecoder(overlongVarint, sizeof(overlongVarint)).readVarint();
+		} catch(BinaryDecodeError&) {
+			overlongRejected++;
+		}
+		println("varints match between codecs: " + stringify(varintsMatch) + ", overlong rejected: " + stringify(overlongRejected) + " of 2");
+		
 		auto url = URL("https://www.last.fm/music/AC%2FDC?hello=this+is+legal+right");
 		println("URL: "+url.toString());
 		println("URL.pathParts: "+url.pathParts().toString());
 		println("URL.queryItems: "+url.queryItems().toString());
+		auto urlView = URLView("https://user@example.com:8443/api/v1/items?id=7#top");
+		println("URLView host: "+String(urlView.host().value())+", port: "+stringify(urlView.port().value())+", path: "+String(urlView.path())+", toURL: "+urlView.toURL().toString()+", invalid: "+stringify(!URLView::parse("http://example.com:99999/").hasValue()));
+		auto encodedQueryValue = URL::encodeQueryValue("caf\u00e9 & cr\u00e8me=1/2");
+		println("URL query value encoded: "+encodedQueryValue+", decodes back: "+stringify(URL::decodeQueryValue(encodedQueryValue) == "caf\u00e9 & cr\u00e8me=1/2")+", path part: "+URL::encodePathPart("AC/DC live"));
+		
+		auto normalizedURL = URL::tryParse("HTTP://Example.COM:80/a/./b/../../../c?x=1", { .normalize = true });
+		ArrayList<StringView> logURLs = { "https://example.com/ok", "http://[::1/broken", "", "ftp://files.example.com:21/pub" };
+		ArrayList<URLParseResult> logResults;
+		logResults.resize(logURLs.size());
+		URL::parseMany(std::span(logURLs.data(), logURLs.size()), std::span(logResults.data(), logResults.size()), { .normalize = true });
+		println("URL normalized: "+normalizedURL.url->toString()+", batch errors: "+String::join(logResults.map([](auto& result) {
+			return String(URL::describe(result.error));
+		}), ", ")+", last: "+logResults.back().url->toString());
+		
+		URL::QueryParams queryParams("tag=a&q=caf%C3%A9+cr%C3%A8me&flag&tag=b");
+		println("URL query params: q="+String(queryParams.get("q").valueOr("<none>"))+", tags: "+String::join(queryParams.getAll("tag").map([](auto& tag) {
+			return String(tag);
+		}), ",")+", has flag: "+stringify(queryParams.has("flag"))+", missing: "+stringify(!queryParams.get("missing"))+", re-encoded: "+queryParams.toString());
+		String largeQueryString;
+		for(size_t i=0; i<40; i++) {
+			largeQueryString += (i == 0 ? "" : "&") + String("k") + stringify(i % 13) + "=v" + stringify(i);
+		}
+		URL::QueryParams scannedParams(largeQueryString);
+		URL::QueryParams indexedParams = scannedParams;
+		indexedParams.buildIndex();
+		bool indexMatchesScan = true;
+		for(size_t i=0; i<14; i++) {
+			String key = "k" + stringify(i);
+			indexMatchesScan = indexMatchesScan && scannedParams.getAll(key) == indexedParams.getAll(key) && scannedParams.get(key) == indexedParams.get(key);
+		}
+		println("URL query params index: "+stringify(indexedParams.size())+" items, matches scan: "+stringify(indexMatchesScan)+", k3: "+String::join(indexedParams.getAll("k3").map([](auto& value) {
+			return String(value);
+		}), ","));
 
 		println("Finished running data-cpp tests");
 	}
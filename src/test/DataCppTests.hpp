@@ -12,6 +12,8 @@
 
 namespace fgl_data_cpp_tests {
 
+	void println(const fgl::String& str);
+
 	void runTests();
 
 }
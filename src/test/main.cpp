@@ -7,8 +7,13 @@
 //
 
 #include "DataCppTests.hpp"
+#include "DataCppBenchmarks.hpp"
+#include <cstring>
 
 int main(int argc, char* argv[]) {
 	fgl_data_cpp_tests::runTests();
+	if(argc > 1 && std::strcmp(argv[1], "--benchmarks") == 0) {
+		fgl_data_cpp_tests::runBenchmarks();
+	}
 	return 0;
 }